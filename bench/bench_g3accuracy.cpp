@@ -0,0 +1,626 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+/*! \file
+\brief Accuracy (vs extended precision reference) and speed of functions.
+
+Usage: bench_g3accuracy [numRepeat]
+
+For each function and input sweep (structured and random) the program
+reports the maximum and RMS error in units of last place (ULP) together
+with the time per operation. For entity results, the error is the
+largest component difference expressed in ULPs of the largest reference
+component magnitude.
+
+References are evaluated in long double precision. If long double has
+no more precision than double on the platform, the program notes that
+the errors are not meaningful.
+
+An alternative (e.g. fast approximation) implementation can be judged
+by adding its rows next to those for the existing function.
+
+*/
+
+
+#include "harness.hpp"
+
+#include "engabra.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	using namespace engabra::g3;
+
+	using Real = long double;
+
+	//! Components of g3 entity (or double) as array
+	template <typename Type>
+	inline
+	std::array<double, sizeof(Type) / sizeof(double)>
+	compsOf
+		( Type const & item
+		)
+	{
+		std::array<double, sizeof(Type) / sizeof(double)> comps;
+		std::memcpy(comps.data(), &item, sizeof(Type));
+		return comps;
+	}
+
+	//! Error in ULPs (of largest reference magnitude) - NaN if got invalid
+	template <std::size_t Num>
+	inline
+	double
+	ulpError
+		( std::array<double, Num> const & got
+		, std::array<Real, Num> const & ref
+		)
+	{
+		Real refMax{ 0. };
+		Real difMax{ 0. };
+		bool okay{ true };
+		for (std::size_t nn{ 0u } ; nn < Num ; ++nn)
+		{
+			okay = okay && std::isfinite(got[nn]);
+			refMax = std::max(refMax, std::abs(ref[nn]));
+			difMax = std::max(difMax, std::abs(Real(got[nn]) - ref[nn]));
+		}
+		double err{ std::numeric_limits<double>::quiet_NaN() };
+		if (okay)
+		{
+			constexpr int numMant{ std::numeric_limits<double>::digits };
+			Real ulp{ std::numeric_limits<double>::denorm_min() };
+			if (std::numeric_limits<double>::min() < refMax)
+			{
+				int const expo{ std::ilogb(static_cast<double>(refMax)) };
+				ulp = std::ldexp(Real(1.), expo - (numMant - 1));
+			}
+			err = static_cast<double>(difMax / ulp);
+		}
+		return err;
+	}
+
+	//
+	// Extended precision references
+	//
+
+	//! Reference exp(biv)
+	inline
+	std::array<Real, 4u>
+	refExp
+		( BiVector const & biv
+		)
+	{
+		Real const b0{ biv[0] };
+		Real const b1{ biv[1] };
+		Real const b2{ biv[2] };
+		Real const mag{ std::sqrt(b0*b0 + b1*b1 + b2*b2) };
+		Real scale{ 1. };
+		if (Real(0.) < mag)
+		{
+			scale = std::sin(mag) / mag;
+		}
+		return { std::cos(mag), scale*b0, scale*b1, scale*b2 };
+	}
+
+	//! Reference logG2(spin) - for spinors with non-zero bivector
+	inline
+	std::array<Real, 4u>
+	refLogG2
+		( Spinor const & spin
+		)
+	{
+		Real const s0{ spin[0] };
+		Real const b0{ spin[1] };
+		Real const b1{ spin[2] };
+		Real const b2{ spin[3] };
+		Real const bMag{ std::sqrt(b0*b0 + b1*b1 + b2*b2) };
+		Real const mag{ std::sqrt(s0*s0 + bMag*bMag) };
+		Real scale{ 0. };
+		if (Real(0.) < bMag)
+		{
+			scale = std::atan2(bMag, s0) / bMag;
+		}
+		return { std::log(mag), scale*b0, scale*b1, scale*b2 };
+	}
+
+	//! Reference sqrtG2(spin) - for spinors with non-zero bivector
+	inline
+	std::array<Real, 4u>
+	refSqrtG2
+		( Spinor const & spin
+		)
+	{
+		std::array<Real, 4u> const logs{ refLogG2(spin) };
+		Real const halfMag{ std::exp(Real(.5) * logs[0]) };
+		Real const b0{ Real(.5) * logs[1] };
+		Real const b1{ Real(.5) * logs[2] };
+		Real const b2{ Real(.5) * logs[3] };
+		Real const ang{ std::sqrt(b0*b0 + b1*b1 + b2*b2) };
+		Real scale{ halfMag };
+		if (Real(0.) < ang)
+		{
+			scale = halfMag * std::sin(ang) / ang;
+		}
+		return { halfMag * std::cos(ang), scale*b0, scale*b1, scale*b2 };
+	}
+
+	//! Reference inverse(vec)
+	inline
+	std::array<Real, 3u>
+	refInvVec
+		( Vector const & vec
+		)
+	{
+		Real const v0{ vec[0] };
+		Real const v1{ vec[1] };
+		Real const v2{ vec[2] };
+		Real const magSq{ v0*v0 + v1*v1 + v2*v2 };
+		return { v0/magSq, v1/magSq, v2/magSq };
+	}
+
+	//! Basis blade (bit mask) for each MultiVector component
+	constexpr std::array<unsigned, 8u> sMasks{ 0u, 1u, 2u, 4u, 6u, 5u, 3u, 7u };
+
+	//! Sign of MultiVector component basis relative to canonical blade
+	constexpr std::array<int, 8u> sSigns{ 1, 1, 1, 1, 1, -1, 1, 1 };
+
+	//! Index of MultiVector component for bit mask
+	constexpr std::array<std::size_t, 8u> sNdxOfMask
+		{ 0u, 1u, 2u, 6u, 3u, 5u, 4u, 7u };
+
+	//! Sign from reordering canonical blade product (ma * mb)
+	inline
+	int
+	reorderSign
+		( unsigned ma
+		, unsigned const & mb
+		)
+	{
+		unsigned numSwaps{ 0u };
+		ma = ma >> 1u;
+		while (0u < ma)
+		{
+			unsigned bits{ ma & mb };
+			while (0u < bits)
+			{
+				numSwaps += (bits & 1u);
+				bits = bits >> 1u;
+			}
+			ma = ma >> 1u;
+		}
+		return (0u == (numSwaps & 1u)) ? 1 : -1;
+	}
+
+	//! Extended precision geometric product of multivector components
+	inline
+	std::array<Real, 8u>
+	refProduct
+		( std::array<Real, 8u> const & aa
+		, std::array<Real, 8u> const & bb
+		)
+	{
+		std::array<Real, 8u> cc{};
+		for (std::size_t na{ 0u } ; na < 8u ; ++na)
+		{
+			for (std::size_t nb{ 0u } ; nb < 8u ; ++nb)
+			{
+				unsigned const mask{ sMasks[na] ^ sMasks[nb] };
+				std::size_t const nc{ sNdxOfMask[mask] };
+				int const sign
+					{ sSigns[na] * sSigns[nb] * sSigns[nc]
+					* reorderSign(sMasks[na], sMasks[nb])
+					};
+				cc[nc] += Real(sign) * aa[na] * bb[nb];
+			}
+		}
+		return cc;
+	}
+
+	//! Reference inverse(mv) = conj(mv) * inverse(mv*conj(mv))
+	inline
+	std::array<Real, 8u>
+	refInvMv
+		( MultiVector const & mv
+		)
+	{
+		std::array<Real, 8u> aa;
+		std::array<Real, 8u> conj;
+		for (std::size_t nn{ 0u } ; nn < 8u ; ++nn)
+		{
+			aa[nn] = mv[nn];
+			bool const isVecOrBiv{ (0u < nn) && (nn < 7u) };
+			conj[nn] = isVecOrBiv ? (-aa[nn]) : aa[nn];
+		}
+		// product is (complex) Scalar + TriVector
+		std::array<Real, 8u> const prod{ refProduct(aa, conj) };
+		Real const re{ prod[0] };
+		Real const im{ prod[7] };
+		Real const den{ re*re + im*im };
+		std::array<Real, 8u> zInv{};
+		zInv[0] = re / den;
+		zInv[7] = -im / den;
+		return refProduct(conj, zInv);
+	}
+
+	//! Reference sin(x)/x
+	inline
+	std::array<Real, 1u>
+	refSync
+		( double const & angle
+		)
+	{
+		Real const xx{ angle };
+		Real value{ 1. };
+		if (Real(0.) < xx)
+		{
+			value = std::sin(xx) / xx;
+		}
+		return { value };
+	}
+
+	//
+	// Evaluation
+	//
+
+	//! Accuracy and speed for one function on one sweep
+	struct Row
+	{
+		std::string theName;
+		std::string theSweep;
+		std::size_t theNumSamps;
+		std::size_t theNumBad; //!< Invalid (non finite) results
+		double theMaxUlp;
+		double theRmsUlp;
+		double theNanoSecPerOp;
+	};
+
+	//! Errors of func against ref over inputs, and time of func
+	template <typename InType, typename Func, typename RefFunc>
+	inline
+	Row
+	evaluated
+		( std::string const & name
+		, std::string const & sweep
+		, std::vector<InType> const & inputs
+		, Func const & func
+		, RefFunc const & ref
+		, std::size_t const & numRepeat
+		)
+	{
+		Row row{ name, sweep, inputs.size(), 0u, 0., 0., 0. };
+		double sumSq{ 0. };
+		std::size_t numGood{ 0u };
+		for (InType const & input : inputs)
+		{
+			double const err{ ulpError(compsOf(func(input)), ref(input)) };
+			if (std::isnan(err))
+			{
+				++row.theNumBad;
+			}
+			else
+			{
+				row.theMaxUlp = std::max(row.theMaxUlp, err);
+				sumSq += err * err;
+				++numGood;
+			}
+		}
+		if (0u < numGood)
+		{
+			row.theRmsUlp = std::sqrt(sumSq / static_cast<double>(numGood));
+		}
+
+		bench::PerfCounters noPerf(false);
+		std::size_t const numIn{ inputs.size() };
+		bench::Result const timing
+			{ bench::measured
+				( name
+				, numRepeat * numIn
+				, [&inputs, &func, &numIn] (std::size_t const & ndx)
+					{ return func(inputs[ndx % numIn]); }
+				, noPerf
+				)
+			};
+		row.theNanoSecPerOp = timing.theNanoSecPerOp;
+		return row;
+	}
+
+	//! Fixed width text for ULP value (exponential format if large)
+	inline
+	std::string
+	ulpText
+		( double const & value
+		)
+	{
+		std::ostringstream oss;
+		oss << std::setw(12u);
+		if (value < 1.e6)
+		{
+			oss << std::fixed << std::setprecision(2) << value;
+		}
+		else
+		{
+			oss << std::scientific << std::setprecision(2) << value;
+		}
+		return oss.str();
+	}
+
+	//! Table of rows
+	inline
+	void
+	report
+		( std::ostream & ostrm
+		, std::vector<Row> const & rows
+		)
+	{
+		ostrm
+			<< std::setw(24u) << std::left << "function"
+			<< std::setw(14u) << "sweep" << std::right
+			<< std::setw(8u) << "samps"
+			<< std::setw(6u) << "bad"
+			<< std::setw(12u) << "maxULP"
+			<< std::setw(12u) << "rmsULP"
+			<< std::setw(10u) << "ns/op"
+			<< '\n';
+		for (Row const & row : rows)
+		{
+			ostrm
+				<< std::setw(24u) << std::left << row.theName
+				<< std::setw(14u) << row.theSweep << std::right
+				<< std::setw(8u) << row.theNumSamps
+				<< std::setw(6u) << row.theNumBad
+				<< ulpText(row.theMaxUlp)
+				<< ulpText(row.theRmsUlp)
+				<< bench::countText(row.theNanoSecPerOp, 10)
+				<< '\n';
+		}
+	}
+
+	//
+	// Input sweeps
+	//
+
+	//! Logarithmically spaced values in [minVal, maxVal]
+	inline
+	std::vector<double>
+	logSpaced
+		( double const & minVal
+		, double const & maxVal
+		, std::size_t const & num
+		)
+	{
+		std::vector<double> values;
+		double const logMin{ std::log(minVal) };
+		double const delta
+			{ (std::log(maxVal) - logMin) / static_cast<double>(num - 1u) };
+		for (std::size_t nn{ 0u } ; nn < num ; ++nn)
+		{
+			values.emplace_back
+				(std::exp(logMin + delta * static_cast<double>(nn)));
+		}
+		return values;
+	}
+
+	//! Directions for structured bivector sweeps
+	inline
+	std::vector<BiVector>
+	sweepDirs
+		()
+	{
+		return std::vector<BiVector>
+			{ e12, direction(BiVector{ 1., 2., 3. })
+			, direction(BiVector{ -3., 1., .5 })
+			};
+	}
+
+	//! Bivector angles: small to large in several planes
+	inline
+	std::vector<BiVector>
+	angleBivs
+		()
+	{
+		std::vector<BiVector> bivs;
+		for (BiVector const & dir : sweepDirs())
+		{
+			for (double const & angle : logSpaced(1.e-12, 3., 200u))
+			{
+				bivs.emplace_back(angle * dir);
+			}
+		}
+		return bivs;
+	}
+
+	//! Bivector angles: approaching a half turn in several planes
+	inline
+	std::vector<BiVector>
+	halfTurnBivs
+		()
+	{
+		std::vector<BiVector> bivs;
+		for (BiVector const & dir : sweepDirs())
+		{
+			for (double const & dist : logSpaced(1.e-12, 1.e-1, 100u))
+			{
+				bivs.emplace_back((turnHalf - dist) * dir);
+			}
+		}
+		return bivs;
+	}
+
+	//! Bivectors with components uniform in [-range,range)
+	inline
+	std::vector<BiVector>
+	randomBivs
+		( std::mt19937_64 & gen
+		, double const & range
+		, std::size_t const & num
+		)
+	{
+		std::uniform_real_distribution<double> dist(-range, range);
+		std::vector<BiVector> bivs;
+		for (std::size_t nn{ 0u } ; nn < num ; ++nn)
+		{
+			bivs.emplace_back(BiVector{ dist(gen), dist(gen), dist(gen) });
+		}
+		return bivs;
+	}
+
+	//! Spinors: exp(biv) scaled by magnitudes in [.5, 2)
+	inline
+	std::vector<Spinor>
+	spinsFrom
+		( std::vector<BiVector> const & bivs
+		, std::mt19937_64 & gen
+		)
+	{
+		std::uniform_real_distribution<double> dist(.5, 2.);
+		std::vector<Spinor> spins;
+		for (BiVector const & biv : bivs)
+		{
+			Spinor const spin{ dist(gen) * exp(biv) };
+			if (0. < magnitude(spin.theBiv))
+			{
+				spins.emplace_back(spin);
+			}
+		}
+		return spins;
+	}
+
+} // [anon]
+
+
+//! Evaluate accuracy and speed of selected functions
+int
+main
+	( int argc
+	, char * argv[]
+	)
+{
+	std::size_t numRepeat{ 100u };
+	if (1 < argc)
+	{
+		numRepeat = std::strtoul(argv[1], nullptr, 10);
+	}
+
+	std::cout << "# reference: long double with "
+		<< std::numeric_limits<Real>::digits << " mantissa bits\n";
+	if (! (std::numeric_limits<double>::digits
+		< std::numeric_limits<Real>::digits))
+	{
+		std::cout << "# WARNING: reference is not more precise than double"
+			" (errors are not meaningful)\n";
+	}
+
+	std::mt19937_64 gen(47u);
+	std::vector<BiVector> const bivsS{ angleBivs() };
+	std::vector<BiVector> const bivsH{ halfTurnBivs() };
+	std::vector<BiVector> const bivsR{ randomBivs(gen, 2., 2000u) };
+	std::vector<Spinor> const spinsS{ spinsFrom(bivsS, gen) };
+	std::vector<Spinor> const spinsH{ spinsFrom(bivsH, gen) };
+	std::vector<Spinor> const spinsR{ spinsFrom(bivsR, gen) };
+
+	std::uniform_real_distribution<double> distUnit(-1., 1.);
+	std::vector<Vector> vecsS;
+	for (double const & mag : logSpaced(1.e-150, 1.e150, 301u))
+	{
+		vecsS.emplace_back(mag * direction(Vector{ 1., -2., 3. }));
+	}
+	std::vector<Vector> vecsR;
+	std::vector<MultiVector> mvsR;
+	for (std::size_t nn{ 0u } ; nn < 2000u ; ++nn)
+	{
+		vecsR.emplace_back
+			(Vector{ distUnit(gen), distUnit(gen), distUnit(gen) });
+		std::array<double, 8u> comps;
+		std::generate
+			(comps.begin(), comps.end(), [&] () { return distUnit(gen); });
+		mvsR.emplace_back
+			(MultiVector
+				{ comps[0], comps[1], comps[2], comps[3]
+				, comps[4], comps[5], comps[6], comps[7]
+				}
+			);
+	}
+
+	std::vector<double> const anglesS{ logSpaced(1.e-8, 10., 2000u) };
+	std::vector<double> anglesR;
+	std::uniform_real_distribution<double> distAngle(0., turnFull);
+	for (std::size_t nn{ 0u } ; nn < 2000u ; ++nn)
+	{
+		anglesR.emplace_back(distAngle(gen));
+	}
+
+	auto const fExp{ [] (BiVector const & biv) { return exp(biv); } };
+	auto const fLog{ [] (Spinor const & spin) { return logG2(spin); } };
+	auto const fSqrt{ [] (Spinor const & spin) { return sqrtG2(spin); } };
+	auto const fInvVec{ [] (Vector const & vec) { return inverse(vec); } };
+	auto const fInvMv
+		{ [] (MultiVector const & mv) { return inverse<MultiVector>(mv); } };
+	auto const fSync
+		{ [] (double const & angle) { return priv::sync(angle); } };
+
+	std::vector<Row> rows;
+	auto const add
+		{ [&rows, &numRepeat]
+			( std::string const & name, std::string const & sweep
+			, auto const & inputs, auto const & func, auto const & ref
+			)
+			{
+				rows.emplace_back
+					(evaluated(name, sweep, inputs, func, ref, numRepeat));
+			}
+		};
+	add("exp(BiVector)", "angles", bivsS, fExp, refExp);
+	add("exp(BiVector)", "half-turn", bivsH, fExp, refExp);
+	add("exp(BiVector)", "random", bivsR, fExp, refExp);
+	add("logG2(Spinor)", "angles", spinsS, fLog, refLogG2);
+	add("logG2(Spinor)", "half-turn", spinsH, fLog, refLogG2);
+	add("logG2(Spinor)", "random", spinsR, fLog, refLogG2);
+	add("sqrtG2(Spinor)", "angles", spinsS, fSqrt, refSqrtG2);
+	add("sqrtG2(Spinor)", "half-turn", spinsH, fSqrt, refSqrtG2);
+	add("sqrtG2(Spinor)", "random", spinsR, fSqrt, refSqrtG2);
+	add("inverse(Vector)", "magnitudes", vecsS, fInvVec, refInvVec);
+	add("inverse(Vector)", "random", vecsR, fInvVec, refInvVec);
+	add("inverse(MultiVector)", "random", mvsR, fInvMv, refInvMv);
+	add("priv::sync(double)", "log-spaced", anglesS, fSync, refSync);
+	add("priv::sync(double)", "random", anglesR, fSync, refSync);
+
+	report(std::cout, rows);
+
+	return 0;
+}
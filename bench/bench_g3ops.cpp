@@ -0,0 +1,177 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+/*! \file
+\brief Benchmark of principal g3 operators and functions.
+
+Usage: bench_g3ops [numOps] [--no-perf]
+
+Reports time per operation and (where available) hardware counts per
+operation (ref perfcounts.hpp). For meaningful values, build with
+optimization (e.g. cmake -DCMAKE_BUILD_TYPE=Release).
+
+*/
+
+
+#include "harness.hpp"
+
+#include "engabra.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	using namespace engabra::g3;
+
+	//! Number of distinct (cycled) input values
+	constexpr std::size_t sNumInputs{ 1024u };
+
+	//! Pseudo-random input values for benchmarks
+	struct Inputs
+	{
+		std::vector<Vector> theVecs;
+		std::vector<BiVector> theBivs;
+		std::vector<Spinor> theSpins;
+		std::vector<MultiVector> theMvs;
+
+		//! Values with components (reproducibly) distributed in [-1,1)
+		static
+		Inputs
+		random
+			()
+		{
+			std::mt19937_64 gen(47u);
+			std::uniform_real_distribution<double> dist(-1., 1.);
+			Inputs inputs;
+			for (std::size_t nn{ 0u } ; nn < sNumInputs ; ++nn)
+			{
+				inputs.theVecs.emplace_back
+					(Vector{ dist(gen), dist(gen), dist(gen) });
+				BiVector const biv{ dist(gen), dist(gen), dist(gen) };
+				inputs.theBivs.emplace_back(biv);
+				inputs.theSpins.emplace_back(exp(biv));
+				inputs.theMvs.emplace_back
+					(MultiVector
+						{ dist(gen), dist(gen), dist(gen), dist(gen)
+						, dist(gen), dist(gen), dist(gen), dist(gen)
+						}
+					);
+			}
+			return inputs;
+		}
+	};
+
+	//! Cycled index into inputs
+	inline
+	std::size_t
+	at
+		( std::size_t const & ndx
+		)
+	{
+		return (ndx & (sNumInputs - 1u));
+	}
+
+} // [anon]
+
+
+//! Time principal operations and report results
+int
+main
+	( int argc
+	, char * argv[]
+	)
+{
+	std::size_t numOps{ 1000000u };
+	bool usePerf{ true };
+	for (int narg{ 1 } ; narg < argc ; ++narg)
+	{
+		std::string const arg(argv[narg]);
+		if ("--no-perf" == arg)
+		{
+			usePerf = false;
+		}
+		else
+		{
+			numOps = std::strtoul(argv[narg], nullptr, 10);
+		}
+	}
+
+	Inputs const in{ Inputs::random() };
+	std::vector<Vector> const & vecs = in.theVecs;
+	std::vector<BiVector> const & bivs = in.theBivs;
+	std::vector<Spinor> const & spins = in.theSpins;
+	std::vector<MultiVector> const & mvs = in.theMvs;
+
+	bench::PerfCounters perf(usePerf);
+	if (usePerf && (! perf.isAnyAvailable()))
+	{
+		std::cerr << "Note: hardware counters not available"
+			" (e.g. check /proc/sys/kernel/perf_event_paranoid)\n";
+	}
+
+	std::vector<bench::Result> results;
+	auto const run
+		{ [&results, &numOps, &perf] (std::string const & name, auto func)
+			{ results.emplace_back(bench::measured(name, numOps, func, perf)); }
+		};
+
+	run("Spinor*Spinor", [&] (std::size_t nn)
+		{ return spins[at(nn)] * spins[at(nn + 1u)]; });
+	run("Spinor*Vector*reverse(Spinor)", [&] (std::size_t nn)
+		{ return spins[at(nn)] * vecs[at(nn)] * reverse(spins[at(nn)]); });
+	run("MultiVector*MultiVector", [&] (std::size_t nn)
+		{ return mvs[at(nn)] * mvs[at(nn + 1u)]; });
+	run("inverse(Vector)", [&] (std::size_t nn)
+		{ return inverse(vecs[at(nn)]); });
+	run("inverse(MultiVector)", [&] (std::size_t nn)
+		{ return inverse<MultiVector>(mvs[at(nn)]); });
+	run("exp(BiVector)", [&] (std::size_t nn)
+		{ return exp(bivs[at(nn)]); });
+	run("exp(Spinor)", [&] (std::size_t nn)
+		{ return exp(spins[at(nn)]); });
+	run("exp(MultiVector)", [&] (std::size_t nn)
+		{ return exp(mvs[at(nn)]); });
+	run("logG2(Spinor)", [&] (std::size_t nn)
+		{ return logG2(spins[at(nn)]); });
+	run("sqrtG2(Spinor)", [&] (std::size_t nn)
+		{ return sqrtG2(spins[at(nn)]); });
+	run("log(MultiVector)", [&] (std::size_t nn)
+		{ return log(mvs[at(nn)]); });
+	run("sqrt(MultiVector)", [&] (std::size_t nn)
+		{ return sqrt(mvs[at(nn)]); });
+	run("sincos(MultiVector)", [&] (std::size_t nn)
+		{ return sincos(mvs[at(nn)]); });
+
+	std::cout << "# numOps: " << numOps << '\n';
+	bench::report(std::cout, results);
+
+	return 0;
+}
@@ -0,0 +1,186 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_bench_harness_INCL_
+#define engabra_bench_harness_INCL_
+
+/*! \file
+\brief Timing (and optional hardware counter) harness for benchmarks.
+
+*/
+
+
+#include "perfcounts.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+//! Code common to benchmark programs
+namespace bench
+{
+	//! Measurements for one benchmarked operation
+	struct Result
+	{
+		//! Operation identity
+		std::string theName{};
+
+		//! Number of operations timed
+		std::size_t theNumOps{ 0u };
+
+		//! Elapsed (wall clock) time per operation
+		double theNanoSecPerOp{ 0. };
+
+		//! Hardware counts per operation (negative if not available)
+		PerfCounts theCountsPerOp{};
+	};
+
+	//! Prevent compiler from eliminating computation of item
+	template <typename Type>
+	inline
+	void
+	keep
+		( Type const & item
+		)
+	{
+#if defined(__GNUC__)
+		__asm__ __volatile__ ("" : : "r"(&item) : "memory");
+#else
+		static volatile unsigned char sink{};
+		unsigned char byte{};
+		std::memcpy(&byte, &item, 1u);
+		sink = byte;
+#endif
+	}
+
+	/*! \brief Time numOps evaluations of func(ndx) (ndx=0,1,...)
+	 *
+	 * A short warm up precedes timing. Return values of func() are
+	 * passed to keep(). Counters in perf (if available) are collected
+	 * over the same interval as the time.
+	 */
+	template <typename Func>
+	inline
+	Result
+	measured
+		( std::string const & name
+		, std::size_t const & numOps
+		, Func const & func
+		, PerfCounters & perf
+		)
+	{
+		for (std::size_t ndx{ 0u } ; ndx < (numOps / 16u + 1u) ; ++ndx)
+		{
+			keep(func(ndx));
+		}
+
+		using Clock = std::chrono::steady_clock;
+		perf.start();
+		Clock::time_point const t0{ Clock::now() };
+		for (std::size_t ndx{ 0u } ; ndx < numOps ; ++ndx)
+		{
+			keep(func(ndx));
+		}
+		Clock::time_point const t1{ Clock::now() };
+		PerfCounts const counts{ perf.stop() };
+
+		double const perOp
+			{ 1. / static_cast<double>(std::max(numOps, std::size_t{ 1u })) };
+		Result result{ name, numOps, 0., {} };
+		result.theNanoSecPerOp = perOp
+			* std::chrono::duration<double, std::nano>(t1 - t0).count();
+		for (std::size_t ndx{ 0u } ; ndx < NumPerfEvents ; ++ndx)
+		{
+			result.theCountsPerOp[ndx]
+				= (counts[ndx] < 0.) ? -1. : (perOp * counts[ndx]);
+		}
+		return result;
+	}
+
+	//! Fixed width text for count (or "n/a" if negative)
+	inline
+	std::string
+	countText
+		( double const & value
+		, int const & width = 10
+		, int const & precision = 2
+		)
+	{
+		std::ostringstream oss;
+		oss << std::setw(width);
+		if (value < 0.)
+		{
+			oss << "n/a";
+		}
+		else
+		{
+			oss << std::fixed << std::setprecision(precision) << value;
+		}
+		return oss.str();
+	}
+
+	//! Table of results (one line each) with (per operation) values
+	inline
+	void
+	report
+		( std::ostream & ostrm
+		, std::vector<Result> const & results
+		)
+	{
+		ostrm << std::setw(10u) << "ns/op";
+		for (std::size_t ndx{ 0u } ; ndx < NumPerfEvents ; ++ndx)
+		{
+			ostrm << std::setw(10u) << nameFor(PerfEvent(ndx));
+		}
+		ostrm << std::setw(8u) << "IPC" << "  operation\n";
+		for (Result const & result : results)
+		{
+			PerfCounts const & counts = result.theCountsPerOp;
+			ostrm << countText(result.theNanoSecPerOp);
+			for (double const & count : counts)
+			{
+				ostrm << countText(count);
+			}
+			double ipc{ -1. };
+			if ((0. < counts[Cycles]) && (! (counts[Instructions] < 0.)))
+			{
+				ipc = counts[Instructions] / counts[Cycles];
+			}
+			ostrm << countText(ipc, 8) << "  " << result.theName << '\n';
+		}
+	}
+
+} // [bench]
+
+
+#endif // engabra_bench_harness_INCL_
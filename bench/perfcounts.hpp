@@ -0,0 +1,263 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_bench_perfcounts_INCL_
+#define engabra_bench_perfcounts_INCL_
+
+/*! \file
+\brief Optional hardware performance counters (Linux perf_event_open).
+
+Each counter is opened independently such that unavailable events
+(e.g. due to kernel.perf_event_paranoid setting, container restrictions,
+virtual machines or non-Linux platforms) are simply reported as not
+available while others continue to work.
+
+Vector floating point operations have no generic perf event. A raw
+(CPU specific) event code may be provided via environment variable
+Engabra_PerfRawFp (e.g. for Intel FP_ARITH_INST_RETIRED.256B_PACKED_DOUBLE
+"Engabra_PerfRawFp=0x10c7").
+
+*/
+
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#if defined(__linux__)
+#	include <linux/perf_event.h>
+#	include <sys/ioctl.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#endif
+
+
+//! Code common to benchmark programs
+namespace bench
+{
+	//! Hardware events of interest
+	enum PerfEvent : std::size_t
+	{
+		  Cycles = 0u
+		, Instructions
+		, BranchMisses
+		, CacheMisses
+		, FpVectorOps
+		, NumPerfEvents
+	};
+
+	//! Short (column heading) name for event
+	inline
+	std::string
+	nameFor
+		( PerfEvent const & event
+		)
+	{
+		static std::array<std::string, NumPerfEvents> const names
+			{ "cycles", "instr", "brMiss", "cacheMiss", "fpVec" };
+		return names[event];
+	}
+
+	//! Value of each counter (negative for counters not available)
+	using PerfCounts = std::array<double, NumPerfEvents>;
+
+	/*! \brief Collection of (independently) opened hardware counters.
+	 *
+	 * Usage: start(), (code of interest), stop() returns counts.
+	 */
+	class PerfCounters
+	{
+		//! File descriptors (negative if event not available)
+		std::array<int, NumPerfEvents> theFds;
+
+#if defined(__linux__)
+
+		//! Open counter for (type,config) in this process (user space)
+		static
+		int
+		openedFd
+			( std::uint32_t const & type
+			, std::uint64_t const & config
+			)
+		{
+			perf_event_attr attr{};
+			attr.size = sizeof(perf_event_attr);
+			attr.type = type;
+			attr.config = config;
+			attr.disabled = 1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			long const fd
+				{ syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0) };
+			return static_cast<int>(fd);
+		}
+
+		//! Raw event config from environment (or zero if not set)
+		static
+		std::uint64_t
+		rawFpConfig
+			()
+		{
+			std::uint64_t config{ 0u };
+			char const * const text{ std::getenv("Engabra_PerfRawFp") };
+			if (text)
+			{
+				config = std::strtoull(text, nullptr, 0);
+			}
+			return config;
+		}
+
+#endif
+
+	public:
+
+		//! Open all available counters (unless isWanted is false)
+		explicit
+		PerfCounters
+			( bool const & isWanted = true
+			)
+		{
+			theFds.fill(-1);
+#if defined(__linux__)
+			if (isWanted)
+			{
+				theFds[Cycles] = openedFd
+					(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+				theFds[Instructions] = openedFd
+					(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+				theFds[BranchMisses] = openedFd
+					(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+				theFds[CacheMisses] = openedFd
+					(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+				std::uint64_t const rawFp{ rawFpConfig() };
+				if (0u < rawFp)
+				{
+					theFds[FpVectorOps] = openedFd(PERF_TYPE_RAW, rawFp);
+				}
+			}
+#else
+			(void)isWanted;
+#endif
+		}
+
+		PerfCounters(PerfCounters const &) = delete;
+		PerfCounters & operator=(PerfCounters const &) = delete;
+
+		//! Close counters
+		~PerfCounters
+			()
+		{
+#if defined(__linux__)
+			for (int const & fd : theFds)
+			{
+				if (! (fd < 0))
+				{
+					close(fd);
+				}
+			}
+#endif
+		}
+
+		//! True if event is being counted
+		inline
+		bool
+		isAvailable
+			( PerfEvent const & event
+			) const
+		{
+			return (! (theFds[event] < 0));
+		}
+
+		//! True if any event is being counted
+		inline
+		bool
+		isAnyAvailable
+			() const
+		{
+			bool any{ false };
+			for (int const & fd : theFds)
+			{
+				any = any || (! (fd < 0));
+			}
+			return any;
+		}
+
+		//! Reset and enable all available counters
+		inline
+		void
+		start
+			()
+		{
+#if defined(__linux__)
+			for (int const & fd : theFds)
+			{
+				if (! (fd < 0))
+				{
+					ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+					ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+				}
+			}
+#endif
+		}
+
+		//! Disable counters and return values since start()
+		inline
+		PerfCounts
+		stop
+			()
+		{
+			PerfCounts counts;
+			counts.fill(-1.);
+#if defined(__linux__)
+			for (int const & fd : theFds)
+			{
+				if (! (fd < 0))
+				{
+					ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+				}
+			}
+			for (std::size_t ndx{ 0u } ; ndx < NumPerfEvents ; ++ndx)
+			{
+				if (! (theFds[ndx] < 0))
+				{
+					std::uint64_t value{ 0u };
+					constexpr ssize_t numBytes{ sizeof(value) };
+					if (numBytes == read(theFds[ndx], &value, sizeof(value)))
+					{
+						counts[ndx] = static_cast<double>(value);
+					}
+				}
+			}
+#endif
+			return counts;
+		}
+	};
+
+} // [bench]
+
+
+#endif // engabra_bench_perfcounts_INCL_
@@ -34,13 +34,31 @@ For typical use, only this file need be included.
 */
 
 
+#include "g3attint.hpp"
+#include "g3batch.hpp"
+#include "g3camera.hpp"
+#include "g3codec.hpp"
 #include "g3compare.hpp"
 #include "g3type.hpp"
 #include "g3const.hpp"
+#include "g3dual.hpp"
 #include "g3func.hpp"
+#include "g3ingest.hpp"
+#include "g3instr.hpp"
 #include "g3io.hpp" // TODO -- (slow compile?)
+#include "g3jacobian.hpp"
+#include "g3lazy.hpp"
 #include "g3ops.hpp"
+#include "g3pipe.hpp"
 #include "g3publish.hpp"
+#include "g3quat.hpp"
+#include "g3record.hpp"
+#include "g3rigid.hpp"
+#include "g3rotavg.hpp"
+#include "g3rotfit.hpp"
+#include "g3rotmat.hpp"
+#include "g3rotsync.hpp"
+#include "g3spintrack.hpp"
 #include "g3type.hpp"
 #include "g3validity.hpp"
 
@@ -0,0 +1,192 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3_eigen_INCL_
+#define engabra_g3_eigen_INCL_
+
+/*! \file
+\brief Internal eigen decomposition for small symmetric matrices.
+
+Rotation estimation problems expressed in terms of spinor components
+(e.g. best fit rotation and chordal averaging) reduce to finding the
+dominant eigenvector of a symmetric 4x4 matrix. The cyclic Jacobi
+method used here is robust for repeated and near-repeated eigenvalues
+(which occur for degenerate geometry) and converges to machine
+precision in a handful of sweeps for matrices of this size.
+
+*/
+
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+namespace priv
+{
+	//! Eigen values and (column) eigen vectors of symmetric 4x4 matrix
+	struct SymEigen4
+	{
+		//! Eigen values in decreasing order
+		std::array<double, 4u> theValues;
+
+		//! Eigen vectors: theVectors[nn] corresponds to theValues[nn]
+		std::array<std::array<double, 4u>, 4u> theVectors;
+
+		/*! \brief Decomposition of symmetric matrix (row major elements).
+		 *
+		 * Only the upper triangle of symMat is used.
+		 */
+		inline
+		static
+		SymEigen4
+		from
+			( std::array<double, 16u> const & symMat
+			)
+		{
+			std::array<double, 16u> aa{ symMat };
+			for (std::size_t row{1u} ; row < 4u ; ++row)
+			{
+				for (std::size_t col{0u} ; col < row ; ++col)
+				{
+					aa[4u*row + col] = aa[4u*col + row];
+				}
+			}
+			std::array<double, 16u> vv
+				{ 1., 0., 0., 0.
+				, 0., 1., 0., 0.
+				, 0., 0., 1., 0.
+				, 0., 0., 0., 1.
+				};
+
+			constexpr std::size_t maxSweeps{ 32u };
+			for (std::size_t sweep{0u} ; sweep < maxSweeps ; ++sweep)
+			{
+				double offSq{ 0. };
+				double diagSq{ 0. };
+				for (std::size_t pp{0u} ; pp < 4u ; ++pp)
+				{
+					diagSq += aa[5u*pp] * aa[5u*pp];
+					for (std::size_t qq{pp + 1u} ; qq < 4u ; ++qq)
+					{
+						offSq += aa[4u*pp + qq] * aa[4u*pp + qq];
+					}
+				}
+				constexpr double eps{ std::numeric_limits<double>::epsilon() };
+				if (! (eps * eps * diagSq < offSq))
+				{
+					break;
+				}
+
+				for (std::size_t pp{0u} ; pp < 3u ; ++pp)
+				{
+					for (std::size_t qq{pp + 1u} ; qq < 4u ; ++qq)
+					{
+						double const apq{ aa[4u*pp + qq] };
+						if (0. == apq)
+						{
+							continue;
+						}
+						double const app{ aa[5u*pp] };
+						double const aqq{ aa[5u*qq] };
+						double const theta{ .5 * (aqq - app) / apq };
+						double const sgn{ (theta < 0.) ? -1. : 1. };
+						double const tt
+							{ sgn / (std::abs(theta)
+								+ std::sqrt(theta*theta + 1.))
+							};
+						double const cc{ 1. / std::sqrt(tt*tt + 1.) };
+						double const ss{ tt * cc };
+
+						// rotate rows/columns pp and qq
+						for (std::size_t kk{0u} ; kk < 4u ; ++kk)
+						{
+							double const akp{ aa[4u*kk + pp] };
+							double const akq{ aa[4u*kk + qq] };
+							aa[4u*kk + pp] = cc*akp - ss*akq;
+							aa[4u*kk + qq] = ss*akp + cc*akq;
+						}
+						for (std::size_t kk{0u} ; kk < 4u ; ++kk)
+						{
+							double const apk{ aa[4u*pp + kk] };
+							double const aqk{ aa[4u*qq + kk] };
+							aa[4u*pp + kk] = cc*apk - ss*aqk;
+							aa[4u*qq + kk] = ss*apk + cc*aqk;
+						}
+						for (std::size_t kk{0u} ; kk < 4u ; ++kk)
+						{
+							double const vkp{ vv[4u*kk + pp] };
+							double const vkq{ vv[4u*kk + qq] };
+							vv[4u*kk + pp] = cc*vkp - ss*vkq;
+							vv[4u*kk + qq] = ss*vkp + cc*vkq;
+						}
+					}
+				}
+			}
+
+			// order by decreasing eigen value
+			std::array<std::size_t, 4u> ndxs{ 0u, 1u, 2u, 3u };
+			for (std::size_t ii{1u} ; ii < 4u ; ++ii)
+			{
+				for (std::size_t jj{ii} ; (0u < jj) ; --jj)
+				{
+					if (aa[5u*ndxs[jj - 1u]] < aa[5u*ndxs[jj]])
+					{
+						std::swap(ndxs[jj - 1u], ndxs[jj]);
+					}
+				}
+			}
+
+			SymEigen4 eig;
+			for (std::size_t nn{0u} ; nn < 4u ; ++nn)
+			{
+				std::size_t const col{ ndxs[nn] };
+				eig.theValues[nn] = aa[5u*col];
+				for (std::size_t kk{0u} ; kk < 4u ; ++kk)
+				{
+					eig.theVectors[nn][kk] = vv[4u*kk + col];
+				}
+			}
+			return eig;
+		}
+	};
+
+} // [priv]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3_eigen_INCL_
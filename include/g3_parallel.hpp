@@ -0,0 +1,255 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3_parallel_INCL_
+#define engabra_g3_parallel_INCL_
+
+/*! \file
+\brief Internal support for splitting batch evaluations across threads.
+
+The batch functions that accept a numThreads argument divide their
+index range into contiguous chunks and evaluate each chunk on its own
+std::thread (with the final chunk evaluated on the calling thread).
+Each chunk writes only to its own portion of the output, so no locking
+is involved.
+
+A numThreads value of zero requests std::thread::hardware_concurrency()
+threads. Small ranges are evaluated on the calling thread alone since
+thread startup cost would exceed any benefit.
+
+*/
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+namespace priv
+{
+	//! Minimum number of items (per thread) for which threads are started.
+	constexpr std::size_t sMinItemsPerThread{ 16u * 1024u };
+
+	/*! \brief Number of threads to use for processing numItems.
+	 *
+	 * A numThreads value of zero is interpreted as hardware concurrency.
+	 * The result is always at least one (the calling thread).
+	 */
+	inline
+	std::size_t
+	threadCountFor
+		( std::size_t const & numItems
+		, std::size_t const & numThreads
+		, std::size_t const & minPerThread = sMinItemsPerThread
+		)
+	{
+		std::size_t useThreads{ numThreads };
+		if (0u == useThreads)
+		{
+			useThreads = std::thread::hardware_concurrency();
+		}
+		constexpr std::size_t one{ 1u };
+		std::size_t const maxUseful{ numItems / std::max(minPerThread, one) };
+		return std::max(one, std::min(useThreads, maxUseful));
+	}
+
+	/*! \brief Call func(chunkNdx, ndxBeg, ndxEnd) for numChunks chunks.
+	 *
+	 * The range [0,numItems) is split into numChunks contiguous chunks
+	 * of (nearly) equal size that are processed concurrently (the last
+	 * chunk on the calling thread). The func must be safe to call
+	 * concurrently for disjoint index ranges.
+	 *
+	 * If func throws on the calling thread (or a thread cannot be
+	 * started), the already started threads are joined before the
+	 * exception propagates. An exception thrown by func on any other
+	 * thread terminates the program (as for any std::thread).
+	 */
+	template <typename Func>
+	inline
+	void
+	forEachChunk
+		( std::size_t const & numItems
+		, std::size_t const & numChunks
+		, Func const & func
+		)
+	{
+		if (numChunks < 2u)
+		{
+			func(std::size_t{ 0u }, std::size_t{ 0u }, numItems);
+		}
+		else
+		{
+			std::size_t const perChunk{ numItems / numChunks };
+			std::size_t const extra{ numItems % numChunks };
+			std::vector<std::thread> threads;
+			threads.reserve(numChunks - 1u);
+			try
+			{
+				std::size_t ndxBeg{ 0u };
+				for (std::size_t nn{0u} ; nn < numChunks ; ++nn)
+				{
+					std::size_t const size
+						{ perChunk + ((nn < extra) ? 1u : 0u) };
+					std::size_t const ndxEnd{ ndxBeg + size };
+					if (nn + 1u < numChunks)
+					{
+						threads.emplace_back
+							(std::thread(func, nn, ndxBeg, ndxEnd));
+					}
+					else
+					{
+						func(nn, ndxBeg, ndxEnd); // last chunk on this thread
+					}
+					ndxBeg = ndxEnd;
+				}
+			}
+			catch (...)
+			{
+				// join threads already started (e.g. if func throws on
+				// this thread or thread creation fails) before propagating
+				for (std::thread & thread : threads)
+				{
+					thread.join();
+				}
+				throw;
+			}
+			for (std::thread & thread : threads)
+			{
+				thread.join();
+			}
+		}
+	}
+
+	/*! \brief Call func(ndxBeg, ndxEnd) for contiguous chunks of [0,numItems).
+	 *
+	 * The chunks are (nearly) equal in size and are processed concurrently.
+	 * The func must be safe to call concurrently for disjoint index ranges.
+	 */
+	template <typename Func>
+	inline
+	void
+	parallelFor
+		( std::size_t const & numItems
+		, Func const & func
+		, std::size_t const & numThreads = 0u
+		, std::size_t const & minPerThread = sMinItemsPerThread
+		)
+	{
+		forEachChunk
+			( numItems
+			, threadCountFor(numItems, numThreads, minPerThread)
+			, [&func]
+				( std::size_t const & // chunkNdx
+				, std::size_t const & ndxBeg
+				, std::size_t const & ndxEnd
+				)
+				{
+					func(ndxBeg, ndxEnd);
+				}
+			);
+	}
+
+	/*! \brief Partial results, func(ndxBeg, ndxEnd), for chunks in order.
+	 *
+	 * Useful for reductions: the returned partial results (one per chunk,
+	 * in index order) can be combined in a thread-timing independent
+	 * (i.e. repeatable) order by the caller.
+	 */
+	template <typename Type, typename Func>
+	inline
+	std::vector<Type>
+	parallelPartials
+		( std::size_t const & numItems
+		, Func const & func
+		, std::size_t const & numThreads = 0u
+		, std::size_t const & minPerThread = sMinItemsPerThread
+		)
+	{
+		std::size_t const numChunks
+			{ threadCountFor(numItems, numThreads, minPerThread) };
+		std::vector<Type> parts(numChunks);
+		forEachChunk
+			( numItems
+			, numChunks
+			, [&func, &parts]
+				( std::size_t const & chunkNdx
+				, std::size_t const & ndxBeg
+				, std::size_t const & ndxEnd
+				)
+				{
+					parts[chunkNdx] = func(ndxBeg, ndxEnd);
+				}
+			);
+		return parts;
+	}
+
+	/*! \brief Concurrent std::transform() for random access iterators.
+	 *
+	 * Returns itOut advanced past the last value written.
+	 */
+	template <typename InIter, typename OutIter, typename Func>
+	inline
+	OutIter
+	parallelTransform
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		, Func const & func
+		, std::size_t const & numThreads = 0u
+		)
+	{
+		std::size_t const numItems
+			{ static_cast<std::size_t>(std::distance(itBeg, itEnd)) };
+		parallelFor
+			( numItems
+			, [&itBeg, &itOut, &func]
+				(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+				{
+					std::transform
+						(itBeg + ndxBeg, itBeg + ndxEnd, itOut + ndxBeg, func);
+				}
+			, numThreads
+			);
+		return itOut + numItems;
+	}
+
+} // [priv]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3_parallel_INCL_
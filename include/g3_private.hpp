@@ -35,6 +35,11 @@ Example:
 */
 
 
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+
 namespace engabra
 {
 
@@ -0,0 +1,361 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3attint_INCL_
+#define engabra_g3attint_INCL_
+
+/*! \file
+\brief Attitude integration from angular rate bivectors.
+
+\b Overview
+
+Attitude spinors, S, are propagated over time steps, h, given the
+angular velocity bivector, W, at the start and end of each step (with
+the rate taken as linear in between). The sign convention is that a
+rate W=w*e12 (with w>0) turns e1 toward e2 under S*v*reverse(S).
+
+Rates may be expressed in either of two frames (ref RateFrame):
+\arg World - dS/dt = -1/2 * W * S
+\arg Body - dS/dt = -1/2 * S * W
+
+Integration schemes (ref IntegScheme):
+\arg ExpMid - exact exp() increment of the mean rate (exact for
+constant rates, second order otherwise).
+\arg Magnus4 - exp() of the fourth order Magnus generator (mean rate
+plus commutator correction). Results remain exactly unitary other than
+for roundoff.
+\arg RK4 - classic Runge-Kutta integration of the spinor ODE. Results
+drift slowly from unit magnitude and should be renormalized.
+
+Functions include:
+\arg advanced() - single attitude propagated over one step
+\arg batch::advance() - in-place propagation of attitudes stored as
+component arrays (SoA), optionally multithreaded
+\arg batch::renormalize() - restore unit magnitude of SoA attitudes
+\arg AttitudeStepper - repeated batch steps with periodic renormalization
+
+Example:
+\snippet test_g3attint_all.cpp DoxyExample01
+
+*/
+
+
+#include "g3_parallel.hpp"
+#include "g3const.hpp"
+#include "g3func.hpp"
+#include "g3ops.hpp"
+#include "g3type.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+	//! Frame in which angular rate bivectors are expressed
+	enum class RateFrame
+	{
+		  World //!< Rate in reference frame: dS/dt = -W*S/2
+		, Body //!< Rate in body (moving) frame: dS/dt = -S*W/2
+	};
+
+	//! Numerical integration scheme
+	enum class IntegScheme
+	{
+		  ExpMid //!< Exponential of mean rate (exact for constant rate)
+		, Magnus4 //!< Exponential of 4th order Magnus generator
+		, RK4 //!< Classic 4th order Runge-Kutta (not norm preserving)
+	};
+
+	//! Parameters controlling attitude integration
+	struct IntegControl
+	{
+		//! Integration method
+		IntegScheme theScheme{ IntegScheme::Magnus4 };
+
+		//! Frame in which rates are expressed
+		RateFrame theFrame{ RateFrame::Body };
+	};
+
+namespace priv
+{
+	//! Minimum attitudes per thread for batch operations.
+	constexpr std::size_t sAttMinPerThread{ 2u * 1024u };
+
+	//! Bivector of cross product of (dual) components: rateA x rateB
+	inline
+	BiVector
+	crossComp
+		( BiVector const & rateA
+		, BiVector const & rateB
+		)
+	{
+		std::array<double, 3u> const & aa = rateA.theData;
+		std::array<double, 3u> const & bb = rateB.theData;
+		return BiVector
+			{ aa[1]*bb[2] - aa[2]*bb[1]
+			, aa[2]*bb[0] - aa[0]*bb[2]
+			, aa[0]*bb[1] - aa[1]*bb[0]
+			};
+	}
+
+	/*! \brief Time derivative of spinor for rate (ref RateFrame).
+	 */
+	inline
+	Spinor
+	spinRate
+		( Spinor const & spin
+		, BiVector const & rate
+		, RateFrame const & frame
+		)
+	{
+		Spinor result;
+		if (RateFrame::World == frame)
+		{
+			result = -.5 * (rate * spin);
+		}
+		else
+		{
+			result = -.5 * (spin * rate);
+		}
+		return result;
+	}
+
+	//! Classic Runge-Kutta step with linearly varying rate
+	inline
+	Spinor
+	advancedRK4
+		( Spinor const & spin
+		, BiVector const & rateBeg
+		, BiVector const & rateEnd
+		, double const & dt
+		, RateFrame const & frame
+		)
+	{
+		BiVector const rateMid{ .5 * (rateBeg + rateEnd) };
+		Spinor const k1{ spinRate(spin, rateBeg, frame) };
+		Spinor const k2{ spinRate(spin + (.5*dt) * k1, rateMid, frame) };
+		Spinor const k3{ spinRate(spin + (.5*dt) * k2, rateMid, frame) };
+		Spinor const k4{ spinRate(spin + dt * k3, rateEnd, frame) };
+		return spin + (dt / 6.) * (k1 + 2. * (k2 + k3) + k4);
+	}
+
+} // [priv]
+
+	/*! \brief Attitude propagated over one time step of duration dt.
+	 *
+	 * The angular rate is rateBeg at the start of the step and rateEnd
+	 * at the end (varying linearly in between). For the exponential
+	 * schemes, the increment exp(G) is applied on the left (World) or
+	 * right (Body) of spin with generator
+	 *
+	 * \arg G = -dt/4*(rateBeg+rateEnd) + c*dt^2/24*(rateBeg x rateEnd)
+	 *
+	 * where c = +1 (World), -1 (Body) for Magnus4 and c=0 for ExpMid.
+	 */
+	inline
+	Spinor
+	advanced
+		( Spinor const & spin
+		, BiVector const & rateBeg
+		, BiVector const & rateEnd
+		, double const & dt
+		, IntegControl const & ctl = {}
+		)
+	{
+		Spinor result;
+		if (IntegScheme::RK4 == ctl.theScheme)
+		{
+			result = priv::advancedRK4
+				(spin, rateBeg, rateEnd, dt, ctl.theFrame);
+		}
+		else
+		{
+			BiVector gen{ (-.25 * dt) * (rateBeg + rateEnd) };
+			if (IntegScheme::Magnus4 == ctl.theScheme)
+			{
+				double scl{ (dt * dt) / 24. };
+				if (RateFrame::Body == ctl.theFrame)
+				{
+					scl = -scl;
+				}
+				gen = gen + scl * priv::crossComp(rateBeg, rateEnd);
+			}
+			Spinor const inc{ exp(gen) };
+			if (RateFrame::World == ctl.theFrame)
+			{
+				result = inc * spin;
+			}
+			else
+			{
+				result = spin * inc;
+			}
+		}
+		return result;
+	}
+
+namespace batch
+{
+	/*! \brief Propagate (in place) attitudes stored as component arrays.
+	 *
+	 * The spinComps arrays are the four spinor components (scalar, e23,
+	 * e31, e12) of numBodies attitudes, and the rateBegs (rateEnds)
+	 * arrays are the three bivector components of the rates at start
+	 * (end) of the step. Each attitude is updated as with advanced().
+	 */
+	inline
+	void
+	advance
+		( std::size_t const & numBodies
+		, std::array<double *, 4u> const & spinComps
+		, std::array<double const *, 3u> const & rateBegs
+		, std::array<double const *, 3u> const & rateEnds
+		, double const & dt
+		, IntegControl const & ctl = {}
+		, std::size_t const & numThreads = 1u
+		)
+	{
+		priv::parallelFor
+			( numBodies
+			, [&spinComps, &rateBegs, &rateEnds, &dt, &ctl]
+				(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+				{
+					double * const s0{ spinComps[0] };
+					double * const s1{ spinComps[1] };
+					double * const s2{ spinComps[2] };
+					double * const s3{ spinComps[3] };
+					std::array<double const *, 3u> const & wb = rateBegs;
+					std::array<double const *, 3u> const & we = rateEnds;
+					for (std::size_t nn{ndxBeg} ; nn < ndxEnd ; ++nn)
+					{
+						Spinor const spin{ s0[nn], s1[nn], s2[nn], s3[nn] };
+						BiVector const rateBeg
+							{ wb[0][nn], wb[1][nn], wb[2][nn] };
+						BiVector const rateEnd
+							{ we[0][nn], we[1][nn], we[2][nn] };
+						Spinor const next
+							{ advanced(spin, rateBeg, rateEnd, dt, ctl) };
+						s0[nn] = next.theSca.theData[0];
+						s1[nn] = next.theBiv.theData[0];
+						s2[nn] = next.theBiv.theData[1];
+						s3[nn] = next.theBiv.theData[2];
+					}
+				}
+			, numThreads
+			, priv::sAttMinPerThread
+			);
+	}
+
+	//! Scale (in place) attitudes stored as component arrays to unit size
+	inline
+	void
+	renormalize
+		( std::size_t const & numBodies
+		, std::array<double *, 4u> const & spinComps
+		, std::size_t const & numThreads = 1u
+		)
+	{
+		priv::parallelFor
+			( numBodies
+			, [&spinComps]
+				(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+				{
+					double * const s0{ spinComps[0] };
+					double * const s1{ spinComps[1] };
+					double * const s2{ spinComps[2] };
+					double * const s3{ spinComps[3] };
+					for (std::size_t nn{ndxBeg} ; nn < ndxEnd ; ++nn)
+					{
+						double const magSq
+							{ s0[nn]*s0[nn] + s1[nn]*s1[nn]
+							+ s2[nn]*s2[nn] + s3[nn]*s3[nn]
+							};
+						double const scl{ 1. / std::sqrt(magSq) };
+						s0[nn] *= scl;
+						s1[nn] *= scl;
+						s2[nn] *= scl;
+						s3[nn] *= scl;
+					}
+				}
+			, numThreads
+			, priv::sAttMinPerThread
+			);
+	}
+
+} // [batch]
+
+	/*! \brief Repeated batch integration with periodic renormalization.
+	 *
+	 * Each call to step() performs batch::advance() and, every
+	 * theRenormInterval steps, batch::renormalize(). An interval of
+	 * zero disables renormalization.
+	 */
+	struct AttitudeStepper
+	{
+		//! Integration parameters
+		IntegControl theCtl{};
+
+		//! Number of steps between renormalizations (0 for none)
+		std::size_t theRenormInterval{ 16u };
+
+		//! Number of steps performed so far
+		std::size_t theNumSteps{ 0u };
+
+		//! Advance (in place) attitudes (ref batch::advance())
+		inline
+		void
+		step
+			( std::size_t const & numBodies
+			, std::array<double *, 4u> const & spinComps
+			, std::array<double const *, 3u> const & rateBegs
+			, std::array<double const *, 3u> const & rateEnds
+			, double const & dt
+			, std::size_t const & numThreads = 1u
+			)
+		{
+			batch::advance
+				( numBodies, spinComps, rateBegs, rateEnds
+				, dt, theCtl, numThreads
+				);
+			++theNumSteps;
+			if ((0u < theRenormInterval)
+				&& (0u == (theNumSteps % theRenormInterval)))
+			{
+				batch::renormalize(numBodies, spinComps, numThreads);
+			}
+		}
+	};
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3attint_INCL_
@@ -0,0 +1,419 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef engabra_g3batch_INCL_
+#define engabra_g3batch_INCL_
+
+/*! \file
+\brief Batch (many-item) evaluation of g3func.hpp functions.
+
+\b Overview
+
+The functions in this header evaluate one of the g3func.hpp functions
+for each item in a range of input values and write the results to an
+output range. The calling conventions follow those of std::transform(),
+i.e. an input range, [itBeg,itEnd), and an output iterator, itOut, to
+which results are assigned. The return value is the output iterator
+advanced past the last value written.
+
+All functions are contained in the engabra::g3::batch sub namespace
+(e.g. batch::log() versus the individual item g3::log()).
+
+The batch functions produce exactly the same results (including null
+values for invalid inputs) as do the individual item functions. The
+loops are simple so that compilers can inline the per-item function
+bodies over contiguous arrays (e.g. std::vector).
+
+Example:
+\snippet test_g3func_log.cpp DoxyExampleBatch
+
+*/
+
+
+#include "g3func.hpp"
+#include "g3type.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+//! Functions that evaluate g3func.hpp functions for ranges of items.
+namespace batch
+{
+	//
+	// Magnitudes and Directions
+	//
+
+	//! Magnitude (ref g3::magnitude()) of each item in range.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	magnitude
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (auto const & item) { return std::sqrt(g3::magSq(item)); }
+			);
+	}
+
+	/*! \brief Unitary direction (ref g3::direction()) of each item in range.
+	 *
+	 * Each item requires a single square root and reciprocal (which is
+	 * then applied to all components). Items with too small a magnitude
+	 * produce null results (as for g3::direction()).
+	 */
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	direction
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (auto const & item)
+				{
+					double const mag{ std::sqrt(g3::magSq(item)) };
+					return priv::invMagOrNaN(mag) * item;
+				}
+			);
+	}
+
+	/*! \brief Magnitude and direction (ref g3::pairMagDirFrom()) of items.
+	 *
+	 * The magnitudes are written to itMag and the directions to itDir.
+	 * The return value contains both output iterators advanced past
+	 * the last values written.
+	 */
+	template <typename InIter, typename OutIterMag, typename OutIterDir>
+	inline
+	std::pair<OutIterMag, OutIterDir>
+	pairMagDirFrom
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIterMag itMag
+		, OutIterDir itDir
+		)
+	{
+		for (InIter itIn{ itBeg } ; itEnd != itIn ; ++itIn)
+		{
+			double const mag{ std::sqrt(g3::magSq(*itIn)) };
+			*itMag++ = mag;
+			*itDir++ = priv::invMagOrNaN(mag) * (*itIn);
+		}
+		return { itMag, itDir };
+	}
+
+	//
+	// Logarithms
+	//
+
+	//! Principal logarithm (ref g3::log()) of each MultiVector in range.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	log
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (MultiVector const & mv) { return g3::log(mv); }
+			);
+	}
+
+	//
+	// Roots
+	//
+
+	//! Principal square root (ref g3::sqrt()) of each MultiVector in range.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	sqrt
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (MultiVector const & mv) { return g3::sqrt(mv); }
+			);
+	}
+
+	//
+	// Inverses
+	//
+
+	//! Algebraic inverse (ref g3::inverse()) of each item in range.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	inverse
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		using Type = typename std::iterator_traits<InIter>::value_type;
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (Type const & item) { return g3::inverse<Type>(item); }
+			);
+	}
+
+	/*! \brief MultiVector inverses along with validity mask values.
+	 *
+	 * For each input item, the inverse is written to itOut and a (bool)
+	 * flag is written to itMask. The flag is true if the inverse exists
+	 * and false if not (in which case the inverse value is null). The
+	 * per-item evaluation is branch free (ref priv::pairInvOkayFrom()).
+	 */
+	template <typename InIter, typename OutIter, typename MaskIter>
+	inline
+	std::pair<OutIter, MaskIter>
+	inverse
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		, MaskIter itMask
+		)
+	{
+		for (InIter itIn{ itBeg } ; itEnd != itIn ; ++itIn)
+		{
+			std::pair<MultiVector, bool> const invOkay
+				{ priv::pairInvOkayFrom(*itIn) };
+			*itOut++ = invOkay.first;
+			*itMask++ = invOkay.second;
+		}
+		return { itOut, itMask };
+	}
+
+	//
+	// Powers
+	//
+
+	/*! \brief Spinor raised to each power in range of exponents.
+	 *
+	 * The polar decomposition of spin is evaluated only once, so that
+	 * each output value requires only a single exp() and (except for
+	 * small angles) a single sin()/cos() pair (ref g3::pow()).
+	 */
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	pow
+		( Spinor const & spin
+		, InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		, BiVector const & bivDirForImaginary = e23
+		)
+	{
+		if (isValid(spin))
+		{
+			priv::SpinPolar const polar
+				{ priv::SpinPolar::from(spin, bivDirForImaginary) };
+			itOut = std::transform
+				( itBeg, itEnd, itOut
+				, [& polar] (double const & expo)
+					{
+						Spinor result{ null<Spinor>() };
+						if (isValid(expo))
+						{
+							result = polar.pow(expo);
+						}
+						return result;
+					}
+				);
+		}
+		else
+		{
+			itOut = std::fill_n
+				(itOut, std::distance(itBeg, itEnd), null<Spinor>());
+		}
+		return itOut;
+	}
+
+	//! MultiVector raised to each (integer) power in range of exponents.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	pow
+		( MultiVector const & mv
+		, InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [& mv] (int const & expo) { return g3::pow(mv, expo); }
+			);
+	}
+
+	//
+	// Circular and Hyperbolic
+	//
+
+	/*! \brief Simultaneous circular sine and cosine (ref g3::sincos()) of each item in range.
+	 *
+	 * The sin() values are written to itSin and the cos() values to
+	 * itCos. The return value contains both output iterators advanced
+	 * past the last values written.
+	 */
+	template <typename InIter, typename OutIterSin, typename OutIterCos>
+	inline
+	std::pair<OutIterSin, OutIterCos>
+	sincos
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIterSin itSin
+		, OutIterCos itCos
+		)
+	{
+		for (InIter itIn{ itBeg } ; itEnd != itIn ; ++itIn)
+		{
+			auto const values{ g3::sincos(*itIn) };
+			*itSin++ = values.first;
+			*itCos++ = values.second;
+		}
+		return { itSin, itCos };
+	}
+
+	//! Circular sine (ref g3::sin()) of each item in range.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	sin
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (auto const & item) { return g3::sin(item); }
+			);
+	}
+
+	//! Circular cosine (ref g3::cos()) of each item in range.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	cos
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (auto const & item) { return g3::cos(item); }
+			);
+	}
+
+	/*! \brief Simultaneous hyperbolic sine and cosine (ref g3::sinhcosh()) of each item in range.
+	 *
+	 * The sinh() values are written to itSinh and the cosh() values to
+	 * itCosh. The return value contains both output iterators advanced
+	 * past the last values written.
+	 */
+	template <typename InIter, typename OutIterSinh, typename OutIterCosh>
+	inline
+	std::pair<OutIterSinh, OutIterCosh>
+	sinhcosh
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIterSinh itSinh
+		, OutIterCosh itCosh
+		)
+	{
+		for (InIter itIn{ itBeg } ; itEnd != itIn ; ++itIn)
+		{
+			auto const values{ g3::sinhcosh(*itIn) };
+			*itSinh++ = values.first;
+			*itCosh++ = values.second;
+		}
+		return { itSinh, itCosh };
+	}
+
+	//! Hyperbolic sine (ref g3::sinh()) of each item in range.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	sinh
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (auto const & item) { return g3::sinh(item); }
+			);
+	}
+
+	//! Hyperbolic cosine (ref g3::cosh()) of each item in range.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	cosh
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (auto const & item) { return g3::cosh(item); }
+			);
+	}
+
+} // [batch]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3batch_INCL_
@@ -0,0 +1,371 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3camera_INCL_
+#define engabra_g3camera_INCL_
+
+/*! \file
+\brief Photogrammetric (pinhole) projection through Spinor attitude cameras.
+
+\b Overview
+
+A Camera has an attitude spinor, S, projection center location, C, and
+principal distance, f. A world point, X, has camera frame coordinates
+
+	\f$ p = S (X - C) \tilde{S} = (u, v, w) \f$
+
+The camera looks along its -e3 direction such that image coordinates
+are the (collinearity condition) ratios
+
+	\f$ x = -f u / w, \qquad y = -f v / w \f$
+
+Points that are not in front of the camera (w >= 0) produce null image
+coordinates.
+
+Jacobians (ref projectJac()) are with respect to:
+\arg Attitude - bivector, B, of a small left perturbation of the
+attitude, S -> exp(B)*S (i.e. rotation in the camera frame).
+\arg Location - the projection center components, C. The Jacobian with
+respect to the world point, X, is the negative of this.
+
+Example:
+\snippet test_g3camera_all.cpp DoxyExample01
+
+Batch functions project point arrays stored as separate component
+arrays (SoA). Camera attitudes are converted to rotation matrices once
+per camera (ref g3rotmat.hpp) such that each projection requires only
+a matrix product and a division. The batch functions optionally split
+the work across threads (ref g3_parallel.hpp).
+
+Example:
+\snippet test_g3camera_all.cpp DoxyExampleBatch
+
+*/
+
+
+#include "g3_parallel.hpp"
+#include "g3const.hpp"
+#include "g3rotmat.hpp"
+#include "g3type.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+	//! Pinhole camera with Spinor attitude.
+	struct Camera
+	{
+		Spinor theAtt; //!< Attitude: rotation from world into camera frame
+		Vector theLoc; //!< Projection center location (world frame)
+		double thePD; //!< Principal distance (image coordinate units)
+	};
+
+	//! Image coordinates (x, y)
+	using ImgPnt = std::array<double, 2u>;
+
+	//! Image coordinates and Jacobians (ref projectJac())
+	struct ImgJac
+	{
+		//! Image coordinates (x, y)
+		ImgPnt theImg;
+
+		//! Partials of (x,y) w.r.t. attitude bivector (2x3 row major)
+		std::array<double, 6u> theJacAtt;
+
+		//! Partials of (x,y) w.r.t. camera location (2x3 row major)
+		std::array<double, 6u> theJacLoc;
+	};
+
+namespace priv
+{
+	//! Camera with attitude expressed as rotation matrix.
+	struct CameraMat
+	{
+		RotMatrix theMat; //!< Rotation from world into camera frame
+		std::array<double, 3u> theLoc; //!< Projection center location
+		double thePD; //!< Principal distance
+
+		//! Matrix form of camera (with normalized attitude)
+		inline
+		static
+		CameraMat
+		from
+			( Camera const & camera
+			)
+		{
+			return CameraMat
+				{ matrixFrom(camera.theAtt)
+				, camera.theLoc.theData
+				, camera.thePD
+				};
+		}
+
+		//! Camera frame coordinates of world point (X1, X2, X3)
+		inline
+		std::array<double, 3u>
+		cameraFrame
+			( double const & xx1
+			, double const & xx2
+			, double const & xx3
+			) const
+		{
+			double const d1{ xx1 - theLoc[0] };
+			double const d2{ xx2 - theLoc[1] };
+			double const d3{ xx3 - theLoc[2] };
+			return std::array<double, 3u>
+				{ theMat[0]*d1 + theMat[1]*d2 + theMat[2]*d3
+				, theMat[3]*d1 + theMat[4]*d2 + theMat[5]*d3
+				, theMat[6]*d1 + theMat[7]*d2 + theMat[8]*d3
+				};
+		}
+
+		//! Image coordinates of world point (X1, X2, X3)
+		inline
+		ImgPnt
+		project
+			( double const & xx1
+			, double const & xx2
+			, double const & xx3
+			) const
+		{
+			std::array<double, 3u> const pp{ cameraFrame(xx1, xx2, xx3) };
+			double const scl{ (pp[2] < 0.) ? (-thePD / pp[2]) : nan };
+			return ImgPnt{ scl * pp[0], scl * pp[1] };
+		}
+
+		//! Image coordinates and Jacobians of world point (X1, X2, X3)
+		inline
+		ImgJac
+		projectJac
+			( double const & xx1
+			, double const & xx2
+			, double const & xx3
+			) const
+		{
+			std::array<double, 3u> const pp{ cameraFrame(xx1, xx2, xx3) };
+			double const & uu = pp[0];
+			double const & vv = pp[1];
+			double const & ww = pp[2];
+			double const scl{ (ww < 0.) ? (-thePD / ww) : nan };
+			ImgPnt const img{ scl * uu, scl * vv };
+
+			// partials of image w.r.t. camera frame point: dd (2x3)
+			double const invW{ 1. / ww };
+			std::array<double, 6u> const dd
+				{ scl, 0., -img[0] * invW
+				, 0., scl, -img[1] * invW
+				};
+
+			// attitude: dp = 2 * (p cross dB)
+			// i.e. dp/dB = 2 * [[0,-w,v],[w,0,-u],[-v,u,0]]
+			std::array<double, 6u> jacAtt;
+			for (std::size_t row{0u} ; row < 2u ; ++row)
+			{
+				double const & d0 = dd[3u*row    ];
+				double const & d1 = dd[3u*row + 1u];
+				double const & d2 = dd[3u*row + 2u];
+				jacAtt[3u*row    ] = 2. * ( d1*ww - d2*vv);
+				jacAtt[3u*row + 1u] = 2. * (-d0*ww + d2*uu);
+				jacAtt[3u*row + 2u] = 2. * ( d0*vv - d1*uu);
+			}
+
+			// location: dp/dC = -M
+			std::array<double, 6u> jacLoc;
+			for (std::size_t row{0u} ; row < 2u ; ++row)
+			{
+				for (std::size_t col{0u} ; col < 3u ; ++col)
+				{
+					jacLoc[3u*row + col]
+						= -( dd[3u*row    ] * theMat[col]
+						   + dd[3u*row + 1u] * theMat[3u + col]
+						   + dd[3u*row + 2u] * theMat[6u + col]
+						   );
+				}
+			}
+
+			return ImgJac{ img, jacAtt, jacLoc };
+		}
+	};
+
+} // [priv]
+
+	//! Image coordinates of world point (null if not in front of camera).
+	inline
+	ImgPnt
+	project
+		( Camera const & camera
+		, Vector const & pnt
+		)
+	{
+		std::array<double, 3u> const & xx = pnt.theData;
+		return priv::CameraMat::from(camera).project(xx[0], xx[1], xx[2]);
+	}
+
+	//! Image coordinates and Jacobians (ref file description).
+	inline
+	ImgJac
+	projectJac
+		( Camera const & camera
+		, Vector const & pnt
+		)
+	{
+		std::array<double, 3u> const & xx = pnt.theData;
+		return priv::CameraMat::from(camera).projectJac(xx[0], xx[1], xx[2]);
+	}
+
+
+namespace batch
+{
+	/*! \brief Project numPnts points (SoA) through a single camera.
+	 *
+	 * The pntXYZs arrays are the point components and the image
+	 * coordinates are written to outXYs arrays (x and y values).
+	 */
+	inline
+	void
+	project
+		( Camera const & camera
+		, std::size_t const & numPnts
+		, std::array<double const *, 3u> const & pntXYZs
+		, std::array<double *, 2u> const & outXYs
+		, std::size_t const & numThreads = 1u
+		)
+	{
+		priv::CameraMat const camMat{ priv::CameraMat::from(camera) };
+		priv::parallelFor
+			( numPnts
+			, [&camMat, &pntXYZs, &outXYs]
+				(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+				{
+					double const * const inX{ pntXYZs[0] };
+					double const * const inY{ pntXYZs[1] };
+					double const * const inZ{ pntXYZs[2] };
+					double * const outX{ outXYs[0] };
+					double * const outY{ outXYs[1] };
+					for (std::size_t nn{ndxBeg} ; nn < ndxEnd ; ++nn)
+					{
+						ImgPnt const img
+							{ camMat.project(inX[nn], inY[nn], inZ[nn]) };
+						outX[nn] = img[0];
+						outY[nn] = img[1];
+					}
+				}
+			, numThreads
+			);
+	}
+
+	/*! \brief Project observations (camera and point index pairs).
+	 *
+	 * Each of numObs observations projects point pntXYZs[*][ndxPnts[nn]]
+	 * through camera cameras[ndxCams[nn]] with image coordinates
+	 * written to outXYs[*][nn].
+	 *
+	 * If outJacs is not null, it must provide space for 12 values per
+	 * observation: the 2x3 theJacAtt values followed by the 2x3
+	 * theJacLoc values (ref ImgJac).
+	 */
+	inline
+	void
+	project
+		( std::vector<Camera> const & cameras
+		, std::array<double const *, 3u> const & pntXYZs
+		, std::size_t const & numObs
+		, std::size_t const * const & ndxCams
+		, std::size_t const * const & ndxPnts
+		, std::array<double *, 2u> const & outXYs
+		, double * const & outJacs = nullptr
+		, std::size_t const & numThreads = 1u
+		)
+	{
+		std::vector<priv::CameraMat> camMats;
+		camMats.reserve(cameras.size());
+		for (Camera const & camera : cameras)
+		{
+			camMats.emplace_back(priv::CameraMat::from(camera));
+		}
+		priv::parallelFor
+			( numObs
+			, [&camMats, &pntXYZs, &ndxCams, &ndxPnts, &outXYs, &outJacs]
+				(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+				{
+					double const * const inX{ pntXYZs[0] };
+					double const * const inY{ pntXYZs[1] };
+					double const * const inZ{ pntXYZs[2] };
+					double * const outX{ outXYs[0] };
+					double * const outY{ outXYs[1] };
+					for (std::size_t nn{ndxBeg} ; nn < ndxEnd ; ++nn)
+					{
+						priv::CameraMat const & camMat = camMats[ndxCams[nn]];
+						std::size_t const & np = ndxPnts[nn];
+						if (outJacs)
+						{
+							ImgJac const imgJac
+								{ camMat.projectJac
+									(inX[np], inY[np], inZ[np])
+								};
+							outX[nn] = imgJac.theImg[0];
+							outY[nn] = imgJac.theImg[1];
+							double * const outJac{ outJacs + 12u*nn };
+							std::copy
+								( imgJac.theJacAtt.cbegin()
+								, imgJac.theJacAtt.cend()
+								, outJac
+								);
+							std::copy
+								( imgJac.theJacLoc.cbegin()
+								, imgJac.theJacLoc.cend()
+								, outJac + 6u
+								);
+						}
+						else
+						{
+							ImgPnt const img
+								{ camMat.project(inX[np], inY[np], inZ[np]) };
+							outX[nn] = img[0];
+							outY[nn] = img[1];
+						}
+					}
+				}
+			, numThreads
+			);
+	}
+
+} // [batch]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3camera_INCL_
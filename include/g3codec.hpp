@@ -0,0 +1,719 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3codec_INCL_
+#define engabra_g3codec_INCL_
+
+/*! \file
+\brief Compact (quantized) integer codes for unitary g3 entities.
+
+\b Overview
+
+Unitary spinors (attitudes) have only three degrees of freedom but are
+stored as four doubles (32 bytes). The functions here encode unitary
+spinors into 48-bit or 64-bit integer codes (6 or 8 bytes) with the
+"smallest three" method:
+
+\arg The largest magnitude component (of four) is omitted and its
+index stored in 2 bits. The spinor is negated if needed such that the
+omitted component is positive (S and -S represent the same rotation).
+
+\arg The remaining three components are each within the range
+[-1/sqrt(2), 1/sqrt(2)] and are quantized uniformly into 15 bits (for
+48-bit codes) or 20 bits (for 64-bit codes).
+
+\arg Decoding recovers the omitted component from the unit magnitude
+condition.
+
+The maximum rotation angle error (radians) of the decoded attitude is
+provided by codec::maxSpinAngleError() and is approximately 1.5e-4
+(48-bit) and 4.7e-6 (64-bit). Null (or zero) spinors are encoded with
+a reserved code value, codec::nullCode(), that decodes to a null
+spinor.
+
+Example:
+\snippet test_g3codec_all.cpp DoxyExample01
+
+\b Directions
+
+Unitary Vector directions (and unitary BiVector plane directions, via
+their components) are encoded into 32-bit or 48-bit codes with the
+octahedral mapping:
+
+\arg The direction is projected onto the octahedron |x|+|y|+|z|=1.
+The lower (z<0) half is folded outward over the upper half such that
+the octahedron maps onto the square [-1,1]x[-1,1].
+
+\arg The two square coordinates are quantized uniformly into 16 bits
+(32-bit codes) or 24 bits (48-bit codes) each.
+
+The maximum angle error (radians) is codec::maxDirAngleError() and is
+approximately 6.5e-5 (32-bit) and 2.6e-7 (48-bit).
+
+Example:
+\snippet test_g3codec_all.cpp DoxyExample02
+
+Batch encoding/decoding functions are in codec::batch. Code values
+can be written/read to/from streams with io::putCodes(), io::getCodes()
+(binary, little endian, NumBits/8 bytes each) and io::hexFrom(),
+io::codeFromHex() (fixed width hexadecimal text).
+
+*/
+
+
+#include "g3_parallel.hpp"
+#include "g3const.hpp"
+#include "g3func.hpp"
+#include "g3traits.hpp"
+#include "g3type.hpp"
+#include "g3validity.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+//! Compact integer codes for unitary entities
+namespace codec
+{
+	//! Storage type for all code values (upper bits unused for short codes)
+	using Code = std::uint64_t;
+
+	//! Reserved code value (all NumBits set) representing null entities
+	template <std::size_t NumBits>
+	inline
+	constexpr
+	Code
+	nullCode
+		()
+	{
+		static_assert((0u < NumBits) && (NumBits <= 64u), "Invalid NumBits");
+		return (~Code{ 0u }) >> (64u - NumBits);
+	}
+
+namespace priv
+{
+	//! Number of bits used for each of three spinor components
+	template <std::size_t NumBits>
+	constexpr std::size_t sSpinCompBits{ (NumBits - 2u) / 3u };
+
+	//! Largest quantized value for NumCompBits
+	template <std::size_t NumCompBits>
+	constexpr Code sMaxQuant{ (Code{ 1u } << NumCompBits) - 1u };
+
+	//! Quantized integer for value in range [-range, range]
+	template <std::size_t NumCompBits>
+	inline
+	Code
+	quantized
+		( double const & value
+		, double const & range
+		)
+	{
+		constexpr double maxQ{ static_cast<double>(sMaxQuant<NumCompBits>) };
+		double const frac{ .5 * (value / range + 1.) };
+		double const qnt{ std::round(frac * maxQ) };
+		return static_cast<Code>(std::min(maxQ, std::max(0., qnt)));
+	}
+
+	//! Value in range [-range, range] from quantized integer
+	template <std::size_t NumCompBits>
+	inline
+	double
+	dequantized
+		( Code const & qnt
+		, double const & range
+		)
+	{
+		constexpr double maxQ{ static_cast<double>(sMaxQuant<NumCompBits>) };
+		return range * (2. * (static_cast<double>(qnt) / maxQ) - 1.);
+	}
+
+	//! Range of the three smaller components of a unit spinor
+	constexpr double sSpinRange{ 0.70710678118654752440 }; // 1/sqrt(2)
+
+} // [priv]
+
+	/*! \brief Maximum rotation angle error (radians) of spinor codes.
+	 *
+	 * With quantization step, dq, each of three components has error
+	 * at most dq/2. Since the omitted component is at least 1/2, the
+	 * reconstructed spinor differs (as a 4D unit vector) by less than
+	 * sqrt(3)*dq, corresponding to a rotation angle error less than
+	 * 2*sqrt(3)*dq.
+	 */
+	template <std::size_t NumBits>
+	inline
+	constexpr
+	double
+	maxSpinAngleError
+		()
+	{
+		constexpr std::size_t numCompBits{ priv::sSpinCompBits<NumBits> };
+		constexpr double maxQ
+			{ static_cast<double>(priv::sMaxQuant<numCompBits>) };
+		constexpr double stepQ{ 2. * priv::sSpinRange / maxQ };
+		return 2. * 1.7320508075688772935 * stepQ;
+	}
+
+	/*! \brief Code (NumBits = 48 or 64) for rotation represented by spin.
+	 *
+	 * The spin is normalized before encoding (only its direction is
+	 * encoded). The nullCode() is returned for null or zero spinors.
+	 */
+	template <std::size_t NumBits>
+	inline
+	Code
+	encodedSpin
+		( Spinor const & spin
+		)
+	{
+		static_assert
+			((48u == NumBits) || (64u == NumBits), "NumBits must be 48 or 64");
+		constexpr std::size_t numCompBits{ priv::sSpinCompBits<NumBits> };
+
+		Code code{ nullCode<NumBits>() };
+		double const mag{ magnitude(spin) };
+		if (isValid(spin) && (0. < mag))
+		{
+			std::array<double, 4u> const comps
+				{ spin[0], spin[1], spin[2], spin[3] };
+			std::size_t ndxMax{ 0u };
+			for (std::size_t nn{1u} ; nn < 4u ; ++nn)
+			{
+				if (std::abs(comps[ndxMax]) < std::abs(comps[nn]))
+				{
+					ndxMax = nn;
+				}
+			}
+			double const scl{ ((comps[ndxMax] < 0.) ? -1. : 1.) / mag };
+			code = static_cast<Code>(ndxMax);
+			for (std::size_t nn{0u} ; nn < 4u ; ++nn)
+			{
+				if (ndxMax != nn)
+				{
+					code = (code << numCompBits)
+						| priv::quantized<numCompBits>
+							(scl * comps[nn], priv::sSpinRange);
+				}
+			}
+		}
+		return code;
+	}
+
+	//! Unitary spinor (or null) decoded from encodedSpin() code value.
+	template <std::size_t NumBits>
+	inline
+	Spinor
+	decodedSpin
+		( Code const & code
+		)
+	{
+		static_assert
+			((48u == NumBits) || (64u == NumBits), "NumBits must be 48 or 64");
+		constexpr std::size_t numCompBits{ priv::sSpinCompBits<NumBits> };
+		constexpr Code mask{ priv::sMaxQuant<numCompBits> };
+
+		Spinor spin{ null<Spinor>() };
+		if (nullCode<NumBits>() != code)
+		{
+			std::size_t const ndxMax
+				{ static_cast<std::size_t>((code >> (3u * numCompBits)) & 3u) };
+			std::array<double, 4u> comps;
+			double sumSq{ 0. };
+			std::size_t shift{ 3u * numCompBits };
+			for (std::size_t nn{0u} ; nn < 4u ; ++nn)
+			{
+				if (ndxMax != nn)
+				{
+					shift -= numCompBits;
+					comps[nn] = priv::dequantized<numCompBits>
+						((code >> shift) & mask, priv::sSpinRange);
+					sumSq += comps[nn] * comps[nn];
+				}
+			}
+			comps[ndxMax] = std::sqrt(std::max(0., 1. - sumSq));
+			spin = Spinor{ comps[0], comps[1], comps[2], comps[3] };
+			spin = (1. / magnitude(spin)) * spin;
+		}
+		return spin;
+	}
+
+	//
+	// Directions
+	//
+
+namespace priv
+{
+	//! Number of bits used for each of two octahedral coordinates
+	template <std::size_t NumBits>
+	constexpr std::size_t sDirCompBits{ NumBits / 2u };
+
+	//! Sign of value with zero treated as positive
+	inline
+	double
+	signOf
+		( double const & value
+		)
+	{
+		return (value < 0.) ? -1. : 1.;
+	}
+
+	//! Code for the three components of a direction.
+	template <std::size_t NumBits>
+	inline
+	Code
+	encodedComps
+		( std::array<double, 3u> const & comps
+		)
+	{
+		static_assert
+			((32u == NumBits) || (48u == NumBits), "NumBits must be 32 or 48");
+		constexpr std::size_t numCompBits{ sDirCompBits<NumBits> };
+		constexpr Code maxQ{ sMaxQuant<numCompBits> };
+
+		Code code{ nullCode<NumBits>() };
+		double const sumAbs
+			{ std::abs(comps[0]) + std::abs(comps[1]) + std::abs(comps[2]) };
+		if (0. < sumAbs) // false also for NaN
+		{
+			double uu{ comps[0] / sumAbs };
+			double vv{ comps[1] / sumAbs };
+			if (comps[2] < 0.)
+			{
+				double const uTmp{ (1. - std::abs(vv)) * signOf(uu) };
+				vv = (1. - std::abs(uu)) * signOf(vv);
+				uu = uTmp;
+			}
+			Code const qu{ quantized<numCompBits>(uu, 1.) };
+			Code qv{ quantized<numCompBits>(vv, 1.) };
+			if ((maxQ == qu) && (maxQ == qv))
+			{
+				// corner (1,1) is reserved for nullCode(). The (equivalent)
+				// corner (1,-1) also represents direction -e3.
+				qv = 0u;
+			}
+			code = (qu << numCompBits) | qv;
+		}
+		return code;
+	}
+
+	//! Unit components decoded from encodedComps() (NaN for null code)
+	template <std::size_t NumBits>
+	inline
+	std::array<double, 3u>
+	decodedComps
+		( Code const & code
+		)
+	{
+		static_assert
+			((32u == NumBits) || (48u == NumBits), "NumBits must be 32 or 48");
+		constexpr std::size_t numCompBits{ sDirCompBits<NumBits> };
+		constexpr Code mask{ sMaxQuant<numCompBits> };
+
+		std::array<double, 3u> comps{ g3::nan, g3::nan, g3::nan };
+		if (nullCode<NumBits>() != code)
+		{
+			double uu{ dequantized<numCompBits>(code >> numCompBits, 1.) };
+			double vv{ dequantized<numCompBits>(code & mask, 1.) };
+			double const zz{ 1. - std::abs(uu) - std::abs(vv) };
+			if (zz < 0.)
+			{
+				double const uTmp{ (1. - std::abs(vv)) * signOf(uu) };
+				vv = (1. - std::abs(uu)) * signOf(vv);
+				uu = uTmp;
+			}
+			double const scl{ 1. / std::sqrt(uu*uu + vv*vv + zz*zz) };
+			comps = { scl * uu, scl * vv, scl * zz };
+		}
+		return comps;
+	}
+
+} // [priv]
+
+	/*! \brief Maximum angle error (radians) of direction codes.
+	 *
+	 * With quantization step, dq, each octahedral coordinate has error
+	 * at most dq/2 such that the point on the octahedron moves by at most
+	 * sqrt(3/2)*dq. Since the octahedron is at least 1/sqrt(3) from the
+	 * origin, the direction error is less than (3/sqrt(2))*dq.
+	 */
+	template <std::size_t NumBits>
+	inline
+	constexpr
+	double
+	maxDirAngleError
+		()
+	{
+		constexpr std::size_t numCompBits{ priv::sDirCompBits<NumBits> };
+		constexpr double maxQ
+			{ static_cast<double>(priv::sMaxQuant<numCompBits>) };
+		constexpr double stepQ{ 2. / maxQ };
+		return 2.1213203435596425732 * stepQ;
+	}
+
+	/*! \brief Code (NumBits = 32 or 48) for direction of item.
+	 *
+	 * The item may be a Vector or a BiVector. It need not be unitary
+	 * (only its direction is encoded). The nullCode() is returned for
+	 * null or zero items.
+	 */
+	template
+		< std::size_t NumBits
+		, typename Type
+		, std::enable_if_t
+			< is::Vector<Type>::value || is::BiVector<Type>::value
+			, bool
+			> = true
+		>
+	inline
+	Code
+	encodedDir
+		( Type const & item
+		)
+	{
+		return priv::encodedComps<NumBits>(item.theData);
+	}
+
+	//! Unitary Vector or BiVector (or null) decoded from encodedDir() code.
+	template
+		< std::size_t NumBits
+		, typename Type
+		, std::enable_if_t
+			< is::Vector<Type>::value || is::BiVector<Type>::value
+			, bool
+			> = true
+		>
+	inline
+	Type
+	decodedDir
+		( Code const & code
+		)
+	{
+		std::array<double, 3u> const comps
+			{ priv::decodedComps<NumBits>(code) };
+		return Type{ comps[0], comps[1], comps[2] };
+	}
+
+namespace batch
+{
+	//! Codes (ref codec::encodedSpin()) for each spinor in range.
+	template <std::size_t NumBits, typename InIter, typename OutIter>
+	inline
+	OutIter
+	encodeSpins
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (Spinor const & spin) { return encodedSpin<NumBits>(spin); }
+			);
+	}
+
+	//! Spinors (ref codec::decodedSpin()) for each code in range.
+	template <std::size_t NumBits, typename InIter, typename OutIter>
+	inline
+	OutIter
+	decodeSpins
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (Code const & code) { return decodedSpin<NumBits>(code); }
+			);
+	}
+
+	//! Concurrent batch::encodeSpins() (random access ranges).
+	template <std::size_t NumBits, typename InIter, typename OutIter>
+	inline
+	OutIter
+	encodeSpins
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		, std::size_t const & numThreads
+		)
+	{
+		return g3::priv::parallelTransform
+			( itBeg, itEnd, itOut
+			, [] (Spinor const & spin) { return encodedSpin<NumBits>(spin); }
+			, numThreads
+			);
+	}
+
+	//! Concurrent batch::decodeSpins() (random access ranges).
+	template <std::size_t NumBits, typename InIter, typename OutIter>
+	inline
+	OutIter
+	decodeSpins
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		, std::size_t const & numThreads
+		)
+	{
+		return g3::priv::parallelTransform
+			( itBeg, itEnd, itOut
+			, [] (Code const & code) { return decodedSpin<NumBits>(code); }
+			, numThreads
+			);
+	}
+
+	//! Codes (ref codec::encodedDir()) for each direction in range.
+	template <std::size_t NumBits, typename InIter, typename OutIter>
+	inline
+	OutIter
+	encodeDirs
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (auto const & item) { return encodedDir<NumBits>(item); }
+			);
+	}
+
+	//! Directions (ref codec::decodedDir()) for each code in range.
+	template
+		< std::size_t NumBits
+		, typename Type
+		, typename InIter
+		, typename OutIter
+		>
+	inline
+	OutIter
+	decodeDirs
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (Code const & code) { return decodedDir<NumBits, Type>(code); }
+			);
+	}
+
+	//! Concurrent batch::encodeDirs() (random access ranges).
+	template <std::size_t NumBits, typename InIter, typename OutIter>
+	inline
+	OutIter
+	encodeDirs
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		, std::size_t const & numThreads
+		)
+	{
+		return g3::priv::parallelTransform
+			( itBeg, itEnd, itOut
+			, [] (auto const & item) { return encodedDir<NumBits>(item); }
+			, numThreads
+			);
+	}
+
+	//! Concurrent batch::decodeDirs() (random access ranges).
+	template
+		< std::size_t NumBits
+		, typename Type
+		, typename InIter
+		, typename OutIter
+		>
+	inline
+	OutIter
+	decodeDirs
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		, std::size_t const & numThreads
+		)
+	{
+		return g3::priv::parallelTransform
+			( itBeg, itEnd, itOut
+			, [] (Code const & code) { return decodedDir<NumBits, Type>(code); }
+			, numThreads
+			);
+	}
+
+} // [batch]
+
+} // [codec]
+
+namespace io
+{
+	/*! \brief Write codes to binary stream (NumBits/8 bytes each).
+	 *
+	 * Bytes are written in little endian order independent of platform.
+	 * Returns stream status after writing.
+	 */
+	template <std::size_t NumBits, typename InIter>
+	inline
+	bool
+	putCodes
+		( std::ostream & ostrm
+		, InIter const & itBeg
+		, InIter const & itEnd
+		)
+	{
+		static_assert(0u == (NumBits % 8u), "NumBits must be whole bytes");
+		constexpr std::size_t numBytes{ NumBits / 8u };
+		std::array<char, 8u> bytes;
+		for (InIter iter{ itBeg } ; itEnd != iter ; ++iter)
+		{
+			codec::Code const code{ *iter };
+			for (std::size_t nn{0u} ; nn < numBytes ; ++nn)
+			{
+				bytes[nn] = static_cast<char>((code >> (8u * nn)) & 0xFFu);
+			}
+			ostrm.write(bytes.data(), numBytes);
+		}
+		return (! ostrm.fail());
+	}
+
+	/*! \brief Read up to numCodes codes written by putCodes().
+	 *
+	 * Returns the number of (complete) codes read and assigned to itOut.
+	 */
+	template <std::size_t NumBits, typename OutIter>
+	inline
+	std::size_t
+	getCodes
+		( std::istream & istrm
+		, std::size_t const & numCodes
+		, OutIter itOut
+		)
+	{
+		static_assert(0u == (NumBits % 8u), "NumBits must be whole bytes");
+		constexpr std::size_t numBytes{ NumBits / 8u };
+		std::size_t numGot{ 0u };
+		std::array<char, 8u> bytes;
+		while ((numGot < numCodes) && istrm.read(bytes.data(), numBytes))
+		{
+			codec::Code code{ 0u };
+			for (std::size_t nn{0u} ; nn < numBytes ; ++nn)
+			{
+				codec::Code const byte
+					{ static_cast<unsigned char>(bytes[nn]) };
+				code |= (byte << (8u * nn));
+			}
+			*itOut++ = code;
+			++numGot;
+		}
+		return numGot;
+	}
+
+	//! Fixed width (NumBits/4 digits) hexadecimal text for code
+	template <std::size_t NumBits>
+	inline
+	std::string
+	hexFrom
+		( codec::Code const & code
+		)
+	{
+		static_assert(0u == (NumBits % 4u), "NumBits must be whole digits");
+		constexpr std::size_t numDigits{ NumBits / 4u };
+		constexpr char digits[]{ "0123456789abcdef" };
+		std::string text(numDigits, '0');
+		for (std::size_t nn{0u} ; nn < numDigits ; ++nn)
+		{
+			std::size_t const shift{ 4u * (numDigits - 1u - nn) };
+			text[nn] = digits[(code >> shift) & 0xFu];
+		}
+		return text;
+	}
+
+	/*! \brief Code value from hexFrom() text (or nullCode() if invalid).
+	 *
+	 * Text must contain exactly NumBits/4 hexadecimal digits.
+	 */
+	template <std::size_t NumBits>
+	inline
+	codec::Code
+	codeFromHex
+		( std::string const & text
+		)
+	{
+		constexpr std::size_t numDigits{ NumBits / 4u };
+		codec::Code code{ 0u };
+		bool okay{ numDigits == text.size() };
+		for (std::size_t nn{0u} ; okay && (nn < text.size()) ; ++nn)
+		{
+			char const & dig = text[nn];
+			codec::Code val{ 0u };
+			if (('0' <= dig) && (dig <= '9'))
+			{
+				val = static_cast<codec::Code>(dig - '0');
+			}
+			else
+			if (('a' <= dig) && (dig <= 'f'))
+			{
+				val = static_cast<codec::Code>(10 + (dig - 'a'));
+			}
+			else
+			if (('A' <= dig) && (dig <= 'F'))
+			{
+				val = static_cast<codec::Code>(10 + (dig - 'A'));
+			}
+			else
+			{
+				okay = false;
+			}
+			code = (code << 4u) | val;
+		}
+		if (! okay)
+		{
+			code = codec::nullCode<NumBits>();
+		}
+		return code;
+	}
+
+} // [io]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3codec_INCL_
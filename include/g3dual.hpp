@@ -0,0 +1,1613 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3dual_INCL_
+#define engabra_g3dual_INCL_
+
+/*! \file
+\brief Forward mode automatic differentiation with g3 types.
+
+\b Overview
+
+Provides (in namespace ad) two templates for propagating exact first
+derivatives with respect to a fixed number, N, of parameters:
+
+\arg Dual<N> - a dual-number scalar: a double value together with its
+N partial derivatives.
+
+\arg Jet<Type, N> - a g3 entity (Vector, Spinor, etc.) together with its
+N partial derivatives (each of which is an entity of the same Type).
+
+The g3 types themselves hold double values, therefore derivatives are
+carried alongside the values (rather than as the component type). All
+g3 operators (+, -, *, reverse, dual, ...) propagate through Jet
+instances, and the g3func.hpp functions are provided with their exact
+chain rules:
+\arg magSq(), magnitude(), direction() and inverse() (all types).
+\arg exp() and logG2() for BiVector/Spinor via the analytic Jacobians
+in g3jacobian.hpp, and sqrtG2() and pow(Spinor, double) built on them.
+\arg pow(MultiVector, int) via jet products.
+\arg exp(), log() and sqrt() of MultiVector and the sin(), cos(),
+sinh(), cosh() family (for all g3func.hpp argument types) via the
+ComPlex/DirPlex split (ref priv::splitChained()).
+
+Parameters are introduced with variable() (seeding unit derivatives)
+and constant() (zero derivatives). The derivatives of any result are
+extracted with jacobianOf(). A residual expression is therefore
+evaluated once to obtain both value and full Jacobian.
+
+Example:
+\snippet test_g3dual_all.cpp DoxyExample01
+
+*/
+
+
+#include "g3const.hpp"
+#include "g3func.hpp"
+#include "g3jacobian.hpp"
+#include "g3ops.hpp"
+#include "g3traits.hpp"
+#include "g3type.hpp"
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+//! Forward mode automatic differentiation
+namespace ad
+{
+	//! Scalar value with N partial derivatives
+	template <std::size_t N>
+	struct Dual
+	{
+		double theVal; //!< Function value
+		std::array<double, N> theDer; //!< Partial derivatives
+	};
+
+	//! Entity of g3 Type with N partial derivatives
+	template <typename Type, std::size_t N>
+	struct Jet
+	{
+		Type theVal; //!< Function value
+		std::array<Type, N> theDer; //!< Partial derivatives
+	};
+
+namespace priv
+{
+	//! True for double and for g3 types (which may appear inside a Jet)
+	template <typename Type>
+	struct isEntity : std::integral_constant
+		< bool
+		, std::is_same<Type, double>::value
+		  || g3::is::blade<Type>::value
+		  || g3::is::Spinor<Type>::value
+		  || g3::is::ImSpin<Type>::value
+		  || g3::is::ComPlex<Type>::value
+		  || g3::is::DirPlex<Type>::value
+		  || g3::is::MultiVector<Type>::value
+		>
+	{
+	};
+
+	//! Shorthand for enabling templates only for g3 (or double) types.
+	template <typename TypeA, typename TypeB = double>
+	using EnableIfEntities = std::enable_if_t
+		< isEntity<TypeA>::value && isEntity<TypeB>::value, bool >;
+
+	//! Number of components in a g3 type (all of which are doubles)
+	template <typename Type>
+	constexpr std::size_t sNumComp{ sizeof(Type) / sizeof(double) };
+
+	//! Euclidean (component-wise) inner product
+	template <typename Type>
+	inline
+	double
+	dotComp
+		( Type const & itemA
+		, Type const & itemB
+		)
+	{
+		double sum{ 0. };
+		for (std::size_t nn{0u} ; nn < sNumComp<Type> ; ++nn)
+		{
+			sum += itemA[nn] * itemB[nn];
+		}
+		return sum;
+	}
+
+	//! Unit basis entity for component ndx - for blades
+	template
+		< typename Blade
+		, std::enable_if_t< g3::is::blade<Blade>::value, bool > = true
+		>
+	inline
+	Blade
+	unitComp
+		( std::size_t const & ndx
+		)
+	{
+		Blade item{ zero<Blade>() };
+		item.theData[ndx] = 1.;
+		return item;
+	}
+
+	//! Unit basis entity for component ndx - for Spinor
+	template
+		< typename Type
+		, std::enable_if_t< g3::is::Spinor<Type>::value, bool > = true
+		>
+	inline
+	Spinor
+	unitComp
+		( std::size_t const & ndx
+		)
+	{
+		Spinor item{ zero<Spinor>() };
+		if (ndx < 1u)
+		{
+			item.theSca.theData[0] = 1.;
+		}
+		else
+		{
+			item.theBiv.theData[ndx - 1u] = 1.;
+		}
+		return item;
+	}
+
+	//! Unit basis entity for component ndx - for MultiVector
+	template
+		< typename Type
+		, std::enable_if_t< g3::is::MultiVector<Type>::value, bool > = true
+		>
+	inline
+	MultiVector
+	unitComp
+		( std::size_t const & ndx
+		)
+	{
+		MultiVector item{ zero<MultiVector>() };
+		item[ndx] = 1.;
+		return item;
+	}
+
+	//! Dual number for the scalar part of a Spinor jet
+	template <std::size_t N>
+	inline
+	Dual<N>
+	scalarDualOf
+		( Jet<Spinor, N> const & jet
+		)
+	{
+		Dual<N> result{ jet.theVal.theSca.theData[0], {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk] = jet.theDer[kk].theSca.theData[0];
+		}
+		return result;
+	}
+
+	//! Spinor (Scalar+BiVector) part of a MultiVector
+	template
+		< typename Type
+		, std::enable_if_t< g3::is::Spinor<Type>::value, bool > = true
+		>
+	inline
+	Spinor
+	partOf
+		( MultiVector const & mv
+		)
+	{
+		return Spinor{ mv.theSca.theData[0], mv.theBiv };
+	}
+
+	//! ImSpin (Vector+TriVector) part of a MultiVector
+	template
+		< typename Type
+		, std::enable_if_t< g3::is::ImSpin<Type>::value, bool > = true
+		>
+	inline
+	ImSpin
+	partOf
+		( MultiVector const & mv
+		)
+	{
+		return ImSpin{ mv.theVec, mv.theTri };
+	}
+
+	//! ComPlex (Scalar+TriVector) part of a MultiVector
+	template
+		< typename Type
+		, std::enable_if_t< g3::is::ComPlex<Type>::value, bool > = true
+		>
+	inline
+	ComPlex
+	partOf
+		( MultiVector const & mv
+		)
+	{
+		return ComPlex{ mv.theSca, mv.theTri };
+	}
+
+	//! DirPlex (Vector+BiVector) part of a MultiVector
+	template
+		< typename Type
+		, std::enable_if_t< g3::is::DirPlex<Type>::value, bool > = true
+		>
+	inline
+	DirPlex
+	partOf
+		( MultiVector const & mv
+		)
+	{
+		return DirPlex{ mv.theVec, mv.theBiv };
+	}
+
+	//! All of a MultiVector
+	template
+		< typename Type
+		, std::enable_if_t< g3::is::MultiVector<Type>::value, bool > = true
+		>
+	inline
+	MultiVector
+	partOf
+		( MultiVector const & mv
+		)
+	{
+		return mv;
+	}
+
+} // [priv]
+
+	//
+	// Construction and extraction
+	//
+
+	//! Dual number with zero derivatives
+	template <std::size_t N>
+	inline
+	Dual<N>
+	constant
+		( double const & value
+		)
+	{
+		Dual<N> result{ value, {} };
+		result.theDer.fill(0.);
+		return result;
+	}
+
+	//! Dual number with unit derivative for parameter ndxParm
+	template <std::size_t N>
+	inline
+	Dual<N>
+	variable
+		( double const & value
+		, std::size_t const & ndxParm
+		)
+	{
+		Dual<N> result{ constant<N>(value) };
+		result.theDer[ndxParm] = 1.;
+		return result;
+	}
+
+	//! Jet with zero derivatives
+	template
+		< std::size_t N
+		, typename Type
+		, priv::EnableIfEntities<Type> = true
+		>
+	inline
+	Jet<Type, N>
+	constant
+		( Type const & value
+		)
+	{
+		Jet<Type, N> result{ value, {} };
+		result.theDer.fill(zero<Type>());
+		return result;
+	}
+
+	/*! \brief Jet with components as parameters [ndxBeg, ndxBeg+numComp).
+	 *
+	 * Each of the components of value (e.g. 3 for Vector, 4 for Spinor)
+	 * is associated with a parameter starting at ndxBeg. Available for
+	 * blade, Spinor and MultiVector types.
+	 */
+	template <std::size_t N, typename Type>
+	inline
+	Jet<Type, N>
+	variable
+		( Type const & value
+		, std::size_t const & ndxBeg = 0u
+		)
+	{
+		static_assert
+			( g3::is::blade<Type>::value
+			  || g3::is::Spinor<Type>::value
+			  || g3::is::MultiVector<Type>::value
+			, "variable() is available for blades, Spinor and MultiVector"
+			);
+		Jet<Type, N> result{ constant<N>(value) };
+		for (std::size_t nn{0u} ; nn < priv::sNumComp<Type> ; ++nn)
+		{
+			std::size_t const ndxParm{ ndxBeg + nn };
+			if (ndxParm < N)
+			{
+				result.theDer[ndxParm] = priv::unitComp<Type>(nn);
+			}
+		}
+		return result;
+	}
+
+	//! Partial derivatives (here just a copy of the derivative array)
+	template <std::size_t N>
+	inline
+	std::array<double, N>
+	jacobianOf
+		( Dual<N> const & dual
+		)
+	{
+		return dual.theDer;
+	}
+
+	/*! \brief Jacobian (row major) of jet components w.r.t. parameters.
+	 *
+	 * Element [N*row + col] is the partial derivative of component
+	 * jet.theVal[row] with respect to parameter col.
+	 */
+	template <typename Type, std::size_t N>
+	inline
+	std::array<double, priv::sNumComp<Type> * N>
+	jacobianOf
+		( Jet<Type, N> const & jet
+		)
+	{
+		std::array<double, priv::sNumComp<Type> * N> jac;
+		for (std::size_t row{0u} ; row < priv::sNumComp<Type> ; ++row)
+		{
+			for (std::size_t col{0u} ; col < N ; ++col)
+			{
+				jac[N*row + col] = jet.theDer[col][row];
+			}
+		}
+		return jac;
+	}
+
+	//
+	// Dual arithmetic
+	//
+
+	//! Negation
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator-
+		( Dual<N> const & aa
+		)
+	{
+		Dual<N> result{ -aa.theVal, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk] = -aa.theDer[kk];
+		}
+		return result;
+	}
+
+	//! Sum
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator+
+		( Dual<N> const & aa
+		, Dual<N> const & bb
+		)
+	{
+		Dual<N> result{ aa.theVal + bb.theVal, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk] = aa.theDer[kk] + bb.theDer[kk];
+		}
+		return result;
+	}
+
+	//! Difference
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator-
+		( Dual<N> const & aa
+		, Dual<N> const & bb
+		)
+	{
+		return aa + (-bb);
+	}
+
+	//! Product
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator*
+		( Dual<N> const & aa
+		, Dual<N> const & bb
+		)
+	{
+		Dual<N> result{ aa.theVal * bb.theVal, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk]
+				= aa.theDer[kk] * bb.theVal + aa.theVal * bb.theDer[kk];
+		}
+		return result;
+	}
+
+	/*! \brief Chain rule: Dual with value fVal and derivative scale dfda.
+	 *
+	 * I.e. result is f(aa) where fVal=f(aa.theVal), dfda=f'(aa.theVal).
+	 */
+	template <std::size_t N>
+	inline
+	Dual<N>
+	chained
+		( Dual<N> const & aa
+		, double const & fVal
+		, double const & dfda
+		)
+	{
+		Dual<N> result{ fVal, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk] = dfda * aa.theDer[kk];
+		}
+		return result;
+	}
+
+	//! Reciprocal
+	template <std::size_t N>
+	inline
+	Dual<N>
+	inverse
+		( Dual<N> const & aa
+		)
+	{
+		double const inv{ 1. / aa.theVal };
+		return chained(aa, inv, -inv * inv);
+	}
+
+	//! Quotient
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator/
+		( Dual<N> const & aa
+		, Dual<N> const & bb
+		)
+	{
+		return aa * inverse(bb);
+	}
+
+	//! Sum with constant
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator+
+		( Dual<N> const & aa
+		, double const & bb
+		)
+	{
+		return Dual<N>{ aa.theVal + bb, aa.theDer };
+	}
+
+	//! Sum with constant
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator+
+		( double const & aa
+		, Dual<N> const & bb
+		)
+	{
+		return bb + aa;
+	}
+
+	//! Difference with constant
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator-
+		( Dual<N> const & aa
+		, double const & bb
+		)
+	{
+		return Dual<N>{ aa.theVal - bb, aa.theDer };
+	}
+
+	//! Difference with constant
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator-
+		( double const & aa
+		, Dual<N> const & bb
+		)
+	{
+		return (-bb) + aa;
+	}
+
+	//! Scaling by constant
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator*
+		( double const & aa
+		, Dual<N> const & bb
+		)
+	{
+		return chained(bb, aa * bb.theVal, aa);
+	}
+
+	//! Scaling by constant
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator*
+		( Dual<N> const & aa
+		, double const & bb
+		)
+	{
+		return bb * aa;
+	}
+
+	//! Division by constant
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator/
+		( Dual<N> const & aa
+		, double const & bb
+		)
+	{
+		return (1. / bb) * aa;
+	}
+
+	//! Constant divided by dual
+	template <std::size_t N>
+	inline
+	Dual<N>
+	operator/
+		( double const & aa
+		, Dual<N> const & bb
+		)
+	{
+		return aa * inverse(bb);
+	}
+
+	//
+	// Dual functions
+	//
+
+	//! Square root (derivative is infinite at zero)
+	template <std::size_t N>
+	inline
+	Dual<N>
+	sqrt
+		( Dual<N> const & aa
+		)
+	{
+		double const root{ std::sqrt(aa.theVal) };
+		return chained(aa, root, .5 / root);
+	}
+
+	//! Exponential
+	template <std::size_t N>
+	inline
+	Dual<N>
+	exp
+		( Dual<N> const & aa
+		)
+	{
+		double const val{ std::exp(aa.theVal) };
+		return chained(aa, val, val);
+	}
+
+	//! Natural logarithm
+	template <std::size_t N>
+	inline
+	Dual<N>
+	log
+		( Dual<N> const & aa
+		)
+	{
+		return chained(aa, std::log(aa.theVal), 1. / aa.theVal);
+	}
+
+	//! Sine
+	template <std::size_t N>
+	inline
+	Dual<N>
+	sin
+		( Dual<N> const & aa
+		)
+	{
+		return chained(aa, std::sin(aa.theVal), std::cos(aa.theVal));
+	}
+
+	//! Cosine
+	template <std::size_t N>
+	inline
+	Dual<N>
+	cos
+		( Dual<N> const & aa
+		)
+	{
+		return chained(aa, std::cos(aa.theVal), -std::sin(aa.theVal));
+	}
+
+	//! Two argument arc tangent, atan2(yy, xx)
+	template <std::size_t N>
+	inline
+	Dual<N>
+	atan2
+		( Dual<N> const & yy
+		, Dual<N> const & xx
+		)
+	{
+		double const rSq{ xx.theVal * xx.theVal + yy.theVal * yy.theVal };
+		Dual<N> result{ std::atan2(yy.theVal, xx.theVal), {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk]
+				= ( xx.theVal * yy.theDer[kk]
+				  - yy.theVal * xx.theDer[kk]
+				  ) / rSq;
+		}
+		return result;
+	}
+
+	//
+	// Jet operations
+	//
+
+	//! Apply a linear unary operation to value and derivatives
+	template <typename Type, std::size_t N, typename Func>
+	inline
+	auto
+	linearOf
+		( Jet<Type, N> const & jet
+		, Func const & func
+		) -> Jet<decltype(func(jet.theVal)), N>
+	{
+		Jet<decltype(func(jet.theVal)), N> result{ func(jet.theVal), {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk] = func(jet.theDer[kk]);
+		}
+		return result;
+	}
+
+	//! Negation
+	template <typename Type, std::size_t N>
+	inline
+	Jet<Type, N>
+	operator-
+		( Jet<Type, N> const & jet
+		)
+	{
+		return linearOf(jet, [] (auto const & item) { return -item; });
+	}
+
+	//! Reverse
+	template <typename Type, std::size_t N>
+	inline
+	Jet<Type, N>
+	reverse
+		( Jet<Type, N> const & jet
+		)
+	{
+		return linearOf
+			(jet, [] (auto const & item) { return g3::reverse(item); });
+	}
+
+	//! Dual (Hodge star) - multiplication by (inverse) pseudoscalar
+	template <typename Type, std::size_t N>
+	inline
+	auto
+	dual
+		( Jet<Type, N> const & jet
+		)
+	{
+		return linearOf
+			(jet, [] (auto const & item) { return g3::dual(item); });
+	}
+
+	//! Flip orientation of odd grade components
+	template <typename Type, std::size_t N>
+	inline
+	Jet<Type, N>
+	oddverse
+		( Jet<Type, N> const & jet
+		)
+	{
+		return linearOf
+			(jet, [] (auto const & item) { return g3::oddverse(item); });
+	}
+
+	//! Flip orientation of directed components
+	template <typename Type, std::size_t N>
+	inline
+	Jet<Type, N>
+	dirverse
+		( Jet<Type, N> const & jet
+		)
+	{
+		return linearOf
+			(jet, [] (auto const & item) { return g3::dirverse(item); });
+	}
+
+	//! Sum of jets
+	template
+		< typename TypeA, typename TypeB, std::size_t N
+		, priv::EnableIfEntities<TypeA, TypeB> = true
+		>
+	inline
+	auto
+	operator+
+		( Jet<TypeA, N> const & jetA
+		, Jet<TypeB, N> const & jetB
+		) -> Jet<decltype(jetA.theVal + jetB.theVal), N>
+	{
+		Jet<decltype(jetA.theVal + jetB.theVal), N> result
+			{ jetA.theVal + jetB.theVal, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk] = jetA.theDer[kk] + jetB.theDer[kk];
+		}
+		return result;
+	}
+
+	//! Sum of jet and constant
+	template
+		< typename TypeA, typename TypeB, std::size_t N
+		, priv::EnableIfEntities<TypeA, TypeB> = true
+		>
+	inline
+	auto
+	operator+
+		( Jet<TypeA, N> const & jetA
+		, TypeB const & itemB
+		) -> Jet<decltype(jetA.theVal + itemB), N>
+	{
+		return jetA + constant<N, TypeB>(itemB);
+	}
+
+	//! Sum of constant and jet
+	template
+		< typename TypeA, typename TypeB, std::size_t N
+		, priv::EnableIfEntities<TypeA, TypeB> = true
+		>
+	inline
+	auto
+	operator+
+		( TypeA const & itemA
+		, Jet<TypeB, N> const & jetB
+		) -> Jet<decltype(itemA + jetB.theVal), N>
+	{
+		return constant<N, TypeA>(itemA) + jetB;
+	}
+
+	//! Difference of jets
+	template
+		< typename TypeA, typename TypeB, std::size_t N
+		, priv::EnableIfEntities<TypeA, TypeB> = true
+		>
+	inline
+	auto
+	operator-
+		( Jet<TypeA, N> const & jetA
+		, Jet<TypeB, N> const & jetB
+		) -> Jet<decltype(jetA.theVal - jetB.theVal), N>
+	{
+		Jet<decltype(jetA.theVal - jetB.theVal), N> result
+			{ jetA.theVal - jetB.theVal, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk] = jetA.theDer[kk] - jetB.theDer[kk];
+		}
+		return result;
+	}
+
+	//! Difference of jet and constant
+	template
+		< typename TypeA, typename TypeB, std::size_t N
+		, priv::EnableIfEntities<TypeA, TypeB> = true
+		>
+	inline
+	auto
+	operator-
+		( Jet<TypeA, N> const & jetA
+		, TypeB const & itemB
+		) -> Jet<decltype(jetA.theVal - itemB), N>
+	{
+		return jetA - constant<N, TypeB>(itemB);
+	}
+
+	//! Difference of constant and jet
+	template
+		< typename TypeA, typename TypeB, std::size_t N
+		, priv::EnableIfEntities<TypeA, TypeB> = true
+		>
+	inline
+	auto
+	operator-
+		( TypeA const & itemA
+		, Jet<TypeB, N> const & jetB
+		) -> Jet<decltype(itemA - jetB.theVal), N>
+	{
+		return constant<N, TypeA>(itemA) - jetB;
+	}
+
+	//! Product of jets (via product rule)
+	template
+		< typename TypeA, typename TypeB, std::size_t N
+		, priv::EnableIfEntities<TypeA, TypeB> = true
+		>
+	inline
+	auto
+	operator*
+		( Jet<TypeA, N> const & jetA
+		, Jet<TypeB, N> const & jetB
+		) -> Jet<decltype(jetA.theVal * jetB.theVal), N>
+	{
+		Jet<decltype(jetA.theVal * jetB.theVal), N> result
+			{ jetA.theVal * jetB.theVal, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk]
+				= jetA.theDer[kk] * jetB.theVal
+				+ jetA.theVal * jetB.theDer[kk];
+		}
+		return result;
+	}
+
+	//! Product of jet and constant
+	template
+		< typename TypeA, typename TypeB, std::size_t N
+		, priv::EnableIfEntities<TypeA, TypeB> = true
+		>
+	inline
+	auto
+	operator*
+		( Jet<TypeA, N> const & jetA
+		, TypeB const & itemB
+		) -> Jet<decltype(jetA.theVal * itemB), N>
+	{
+		return linearOf
+			(jetA, [&itemB] (auto const & item) { return item * itemB; });
+	}
+
+	//! Product of constant and jet
+	template
+		< typename TypeA, typename TypeB, std::size_t N
+		, priv::EnableIfEntities<TypeA, TypeB> = true
+		>
+	inline
+	auto
+	operator*
+		( TypeA const & itemA
+		, Jet<TypeB, N> const & jetB
+		) -> Jet<decltype(itemA * jetB.theVal), N>
+	{
+		return linearOf
+			(jetB, [&itemA] (auto const & item) { return itemA * item; });
+	}
+
+	//! Product of dual (scalar) and jet
+	template <typename Type, std::size_t N>
+	inline
+	Jet<Type, N>
+	operator*
+		( Dual<N> const & dual
+		, Jet<Type, N> const & jet
+		)
+	{
+		Jet<Type, N> result{ dual.theVal * jet.theVal, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk]
+				= dual.theDer[kk] * jet.theVal
+				+ dual.theVal * jet.theDer[kk];
+		}
+		return result;
+	}
+
+	//! Product of jet and dual (scalar)
+	template <typename Type, std::size_t N>
+	inline
+	Jet<Type, N>
+	operator*
+		( Jet<Type, N> const & jet
+		, Dual<N> const & dual
+		)
+	{
+		return dual * jet;
+	}
+
+	//! Product of dual (scalar) and constant entity
+	template
+		< typename Type, std::size_t N
+		, priv::EnableIfEntities<Type> = true
+		>
+	inline
+	Jet<Type, N>
+	operator*
+		( Dual<N> const & dual
+		, Type const & item
+		)
+	{
+		Jet<Type, N> result{ dual.theVal * item, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk] = dual.theDer[kk] * item;
+		}
+		return result;
+	}
+
+	//
+	// Jet functions
+	//
+
+	//! Squared magnitude (sum of squared components)
+	template <typename Type, std::size_t N>
+	inline
+	Dual<N>
+	magSq
+		( Jet<Type, N> const & jet
+		)
+	{
+		Dual<N> result{ g3::magSq(jet.theVal), {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			result.theDer[kk] = 2. * priv::dotComp(jet.theVal, jet.theDer[kk]);
+		}
+		return result;
+	}
+
+	//! Magnitude (derivative undefined at zero)
+	template <typename Type, std::size_t N>
+	inline
+	Dual<N>
+	magnitude
+		( Jet<Type, N> const & jet
+		)
+	{
+		return sqrt(magSq(jet));
+	}
+
+	//! Unitary direction (jet scaled by inverse magnitude)
+	template <typename Type, std::size_t N>
+	inline
+	Jet<Type, N>
+	direction
+		( Jet<Type, N> const & jet
+		)
+	{
+		return inverse(magnitude(jet)) * jet;
+	}
+
+	//! Multiplicative inverse - for blades and Spinor: reverse(x)/magSq(x)
+	template
+		< typename Type, std::size_t N
+		, std::enable_if_t
+			< g3::is::blade<Type>::value || g3::is::Spinor<Type>::value
+			, bool
+			> = true
+		>
+	inline
+	Jet<Type, N>
+	inverse
+		( Jet<Type, N> const & jet
+		)
+	{
+		return inverse(magSq(jet)) * reverse(jet);
+	}
+
+	//! Multiplicative inverse (ref g3::inverse()) - for other g3 types
+	template
+		< typename Type, std::size_t N
+		, std::enable_if_t
+			< g3::is::ImSpin<Type>::value
+			  || g3::is::ComPlex<Type>::value
+			  || g3::is::DirPlex<Type>::value
+			  || g3::is::MultiVector<Type>::value
+			, bool
+			> = true
+		>
+	inline
+	Jet<Type, N>
+	inverse
+		( Jet<Type, N> const & jet
+		)
+	{
+		// d(1/x) = -(1/x)*dx*(1/x) evaluated with MultiVector products
+		Type const inv{ g3::inverse<Type>(jet.theVal) };
+		MultiVector const invMV{ inv };
+		Jet<Type, N> result{ inv, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			MultiVector const dmv{ jet.theDer[kk] };
+			result.theDer[kk] = priv::partOf<Type>(-(invMV * dmv * invMV));
+		}
+		return result;
+	}
+
+	//! Spinor exponential of BiVector (ref g3::expJac())
+	template <std::size_t N>
+	inline
+	Jet<Spinor, N>
+	exp
+		( Jet<BiVector, N> const & jet
+		)
+	{
+		std::pair<Spinor, Jac4x3> const sj{ expJac(jet.theVal) };
+		Jac4x3 const & jac = sj.second;
+		Jet<Spinor, N> result{ sj.first, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			std::array<double, 3u> const & db = jet.theDer[kk].theData;
+			std::array<double, 4u> ds;
+			for (std::size_t row{0u} ; row < 4u ; ++row)
+			{
+				ds[row]
+					= jac[3u*row] * db[0]
+					+ jac[3u*row + 1u] * db[1]
+					+ jac[3u*row + 2u] * db[2];
+			}
+			result.theDer[kk] = Spinor{ ds[0], ds[1], ds[2], ds[3] };
+		}
+		return result;
+	}
+
+	//! Spinor logarithm (ref g3::logG2Jac() for domain restrictions)
+	template <std::size_t N>
+	inline
+	Jet<Spinor, N>
+	logG2
+		( Jet<Spinor, N> const & jet
+		)
+	{
+		std::pair<Spinor, Jac4x4> const sj{ logG2Jac(jet.theVal) };
+		Jac4x4 const & jac = sj.second;
+		Jet<Spinor, N> result{ sj.first, {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			Spinor const & dd = jet.theDer[kk];
+			std::array<double, 4u> ds;
+			for (std::size_t row{0u} ; row < 4u ; ++row)
+			{
+				ds[row]
+					= jac[4u*row] * dd[0]
+					+ jac[4u*row + 1u] * dd[1]
+					+ jac[4u*row + 2u] * dd[2]
+					+ jac[4u*row + 3u] * dd[3];
+			}
+			result.theDer[kk] = Spinor{ ds[0], ds[1], ds[2], ds[3] };
+		}
+		return result;
+	}
+
+namespace priv
+{
+	//! Complex function value and derivatives (of orders 0 through 7)
+	using Derivs = std::array<std::complex<double>, 8u>;
+
+	//! Derivatives of exp() at cc
+	inline
+	Derivs
+	expDerivs
+		( std::complex<double> const & cc
+		)
+	{
+		Derivs derivs;
+		derivs.fill(std::exp(cc));
+		return derivs;
+	}
+
+	//! Derivatives of sinh() at cc
+	inline
+	Derivs
+	sinhDerivs
+		( std::complex<double> const & cc
+		)
+	{
+		std::complex<double> const sh{ std::sinh(cc) };
+		std::complex<double> const ch{ std::cosh(cc) };
+		return Derivs{ sh, ch, sh, ch, sh, ch, sh, ch };
+	}
+
+	//! Derivatives of cosh() at cc
+	inline
+	Derivs
+	coshDerivs
+		( std::complex<double> const & cc
+		)
+	{
+		std::complex<double> const sh{ std::sinh(cc) };
+		std::complex<double> const ch{ std::cosh(cc) };
+		return Derivs{ ch, sh, ch, sh, ch, sh, ch, sh };
+	}
+
+	//! Derivatives of sin() at cc
+	inline
+	Derivs
+	sinDerivs
+		( std::complex<double> const & cc
+		)
+	{
+		std::complex<double> const sn{ std::sin(cc) };
+		std::complex<double> const cs{ std::cos(cc) };
+		return Derivs{ sn, cs, -sn, -cs, sn, cs, -sn, -cs };
+	}
+
+	//! Derivatives of cos() at cc
+	inline
+	Derivs
+	cosDerivs
+		( std::complex<double> const & cc
+		)
+	{
+		std::complex<double> const sn{ std::sin(cc) };
+		std::complex<double> const cs{ std::cos(cc) };
+		return Derivs{ cs, -sn, -cs, sn, cs, -sn, -cs, sn };
+	}
+
+	//! Derivatives of (principal) log() at cc
+	inline
+	Derivs
+	logDerivs
+		( std::complex<double> const & cc
+		)
+	{
+		Derivs derivs;
+		std::complex<double> const inv{ 1. / cc };
+		derivs[0] = std::log(cc);
+		derivs[1] = inv;
+		for (std::size_t kk{2u} ; kk < derivs.size() ; ++kk)
+		{
+			// d^k(log(c)) = (-1)^(k-1) * (k-1)! / c^k
+			derivs[kk] = (-double(kk - 1u)) * inv * derivs[kk - 1u];
+		}
+		return derivs;
+	}
+
+	//! Derivatives of (principal) sqrt() at cc
+	inline
+	Derivs
+	sqrtDerivs
+		( std::complex<double> const & cc
+		)
+	{
+		Derivs derivs;
+		std::complex<double> const inv{ 1. / cc };
+		derivs[0] = std::sqrt(cc);
+		for (std::size_t kk{1u} ; kk < derivs.size() ; ++kk)
+		{
+			// d^k(c^(1/2)) = (1/2 - (k-1)) * d^(k-1)(c^(1/2)) / c
+			derivs[kk] = (.5 - double(kk - 1u)) * inv * derivs[kk - 1u];
+		}
+		return derivs;
+	}
+
+	/*! \brief Partial derivatives of split coefficients (ref splitChained())
+	 *
+	 * For f(c+d) = A(c,w) + B(c,w)*d with w=d*d (ref g3::priv::fromSplit())
+	 * the values are B and the partials A_c, A_w, B_c, B_w.
+	 */
+	struct SplitPartials
+	{
+		std::complex<double> theB; //!< Divided difference coefficient
+		std::complex<double> theAc; //!< dA/dc
+		std::complex<double> theAw; //!< dA/dw
+		std::complex<double> theBc; //!< dB/dc
+		std::complex<double> theBw; //!< dB/dw
+
+		/*! \brief Partials for function with derivatives from derivsAt.
+		 *
+		 * With zz*zz=ww, the divided differences of f(c+zz) and f(c-zz)
+		 * are used unless zz is small (relative to 1 for entire
+		 * functions, else relative to c) in which case they are
+		 * evaluated by series in ww (with relative error below about
+		 * 1.e-12 in either case).
+		 */
+		template <typename DerivFunc>
+		inline
+		static
+		SplitPartials
+		from
+			( std::complex<double> const & cc
+			, std::complex<double> const & ww
+			, DerivFunc const & derivsAt
+			, bool const & isEntire
+			)
+		{
+			SplitPartials parts;
+			std::complex<double> const zz{ std::sqrt(ww) };
+			double const scale{ isEntire ? 1. : std::abs(cc) };
+			if (std::abs(zz) < (1.e-2 * scale))
+			{
+				// Taylor series (in ww) about c
+				Derivs const dc{ derivsAt(cc) };
+				parts.theB = dc[1]
+					+ ww * (dc[3]/6. + ww * (dc[5]/120. + ww * dc[7]/5040.));
+				parts.theAc = dc[1]
+					+ ww * (dc[3]/2. + ww * (dc[5]/24. + ww * dc[7]/720.));
+				parts.theBc = dc[2] + ww * (dc[4]/6. + ww * dc[6]/120.);
+				parts.theBw = dc[3]/6. + ww * (dc[5]/60. + ww * dc[7]/1680.);
+			}
+			else
+			{
+				// divided differences
+				Derivs const dp{ derivsAt(cc + zz) };
+				Derivs const dm{ derivsAt(cc - zz) };
+				std::complex<double> const twoZ{ 2. * zz };
+				parts.theB = (dp[0] - dm[0]) / twoZ;
+				parts.theAc = .5 * (dp[1] + dm[1]);
+				parts.theBc = (dp[1] - dm[1]) / twoZ;
+				parts.theBw = (parts.theAc - parts.theB) / (2. * ww);
+			}
+			parts.theAw = .5 * parts.theBc;
+			return parts;
+		}
+	};
+
+	/*! \brief Chain rule for functions evaluated via the ComPlex/DirPlex split
+	 *
+	 * The function value is valFunc(jet.theVal) (i.e. exactly as for
+	 * the g3 function). For derivatives, the argument is expressed as
+	 * a MultiVector (c + d) with ComPlex, c, and DirPlex, d, parts such
+	 * that f(c+d) = A(c,w) + B(c,w)*d where w=d*d is ComPlex (ref
+	 * g3::priv::fromSplit()). Since c and w commute with everything,
+	 * a change (dc + dd) produces
+	 * \arg df = (A_c*dc + A_w*dw) + (B_c*dc + B_w*dw)*d + B*dd
+	 * with dw = dd*d + d*dd. The partials of A and B follow from the
+	 * complex derivatives (from derivsAt) of f (ref SplitPartials).
+	 */
+	template
+		< typename Type, std::size_t N
+		, typename ValFunc, typename DerivFunc
+		>
+	inline
+	auto
+	splitChained
+		( Jet<Type, N> const & jet
+		, ValFunc const & valFunc
+		, DerivFunc const & derivsAt
+		, bool const & isEntire
+		) -> Jet<decltype(valFunc(jet.theVal)), N>
+	{
+		using OutType = decltype(valFunc(jet.theVal));
+		MultiVector const mv{ jet.theVal };
+		std::array<double, 3u> const & vec = mv.theVec.theData;
+		std::array<double, 3u> const & biv = mv.theBiv.theData;
+		std::complex<double> const cc{ g3::priv::comPart(mv) };
+		std::complex<double> const ww
+			{ g3::priv::prodComm(vec, vec) - g3::priv::prodComm(biv, biv)
+			, 2. * g3::priv::prodComm(vec, biv)
+			};
+		SplitPartials const parts
+			{ SplitPartials::from(cc, ww, derivsAt, isEntire) };
+
+		Jet<OutType, N> result{ valFunc(jet.theVal), {} };
+		for (std::size_t kk{0u} ; kk < N ; ++kk)
+		{
+			MultiVector const dmv{ jet.theDer[kk] };
+			std::array<double, 3u> const & dVec = dmv.theVec.theData;
+			std::array<double, 3u> const & dBiv = dmv.theBiv.theData;
+			std::complex<double> const dc{ g3::priv::comPart(dmv) };
+			std::complex<double> const dw
+				{ 2. * ( g3::priv::prodComm(vec, dVec)
+					   - g3::priv::prodComm(biv, dBiv)
+					   )
+				, 2. * ( g3::priv::prodComm(vec, dBiv)
+					   + g3::priv::prodComm(biv, dVec)
+					   )
+				};
+			std::complex<double> const dA
+				{ parts.theAc * dc + parts.theAw * dw };
+			std::complex<double> const dB
+				{ parts.theBc * dc + parts.theBw * dw };
+			MultiVector const der
+				{ g3::priv::fromSplit(dA, dB, mv)
+				+ g3::priv::fromSplit(std::complex<double>{}, parts.theB, dmv)
+				};
+			result.theDer[kk] = partOf<OutType>(der);
+		}
+		return result;
+	}
+
+} // [priv]
+
+	//! Spinor exponential of Spinor: exp(a + B) = exp(a) * exp(B)
+	template <std::size_t N>
+	inline
+	Jet<Spinor, N>
+	exp
+		( Jet<Spinor, N> const & jet
+		)
+	{
+		Dual<N> const scaDual{ priv::scalarDualOf(jet) };
+		Jet<BiVector, N> const bivJet
+			{ linearOf(jet, [] (Spinor const & spin) { return spin.theBiv; }) };
+		Jet<Spinor, N> result{ exp(scaDual) * exp(bivJet) };
+		result.theVal = g3::exp(jet.theVal);
+		return result;
+	}
+
+	/*! \brief Spinor square root (ref g3::sqrtG2()).
+	 *
+	 * Derivatives are those of exp(logG2(spin)/2) and are therefore null
+	 * where logG2Jac() is null (e.g. at half turn rotations).
+	 */
+	template <std::size_t N>
+	inline
+	Jet<Spinor, N>
+	sqrtG2
+		( Jet<Spinor, N> const & jet
+		, BiVector const & bivDirForImaginary = e23
+		)
+	{
+		Jet<Spinor, N> result{ exp(.5 * logG2(jet)) };
+		result.theVal = g3::sqrtG2(jet.theVal, bivDirForImaginary);
+		return result;
+	}
+
+	/*! \brief Spinor raised to a real valued power (ref g3::pow()).
+	 *
+	 * Derivatives are those of exp(expo*logG2(spin)) and are therefore
+	 * null where logG2Jac() is null (e.g. at half turn rotations).
+	 */
+	template <std::size_t N>
+	inline
+	Jet<Spinor, N>
+	pow
+		( Jet<Spinor, N> const & jet
+		, double const & expo
+		, BiVector const & bivDirForImaginary = e23
+		)
+	{
+		Jet<Spinor, N> result{ exp(expo * logG2(jet)) };
+		result.theVal = g3::pow(jet.theVal, expo, bivDirForImaginary);
+		return result;
+	}
+
+	/*! \brief MultiVector raised to an integer power (ref g3::pow()).
+	 *
+	 * Evaluated with the same sequence of (jet) products as g3::pow()
+	 * such that the value is identical.
+	 */
+	template <std::size_t N>
+	inline
+	Jet<MultiVector, N>
+	pow
+		( Jet<MultiVector, N> const & jet
+		, int const & expo
+		)
+	{
+		Jet<MultiVector, N> result{ constant<N>(null<MultiVector>()) };
+		if (isValid(jet.theVal))
+		{
+			Jet<MultiVector, N> base{ jet };
+			if (expo < 0)
+			{
+				base = inverse(jet);
+			}
+			if (isValid(base.theVal))
+			{
+				result = constant<N>(one<MultiVector>());
+				unsigned int count{ static_cast<unsigned int>(expo) };
+				if (expo < 0)
+				{
+					count = 0u - count;
+				}
+				while (0u < count)
+				{
+					if (1u == (count & 1u))
+					{
+						result = result * base;
+					}
+					count = count >> 1u;
+					if (0u < count)
+					{
+						base = base * base;
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	//! Exponential of MultiVector (ref priv::splitChained())
+	template <std::size_t N>
+	inline
+	Jet<MultiVector, N>
+	exp
+		( Jet<MultiVector, N> const & jet
+		)
+	{
+		return priv::splitChained
+			( jet
+			, [] (auto const & item) { return g3::exp(item); }
+			, priv::expDerivs
+			, true
+			);
+	}
+
+	/*! \brief Principal logarithm of MultiVector (ref priv::splitChained())
+	 *
+	 * Derivatives are not meaningful on the branch cut (ref g3::log()).
+	 */
+	template <std::size_t N>
+	inline
+	Jet<MultiVector, N>
+	log
+		( Jet<MultiVector, N> const & jet
+		)
+	{
+		return priv::splitChained
+			( jet
+			, [] (auto const & item) { return g3::log(item); }
+			, priv::logDerivs
+			, false
+			);
+	}
+
+	/*! \brief Principal square root of MultiVector (ref priv::splitChained())
+	 *
+	 * Derivatives are not meaningful on the branch cut (ref g3::sqrt())
+	 * and are infinite (or NaN) where the root is singular (e.g. zero).
+	 */
+	template <std::size_t N>
+	inline
+	Jet<MultiVector, N>
+	sqrt
+		( Jet<MultiVector, N> const & jet
+		)
+	{
+		return priv::splitChained
+			( jet
+			, [] (auto const & item) { return g3::sqrt(item); }
+			, priv::sqrtDerivs
+			, false
+			);
+	}
+
+	//! Hyperbolic sine (for types supported by g3::sinh())
+	template <typename Type, std::size_t N>
+	inline
+	auto
+	sinh
+		( Jet<Type, N> const & jet
+		) -> Jet<decltype(g3::sinh(jet.theVal)), N>
+	{
+		return priv::splitChained
+			( jet
+			, [] (auto const & item) { return g3::sinh(item); }
+			, priv::sinhDerivs
+			, true
+			);
+	}
+
+	//! Hyperbolic cosine (for types supported by g3::cosh())
+	template <typename Type, std::size_t N>
+	inline
+	auto
+	cosh
+		( Jet<Type, N> const & jet
+		) -> Jet<decltype(g3::cosh(jet.theVal)), N>
+	{
+		return priv::splitChained
+			( jet
+			, [] (auto const & item) { return g3::cosh(item); }
+			, priv::coshDerivs
+			, true
+			);
+	}
+
+	//! Circular sine (for types supported by g3::sin())
+	template <typename Type, std::size_t N>
+	inline
+	auto
+	sin
+		( Jet<Type, N> const & jet
+		) -> Jet<decltype(g3::sin(jet.theVal)), N>
+	{
+		return priv::splitChained
+			( jet
+			, [] (auto const & item) { return g3::sin(item); }
+			, priv::sinDerivs
+			, true
+			);
+	}
+
+	//! Circular cosine (for types supported by g3::cos())
+	template <typename Type, std::size_t N>
+	inline
+	auto
+	cos
+		( Jet<Type, N> const & jet
+		) -> Jet<decltype(g3::cos(jet.theVal)), N>
+	{
+		return priv::splitChained
+			( jet
+			, [] (auto const & item) { return g3::cos(item); }
+			, priv::cosDerivs
+			, true
+			);
+	}
+
+	//! Simultaneous {sinh(), cosh()} (for types supported by g3::sinh())
+	template <typename Type, std::size_t N>
+	inline
+	auto
+	sinhcosh
+		( Jet<Type, N> const & jet
+		) -> std::pair
+			< Jet<decltype(g3::sinh(jet.theVal)), N>
+			, Jet<decltype(g3::cosh(jet.theVal)), N>
+			>
+	{
+		return { sinh(jet), cosh(jet) };
+	}
+
+	//! Simultaneous {sin(), cos()} (for types supported by g3::sin())
+	template <typename Type, std::size_t N>
+	inline
+	auto
+	sincos
+		( Jet<Type, N> const & jet
+		) -> std::pair
+			< Jet<decltype(g3::sin(jet.theVal)), N>
+			, Jet<decltype(g3::cos(jet.theVal)), N>
+			>
+	{
+		return { sin(jet), cos(jet) };
+	}
+
+} // [ad]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3dual_INCL_
@@ -49,23 +49,26 @@ engabra::g3 types.
 \arg Logarithms - Functions for providing a (principal branch) logarithm
 value of common argument types for which logarithm values exist. Although
 support for argument types is not entirely comprehensive, logarithm
-functions are provided for mostly commonly occurring entity types.
+functions are provided for mostly commonly occurring entity types. The
+general MultiVector logarithm, log(), is evaluated in closed form using
+the ComPlex/DirPlex split of the argument.
+
+\arg Roots - Square root functions for Spinors (sqrtG2()) and for general
+MultiVectors (sqrt()).
 
 \arg Inverses - Functions that provide inverses of all non-zero blades types
 as well as several (non-zero) compute types that have well defined inverses.
 
-\b TBD
-
-\arg Circular - Functions providing circular trig function values. These
-can be computed using exp() and selecting desired resulting grades.
+\arg Circular - Functions providing circular trig function values,
+sin() and cos(), for BiVector, Spinor, ComPlex and MultiVector arguments.
+Both values are available together from sincos().
 
-\arg Hyperbolic - - Functions providing hyperbolic trig function
-values. These can be computed using exp() and selecting desired resulting
-grades.
+\arg Hyperbolic - Functions providing hyperbolic trig function values,
+sinh() and cosh(), for the same argument types. Both values are available
+together from sinhcosh().
 
-\arg Roots - ?
-
-\arg Powers - ?
+\arg Powers - Functions that raise Spinors to real valued powers and
+MultiVectors to integer powers (pow()).
 
 \b Examples
 
@@ -82,6 +85,7 @@ Simultaneous magnitude and direction:
 
 #include "g3type.hpp"
 
+#include "g3instr.hpp"
 #include "g3ops.hpp"
 #include "g3traits.hpp"
 #include "g3validity.hpp"
@@ -155,6 +159,8 @@ namespace g3
 		( Blade const & blade
 		)
 	{
+		Engabra_INSTR_FUNC
+			("magSq", Blade, 2u*instr::priv::sNumComp<Blade> - 1u);
 		return priv::prodComm(blade.theData, blade.theData);
 	}
 
@@ -165,6 +171,7 @@ namespace g3
 		( Spinor const & spin
 		)
 	{
+		Engabra_INSTR_FUNC("magSq", Spinor, 7u);
 		double const scaSq{ sq(spin.theSca.theData[0]) };
 		double const bivSq{ magSq(spin.theBiv) };
 		return {scaSq + bivSq };
@@ -177,6 +184,7 @@ namespace g3
 		( ImSpin const & imsp
 		)
 	{
+		Engabra_INSTR_FUNC("magSq", ImSpin, 7u);
 		double const vecSq{ magSq(imsp.theVec) };
 		double const triSq{ sq(imsp.theTri.theData[0]) };
 		return {vecSq + triSq };
@@ -189,6 +197,7 @@ namespace g3
 		( ComPlex const & cplx
 		)
 	{
+		Engabra_INSTR_FUNC("magSq", ComPlex, 3u);
 		Scalar const & sca = cplx.theSca;
 		TriVector const & tri = cplx.theTri;
 		return { magSq(sca) + magSq(tri) };
@@ -201,6 +210,7 @@ namespace g3
 		( DirPlex const & dplx
 		)
 	{
+		Engabra_INSTR_FUNC("magSq", DirPlex, 11u);
 		Vector const & vec = dplx.theVec;
 		BiVector const & biv = dplx.theBiv;
 		return { magSq(vec) + magSq(biv) };
@@ -213,6 +223,7 @@ namespace g3
 		( MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_FUNC("magSq", MultiVector, 15u);
 		double const scaSq{ sq(mv.theSca.theData[0]) };
 		double const vecSq{ magSq(mv.theVec) };
 		double const bivSq{ magSq(mv.theBiv) };
@@ -228,10 +239,37 @@ namespace g3
 		( Type const & element
 		)
 	{
+		Engabra_INSTR_FUNC("magnitude", Type, 2u*instr::priv::sNumComp<Type>);
 		return std::sqrt(magSq(element));
 	}
 
-	//! Decompose arbitrary blade into magnitude and direction interpretations
+namespace priv
+{
+	/*! \brief Reciprocal of magnitude (or NaN if too small for a direction).
+	 *
+	 * The test is written as a (branch free) selection so that loops
+	 * over many items can be vectorized by the compiler. A NaN value
+	 * scales any entity into an (all component) null value.
+	 */
+	inline
+	double
+	invMagOrNaN
+		( double const & mag
+		)
+	{
+		// use a tolerance large enough so that computation result
+		// retains meaningful precision.
+		constexpr double small{ std::numeric_limits<double>::denorm_min() };
+		return (small < mag) ? (1. / mag) : g3::nan;
+	}
+
+} // [priv]
+
+	/*! \brief Decompose arbitrary blade into magnitude and direction.
+	 *
+	 * The direction is null if the magnitude is too small for a
+	 * meaningful direction to be determined.
+	 */
 	template
 		< typename Type
 // Should apply to other items as well: e.g. Spinor, ImSpin, MultiVector, ...??
@@ -243,16 +281,8 @@ namespace g3
 		( Type const & blade
 		)
 	{
-		std::pair<double, Type> result{ magnitude(blade), null<Type>() };
-		double const & mag = result.first;
-		// use a tolerance large enough so that computation result
-		// retains meaningful precision.
-		constexpr double small{ std::numeric_limits<double>::denorm_min() };
-		if (small < mag)
-		{
-			result.second = (1./mag) * blade;
-		}
-		return result;
+		double const mag{ magnitude(blade) };
+		return { mag, priv::invMagOrNaN(mag) * blade };
 	}
 
 	//
@@ -420,6 +450,8 @@ namespace g3
 		( Type const & item
 		)
 	{
+		Engabra_INSTR_FUNC
+			("amplitude", Type, 8u*instr::priv::sNumComp<Type> + 10u);
 		ComPlex const cSq{ ampSq(item) };
 		std::complex<double> zSq
 			{ cSq.theSca.theData[0], cSq.theTri.theData[0] };
@@ -441,6 +473,8 @@ namespace g3
 		( Type const & blade
 		)
 	{
+		Engabra_INSTR_FUNC
+			("direction", Type, 3u*instr::priv::sNumComp<Type> + 1u);
 		return pairMagDirFrom<Type>(blade).second;
 	}
 
@@ -459,10 +493,75 @@ namespace g3
 		( Type const & someItem
 		)
 	{
+		Engabra_INSTR_FUNC("inverse", Type, 3u*instr::priv::sNumComp<Type>);
 		double const mag2{ magSq(someItem) };
 		return Type{ (1./mag2) * reverse(someItem) };
 	}
 
+namespace priv
+{
+	/*! \brief Scale factor (1/den) if (den) is large enough, else NaN.
+	 *
+	 * The test is written as a (branch free) selection so that loops
+	 * over many items can be vectorized by the compiler. The NaN result
+	 * propagates to produce null values in subsequent products.
+	 */
+	inline
+	double
+	invOrNaN
+		( double const & den
+		)
+	{
+		constexpr double tol{ std::numeric_limits<double>::min() };
+		return (tol < den) ? (1. / den) : g3::nan;
+	}
+
+	/*! \brief Fused MultiVector inverse and flag indicating if it exists.
+	 *
+	 * The inverse is dirverse(mv)*inverse(ampSq(mv)) where the ComPlex
+	 * squared amplitude (aa+I*bb) has inverse (aa-I*bb)/(aa*aa+bb*bb).
+	 * The evaluation is performed directly with double values.
+	 */
+	inline
+	std::pair<MultiVector, bool>
+	pairInvOkayFrom
+		( MultiVector const & mv
+		)
+	{
+		double const & sca = mv.theSca.theData[0];
+		std::array<double, 3u> const & vec = mv.theVec.theData;
+		std::array<double, 3u> const & biv = mv.theBiv.theData;
+		double const & tri = mv.theTri.theData[0];
+
+		// squared amplitude (ref ampSq())
+		double const aa
+			{ sca*sca - prodComm(vec, vec) + prodComm(biv, biv) - tri*tri };
+		double const bb{ 2.*(sca*tri - prodComm(vec, biv)) };
+
+		// inverse of squared amplitude: (k0 + I*k1)
+		double const den{ aa*aa + bb*bb };
+		double const scale{ invOrNaN(den) };
+		double const k0{  aa * scale };
+		double const k1{ -bb * scale };
+
+		// (k0 + I*k1) * dirverse(mv) with dirverse(mv) = (s - v - B + T)
+		return
+			{ MultiVector
+				{ k0*sca - k1*tri
+				, k1*biv[0] - k0*vec[0]
+				, k1*biv[1] - k0*vec[1]
+				, k1*biv[2] - k0*vec[2]
+				, -k0*biv[0] - k1*vec[0]
+				, -k0*biv[1] - k1*vec[1]
+				, -k0*biv[2] - k1*vec[2]
+				, k0*tri + k1*sca
+				}
+			, (0. < scale) // false for NaN
+			};
+	}
+
+} // [priv]
+
 	//! Algebraic inverse of ComPlex item (or null if no inverse)
 	template
 		< typename Type
@@ -474,26 +573,71 @@ namespace g3
 		( ComPlex const & cplx
 		)
 	{
-		ComPlex inv{ null<ComPlex>() };
+		Engabra_INSTR_FUNC("inverse", ComPlex, 7u);
 		double const & dubSca = cplx.theSca[0];
 		double const & dubTri = cplx.theTri[0];
+		// conj(cplx) / (cplx * conj(cplx))
+		double const scale{ priv::invOrNaN(sq(dubSca) + sq(dubTri)) };
+		return ComPlex{ Scalar{ scale*dubSca }, TriVector{ -scale*dubTri } };
+	}
 
-		// use complex library functions to evaluate
-		std::complex<double> const zFwd{ dubSca, dubTri };
-		std::complex<double> const zConj{ std::conj(zFwd) };
-		std::complex<double> const zAmpSq{ zFwd * std::conj(zFwd) };
-		constexpr double tolSq{ std::numeric_limits<double>::min() };
-		if (tolSq < std::abs(zAmpSq))
-		{
-			std::complex<double> const zInvAmpSq{ 1. / zAmpSq };
-			std::complex<double> const zInv{ zConj * zInvAmpSq };
-			inv = ComPlex{ std::real(zInv), std::imag(zInv) };
-		}
-		return inv;
+	//! Algebraic inverse of ImSpin item (or null if no inverse)
+	template
+		< typename Type
+		, std::enable_if_t< is::ImSpin<Type>::value, bool> = true
+		>
+	inline
+	ImSpin
+	inverse
+		( ImSpin const & imsp
+		)
+	{
+		Engabra_INSTR_FUNC("inverse", ImSpin, 12u);
+		// (v + T) * (v - T) = (magSq(v) + magSq(T)) commutes
+		double const scale{ priv::invOrNaN(magSq(imsp)) };
+		return ImSpin{ scale * imsp.theVec, -scale * imsp.theTri };
 	}
 
+	//! Algebraic inverse of DirPlex item (or null if no inverse)
+	template
+		< typename Type
+		, std::enable_if_t< is::DirPlex<Type>::value, bool> = true
+		>
+	inline
+	DirPlex
+	inverse
+		( DirPlex const & dplx
+		)
+	{
+		Engabra_INSTR_FUNC("inverse", DirPlex, 35u);
+		// for d=(v+I*b), d*d = pp + I*qq is ComPlex: inv(d) = d*inv(d*d)
+		std::array<double, 3u> const & vec = dplx.theVec.theData;
+		std::array<double, 3u> const & biv = dplx.theBiv.theData;
+		double const pp{ priv::prodComm(vec, vec) - priv::prodComm(biv, biv) };
+		double const qq{ 2. * priv::prodComm(vec, biv) };
+		double const scale{ priv::invOrNaN(pp*pp + qq*qq) };
+		double const k0{  pp * scale };
+		double const k1{ -qq * scale };
+		// (k0 + I*k1) * (v + I*b) = (k0*v - k1*b) + I*(k1*v + k0*b)
+		return DirPlex
+			{ Vector
+				{ k0*vec[0] - k1*biv[0]
+				, k0*vec[1] - k1*biv[1]
+				, k0*vec[2] - k1*biv[2]
+				}
+			, BiVector
+				{ k1*vec[0] + k0*biv[0]
+				, k1*vec[1] + k0*biv[1]
+				, k1*vec[2] + k0*biv[2]
+				}
+			};
+	}
 
-	//! Algebraic inverse of MultiVector (or null if no inverse)
+	/*! \brief Algebraic inverse of MultiVector (or null if no inverse)
+	 *
+	 * Evaluated with a fused, branch free, computation (ref
+	 * priv::pairInvOkayFrom()).
+	 */
 	template
 		< typename Type
 		, std::enable_if_t< is::MultiVector<Type>::value, bool> = true
@@ -504,12 +648,8 @@ namespace g3
 		( MultiVector const & mv
 		)
 	{
-		ComPlex const amp2{ ampSq(mv) };
-		ComPlex const invAmp{ inverse<ComPlex>(amp2) };
-
-	//	return (invAmp * dirverse(mv)); // TODO needs ComPlex op*()
-		MultiVector const mvDv{ dirverse(mv) };
-		return { invAmp.theSca * mvDv + invAmp.theTri * mvDv };
+		Engabra_INSTR_FUNC("inverse", MultiVector, 100u);
+		return priv::pairInvOkayFrom(mv).first;
 	}
 
 
@@ -538,6 +678,7 @@ namespace g3
 		( BiVector const & spinAngle
 		)
 	{
+		Engabra_INSTR_FUNC("exp", BiVector, 15u);
 		Spinor spin{ null<Spinor>() }; // zero angle default result
 		if (isValid(spinAngle))
 		{
@@ -562,6 +703,7 @@ namespace g3
 		( Spinor const & someItem
 		)
 	{
+		Engabra_INSTR_FUNC("exp", Spinor, 20u);
 		return { std::exp(someItem.theSca.theData[0]) * exp(someItem.theBiv) };
 	}
 
@@ -594,20 +736,163 @@ namespace priv
 		return result;
 	}
 
-} // [priv]
+	/*! \brief ComPlex part (Scalar+TriVector) of mv as std::complex value.
+	 *
+	 * Negative zero components are returned as positive zero so that
+	 * both of the split "eigen values" (ref dirRoot()) of real negative
+	 * arguments lie on the same side of the std::complex branch cut.
+	 */
+	inline
+	std::complex<double>
+	comPart
+		( MultiVector const & mv
+		)
+	{
+		return std::complex<double>
+			{ mv.theSca.theData[0] + 0.
+			, mv.theTri.theData[0] + 0.
+			};
+	}
+
+	/*! \brief Principal complex root of the square of the DirPlex part of mv.
+	 *
+	 * Any MultiVector can be split as (c + d) where c=(Scalar+TriVector)
+	 * is ComPlex and commutes with everything, while d=(Vector+BiVector)
+	 * is a DirPlex. Expressing the bivector as B=I*b (with b a vector),
+	 * the square d*d=(v.v - b.b) + I*2(v.b) is a ComPlex value. The value
+	 * returned here, zz, satisfies zz*zz == d*d.
+	 */
+	inline
+	std::complex<double>
+	dirRoot
+		( MultiVector const & mv
+		)
+	{
+		std::array<double, 3u> const & vec = mv.theVec.theData;
+		std::array<double, 3u> const & biv = mv.theBiv.theData;
+		std::complex<double> const dSq
+			{ prodComm(vec, vec) - prodComm(biv, biv)
+			, 2. * prodComm(vec, biv)
+			};
+		return std::sqrt(dSq);
+	}
+
+	/*! \brief MultiVector value (aa + gg*d) assembled from split values.
+	 *
+	 * For a function, f(), and MultiVector argument (c + d) (ref dirRoot())
+	 * the function value is f(c+d) = aa + gg*d where
+	 * \arg aa = (f(c+zz) + f(c-zz)) / 2
+	 * \arg gg = (f(c+zz) - f(c-zz)) / (2*zz)
+	 *
+	 * The DirPlex part, d, is taken from argument mv.
+	 */
+	inline
+	MultiVector
+	fromSplit
+		( std::complex<double> const & aa
+		, std::complex<double> const & gg
+		, MultiVector const & mv
+		)
+	{
+		// (g0 + I*g1) * (v + I*b) = (g0*v - g1*b) + I*(g1*v + g0*b)
+		double const g0{ std::real(gg) };
+		double const g1{ std::imag(gg) };
+		std::array<double, 3u> const & vec = mv.theVec.theData;
+		std::array<double, 3u> const & biv = mv.theBiv.theData;
+		return MultiVector
+			{ std::real(aa)
+			, g0*vec[0] - g1*biv[0]
+			, g0*vec[1] - g1*biv[1]
+			, g0*vec[2] - g1*biv[2]
+			, g1*vec[0] + g0*biv[0]
+			, g1*vec[1] + g0*biv[1]
+			, g1*vec[2] + g0*biv[2]
+			, std::imag(aa)
+			};
+	}
 
+	//! Evaluation of complex "sinh(z)/z" - including limit case near zero
+	inline
+	std::complex<double>
+	sinhc
+		( std::complex<double> const & zz
+		)
+	{
+		std::complex<double> result{ g3::nan, g3::nan };
+		// as with sync(), residual is less than O(z^6)
+		if (std::norm(zz) < 1.e-8)
+		{
+			std::complex<double> const zSq{ zz * zz };
+			result = (zSq*zSq/120. + zSq/6. + 1.);
+		}
+		else
+		{
+			result = std::sinh(zz) / zz;
+		}
+		return result;
+	}
 
-	/*! Exponential of general MultiVector element.
+	/*! \brief Divided difference (log(cc+zz) - log(cc-zz)) / (2*zz)
 	 *
-	 * Formula used is from:
-	 * \arg Dargys, Adolfas, Acus Arturas,
-	 * "Exponentials of general multivector (MV) in 3D Clifford algebras"
-	 * ArXiv:2104.01905v1, 18 Feb 2021
-	 * https://arxiv.org/pdf/2104.01905.pdf
+	 * Arguments logP and logM are the principal logarithm values of
+	 * (cc+zz) and (cc-zz) respectively. For small ratio, zz/cc, the
+	 * direct difference loses precision and is evaluated via series
+	 * expansion of atanh(zz/cc)/(zz/cc) instead. The result includes
+	 * multiples of (I*pi) when needed to remain consistent with the
+	 * principal branch values logP and logM.
+	 */
+	inline
+	std::complex<double>
+	logDiffQuo
+		( std::complex<double> const & cc
+		, std::complex<double> const & zz
+		, std::complex<double> const & logP
+		, std::complex<double> const & logM
+		)
+	{
+		std::complex<double> result{ g3::nan, g3::nan };
+		if (std::abs(zz) < (.125 * std::abs(cc)))
+		{
+			// series: atanh(w)/w = sum{ w^(2k) / (2k+1) } for |w| < 1/8
+			// with (1/8)^(2*10) below double precision after 10 terms
+			std::complex<double> const ww{ zz / cc };
+			std::complex<double> const wSq{ ww * ww };
+			std::complex<double> sum{ 1./21. };
+			for (int kk{9} ; 0 <= kk ; --kk)
+			{
+				sum = sum * wSq + 1./(2.*double(kk) + 1.);
+			}
+			// (logP - logM)/2 == atanh(ww) + I*pi*(number of turns)
+			std::complex<double> const athW{ ww * sum };
+			double const numTurns
+				{ std::round
+					((std::imag(logP - logM) - 2.*std::imag(athW)) / turnFull)
+				};
+			result = sum / cc;
+			if (! (0. == numTurns))
+			{
+				result += std::complex<double>{ 0., turnHalf*numTurns } / zz;
+			}
+		}
+		else
+		{
+			result = (logP - logM) / (2. * zz);
+		}
+		return result;
+	}
+
+} // [priv]
+
+
+	/*! \brief Exponential of general MultiVector element.
 	 *
-* NOTE - ERROR - this paper seems to be wrong
-* For example; obvious in that b0, b123, do not reproduce (-1 == exp(I*pi))
+	 * Evaluated in closed form using the split of argument into
+	 * commuting ComPlex, c, and DirPlex, d, parts (ref priv::dirRoot()).
+	 * With zz*zz=d*d, the result is
+	 * \arg exp(c+d) = exp(c) * (cosh(zz) + d*sinh(zz)/zz)
 	 *
+	 * Example:
+	 * \snippet test_g3func_exp.cpp DoxyExample01
 	 */
 	inline
 	MultiVector
@@ -615,87 +900,19 @@ namespace priv
 		( MultiVector const & someItem
 		)
 	{
+		Engabra_INSTR_FUNC("exp", MultiVector, 70u);
 		MultiVector result{ null<MultiVector>() };
 
 		if (isValid(someItem))
 		{
-			// NOTE: the algorithm [Dargys, Arturas] uses bivector
-			// decomposition with basis: E12, E23, E13
-			// This library uses: e23, e31, e12
-
-			// pull out components from input MV
-			double const a0  {  someItem[0] };
-			double const a1  {  someItem[1] };
-			double const a2  {  someItem[2] };
-			double const a3  {  someItem[3] };
-			double const a12 {  someItem[6] }; // e12
-			double const a13 { -someItem[5] }; // e31
-			double const a23 {  someItem[4] }; // e23
-			double const a123{  someItem[7] };
-
-			// evaluate scalar angles ([Dargys, Arturas] eqn 3.2)
-			double const a3m12{ a3 - a12 };
-			double const a3p12{ a3 + a12 };
-			double const a2m13{ a2 - a13 };
-			double const a2p13{ a2 + a13 };
-			double const a1m23{ a1 - a23 };
-			double const a1p23{ a1 + a23 };
-
-			double const apos{ sqrt(sq(a3m12) + sq(a2p13) + sq(a1m23)) };
-			double const aneg{ sqrt(sq(a3p12) + sq(a2m13) + sq(a1p23)) };
-
-std::cout << "apos: " << apos << std::endl;
-std::cout << "aneg: " << aneg << std::endl;
-
-			// evaluate result coefficients ([Dargys, Arturas] eqn 3.1)
-
-			// cosine function is well behaved including near zero
-			double const cospos{ std::cos(apos) }; // okay for 0==apos
-			double const cosneg{ std::cos(aneg) }; // okay for 0==aneg
-			// sync function (sin(x)/x) needs limiting case evaluation
-			double const syncpos{ priv::sync(apos) };
-			double const syncneg{ priv::sync(aneg) };
-
-std::cout << "cospos: " << cospos << std::endl;
-std::cout << "cosneg: " << cosneg << std::endl;
-
-std::cout << "syncpos: " << syncpos << std::endl;
-std::cout << "syncneg: " << syncneg << std::endl;
-
-			// leading coefficients
-			double const hea0{ .5 * std::exp(a0) }; // half * e(a0)
-			double const epa123{ std::exp( a123) }; // e(+a123)
-			double const ena123{ std::exp(-a123) }; // e(-a123)
-
-std::cout << "hea0  : " << hea0 << std::endl;
-std::cout << "epa123: " << epa123 << std::endl;
-std::cout << "ena123: " << ena123 << std::endl;
-std::cout << " sum  : " << epa123 + ena123 << std::endl;
-
-			// evaluate the output components
-
-			// Note the special case evaluations could be slightly more
-			// optimized, but simple code evaluation is preferred here.
-
-			double const b0  { epa123*cospos + ena123*cosneg };
-
-			double const b1{ epa123*(a1m23)*syncpos + ena123*(a1p23)*syncneg };
-			double const b2{ epa123*(a2p13)*syncpos + ena123*(a2m13)*syncneg };
-			double const b3{ epa123*(a3m12)*syncpos + ena123*(a3p12)*syncneg };
-
-			double const b12{-epa123*(a3m12)*syncpos + ena123*(a3p12)*syncneg};
-			double const b13{ epa123*(a2p13)*syncpos - ena123*(a2m13)*syncneg};
-			double const b23{-epa123*(a1m23)*syncpos + ena123*(a1p23)*syncneg};
-
-			double const b123{ epa123*cospos - ena123*cosneg };
-
-			// NOTE restore conventions on basis bivectors
-			// e23 :  b23
-			// e31 : -b13
-			// e12 :  b12
-			result = MultiVector{ b0, b1, b2, b3, b23, -b13, b12, b123 };
-			// apply overall scale factor
-			result = hea0 * result;
+			std::complex<double> const cc{ priv::comPart(someItem) };
+			std::complex<double> const zz{ priv::dirRoot(someItem) };
+
+			std::complex<double> const expC{ std::exp(cc) };
+			std::complex<double> const aa{ expC * std::cosh(zz) };
+			std::complex<double> const gg{ expC * priv::sinhc(zz) };
+
+			result = priv::fromSplit(aa, gg, someItem);
 		}
 
 		return result;
@@ -716,6 +933,7 @@ std::cout << " sum  : " << epa123 + ena123 << std::endl;
 		, BiVector const & bivDirForImaginary = e23
 		)
 	{
+		Engabra_INSTR_FUNC("logG2", Spinor, 28u);
 		G2Item gangle{ null<G2Item>() }; // generalized angle (Scalar+BiVector)
 		if (isValid(genSpin))
 		{
@@ -767,6 +985,79 @@ std::cout << " sum  : " << epa123 + ena123 << std::endl;
 		return gangle;
 	}
 
+namespace priv
+{
+	/*! \brief BiVector logarithm of unitary spinor, accurate at small angles.
+	 *
+	 * Equivalent to logG2(spin).theBiv for unitary spin, but evaluated
+	 * via atan2() such that (arbitrarily) small angles are retained.
+	 */
+	inline
+	BiVector
+	logBivOfUnit
+		( Spinor const & spin
+		)
+	{
+		double const & sca = spin.theSca.theData[0];
+		double const bivMag{ magnitude(spin.theBiv) };
+		double scale{ 1. / sca };
+		if (std::numeric_limits<double>::min() < bivMag)
+		{
+			scale = std::atan2(bivMag, sca) / bivMag;
+		}
+		return scale * spin.theBiv;
+	}
+
+} // [priv]
+
+	/*! \brief Principal logarithm of a general MultiVector (or null).
+	 *
+	 * Evaluated in closed form using the ComPlex/DirPlex split (ref
+	 * priv::dirRoot()). The argument (c+d) behaves as if it had the
+	 * two complex "eigen values" (c+zz) and (c-zz) where zz*zz=d*d.
+	 * The principal (std::complex) logarithm of each of these is
+	 * combined into the result. The return is null if either of these
+	 * values is zero (no logarithm exists).
+	 *
+	 * Note that the principal branch for the full algebra uses the
+	 * unit TriVector as the imaginary direction. E.g. log(-1)=I*pi.
+	 * For (Scalar+BiVector) arguments, logG2() provides a result that
+	 * remains within the G-2 subalgebra.
+	 *
+	 * Example:
+	 * \snippet test_g3func_log.cpp DoxyExample01
+	 */
+	inline
+	MultiVector
+	log
+		( MultiVector const & someItem
+		)
+	{
+		Engabra_INSTR_FUNC("log", MultiVector, 90u);
+		MultiVector result{ null<MultiVector>() };
+
+		if (isValid(someItem))
+		{
+			std::complex<double> const cc{ priv::comPart(someItem) };
+			std::complex<double> const zz{ priv::dirRoot(someItem) };
+			std::complex<double> const cPos{ cc + zz };
+			std::complex<double> const cNeg{ cc - zz };
+
+			constexpr double tol{ std::numeric_limits<double>::min() };
+			if ((tol < std::abs(cPos)) && (tol < std::abs(cNeg)))
+			{
+				std::complex<double> const logP{ std::log(cPos) };
+				std::complex<double> const logM{ std::log(cNeg) };
+				std::complex<double> const aa{ .5 * (logP + logM) };
+				std::complex<double> const gg
+					{ priv::logDiffQuo(cc, zz, logP, logM) };
+				result = priv::fromSplit(aa, gg, someItem);
+			}
+		}
+
+		return result;
+	}
+
 	//! square root of a (G-2 subalgebra) spinor
 	inline
 	G2Item
@@ -775,6 +1066,7 @@ std::cout << " sum  : " << epa123 + ena123 << std::endl;
 		, BiVector const & bivDirForImaginary = e23
 		)
 	{
+		Engabra_INSTR_FUNC("sqrtG2", Spinor, 52u);
 		G2Item root{ null<G2Item>() };
 		if (isValid(genSpin))
 		{
@@ -794,6 +1086,699 @@ std::cout << " sum  : " << epa123 + ena123 << std::endl;
 		return root;
 	}
 
+	/*! \brief Principal square root of a general MultiVector (or null).
+	 *
+	 * Evaluated in closed form using the ComPlex/DirPlex split (ref
+	 * log() for discussion). With sp=sqrt(c+zz) and sm=sqrt(c-zz) the
+	 * result is (sp+sm)/2 + d/(sp+sm). This form involves no cancellation
+	 * in the DirPlex coefficient.
+	 *
+	 * The return is null for a (non-zero) nilpotent argument (zero
+	 * ComPlex part with d*d=0) for which no square root exists.
+	 *
+	 * Example:
+	 * \snippet test_g3func_root.cpp DoxyExample01
+	 */
+	inline
+	MultiVector
+	sqrt
+		( MultiVector const & someItem
+		)
+	{
+		Engabra_INSTR_FUNC("sqrt", MultiVector, 60u);
+		MultiVector root{ null<MultiVector>() };
+
+		if (isValid(someItem))
+		{
+			std::complex<double> const cc{ priv::comPart(someItem) };
+			std::complex<double> const zz{ priv::dirRoot(someItem) };
+			std::complex<double> const rootSum
+				{ std::sqrt(cc + zz) + std::sqrt(cc - zz) };
+			std::complex<double> const aa{ .5 * rootSum };
+
+			if (! (std::complex<double>{ 0., 0. } == rootSum))
+			{
+				root = priv::fromSplit(aa, 1./rootSum, someItem);
+			}
+			else
+			if (0. == magSq(DirPlex{ someItem.theVec, someItem.theBiv }))
+			{
+				root = zero<MultiVector>();
+			}
+			// else // nilpotent - no root - return null
+		}
+
+		return root;
+	}
+
+	//
+	// Powers
+	//
+
+namespace priv
+{
+	/*! \brief Polar form of a Spinor suitable for repeated power evaluation.
+	 *
+	 * Spinor is represented as: exp(theLogMag) * exp(theAngle * theBivDir)
+	 * with theAngle in range [0,pi] and unitary theBivDir.
+	 */
+	struct SpinPolar
+	{
+		//! Logarithm of spinor magnitude (-infinity for zero spinor)
+		double theLogMag;
+		//! Rotation angle size (in range [0,pi])
+		double theAngle;
+		//! Unitary rotation plane (zero if theAngle is zero)
+		BiVector theBivDir;
+
+		//! Decompose spinor (ref logG2() re use of bivDirForImaginary)
+		inline
+		static
+		SpinPolar
+		from
+			( Spinor const & spin
+			, BiVector const & bivDirForImaginary
+			)
+		{
+			SpinPolar polar{ g3::nan, g3::nan, null<BiVector>() };
+			if (isValid(spin))
+			{
+				double const & sca = spin.theSca.theData[0];
+				double const bivMag{ magnitude(spin.theBiv) };
+				double const spinMag{ std::hypot(sca, bivMag) };
+				polar.theLogMag = std::log(spinMag);
+				polar.theAngle = std::atan2(bivMag, sca);
+				if (0. < bivMag)
+				{
+					polar.theBivDir = (1./bivMag) * spin.theBiv;
+				}
+				else
+				if (sca < 0.)
+				{
+					// half turn - rotation plane is not defined by spin
+					polar.theBivDir = direction(bivDirForImaginary);
+				}
+				else
+				{
+					polar.theBivDir = zero<BiVector>();
+				}
+			}
+			return polar;
+		}
+
+		//! Spinor raised to real valued power.
+		inline
+		Spinor
+		pow
+			( double const & expo
+			) const
+		{
+			Spinor result{ null<Spinor>() };
+			if (-std::numeric_limits<double>::infinity() == theLogMag)
+			{
+				// zero magnitude: only non-negative powers exist
+				if (0. < expo)
+				{
+					result = zero<Spinor>();
+				}
+				else
+				if (0. == expo)
+				{
+					result = one<Spinor>();
+				}
+			}
+			else
+			if (std::isfinite(theLogMag))
+			{
+				double const powMag{ std::exp(expo * theLogMag) };
+				double const tAngle{ expo * theAngle };
+				double cosT{ g3::nan };
+				double sinT{ g3::nan };
+				if (std::abs(tAngle) < 1.e-4)
+				{
+					// small angle: series residual less than O(x^6)
+					double const tSq{ sq(tAngle) };
+					cosT = (sq(tSq)/24. - tSq/2. + 1.);
+					sinT = tAngle * (sq(tSq)/120. - tSq/6. + 1.);
+				}
+				else
+				{
+					cosT = std::cos(tAngle);
+					sinT = std::sin(tAngle);
+				}
+				result = Spinor{ powMag * cosT, (powMag * sinT) * theBivDir };
+			}
+			return result;
+		}
+	};
+
+} // [priv]
+
+	/*! \brief Spinor raised to a real valued power (e.g. for interpolation).
+	 *
+	 * Evaluated with a single logarithm/exponential pair on the polar
+	 * form of the spinor (along with a small angle fast path that avoids
+	 * trigonometric function calls). For a unitary spinor, the result
+	 * is a rotation of expo times the original angle in the same plane.
+	 *
+	 * The bivDirForImaginary argument is used only for spinors that
+	 * are negative scalars (ref logG2()).
+	 *
+	 * The return is null for invalid arguments and for non-positive
+	 * powers of a zero spinor.
+	 *
+	 * Example:
+	 * \snippet test_g3func_pow.cpp DoxyExample01
+	 */
+	inline
+	Spinor
+	pow
+		( Spinor const & spin
+		, double const & expo
+		, BiVector const & bivDirForImaginary = e23
+		)
+	{
+		Engabra_INSTR_FUNC("pow", Spinor, 55u);
+		Spinor result{ null<Spinor>() };
+		if (isValid(spin) && isValid(expo))
+		{
+			result = priv::SpinPolar::from(spin, bivDirForImaginary).pow(expo);
+		}
+		return result;
+	}
+
+	/*! \brief MultiVector raised to an integer power.
+	 *
+	 * Evaluated with exponentiation by squaring (e.g. 4 products for
+	 * a power of 10). Negative powers are evaluated as powers of the
+	 * inverse (ref inverse()) and are null if no inverse exists.
+	 *
+	 * Example:
+	 * \snippet test_g3func_pow.cpp DoxyExample02
+	 */
+	inline
+	MultiVector
+	pow
+		( MultiVector const & mv
+		, int const & expo
+		)
+	{
+		Engabra_INSTR_FUNC("pow", MultiVector, 480u);
+		MultiVector result{ null<MultiVector>() };
+		if (isValid(mv))
+		{
+			MultiVector base{ mv };
+			if (expo < 0)
+			{
+				base = inverse<MultiVector>(mv);
+			}
+			if (isValid(base))
+			{
+				result = one<MultiVector>();
+				// magnitude in unsigned arithmetic (valid also for INT_MIN)
+				unsigned int count{ static_cast<unsigned int>(expo) };
+				if (expo < 0)
+				{
+					count = 0u - count;
+				}
+				while (0u < count)
+				{
+					if (1u == (count & 1u))
+					{
+						result = result * base;
+					}
+					count = count >> 1u;
+					if (0u < count)
+					{
+						base = base * base;
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	//
+	// Circular and Hyperbolic
+	//
+
+namespace priv
+{
+	//! Simultaneous complex {sinh(cc), cosh(cc)} from shared evaluations.
+	inline
+	std::pair<std::complex<double>, std::complex<double> >
+	sinhCosh
+		( std::complex<double> const & cc
+		)
+	{
+		double const & xx = std::real(cc);
+		double const & yy = std::imag(cc);
+		double const shx{ std::sinh(xx) };
+		double const chx{ std::cosh(xx) };
+		double const sny{ std::sin(yy) };
+		double const csy{ std::cos(yy) };
+		return
+			{ std::complex<double>{ shx*csy, chx*sny }
+			, std::complex<double>{ chx*csy, shx*sny }
+			};
+	}
+
+	/*! \brief Split values {aaSinh, ggSinh, aaCosh, ggCosh} (ref fromSplit())
+	 *
+	 * For argument (c+d) with zz*zz=d*d, the split coefficients are
+	 * \arg sinh: aa = sinh(c)*cosh(zz) ; gg = cosh(c)*sinh(zz)/zz
+	 * \arg cosh: aa = cosh(c)*cosh(zz) ; gg = sinh(c)*sinh(zz)/zz
+	 *
+	 * All four values share a single set of transcendental evaluations.
+	 */
+	inline
+	std::array<std::complex<double>, 4u>
+	splitSinhCosh
+		( std::complex<double> const & cc
+		, std::complex<double> const & zz
+		)
+	{
+		std::pair<std::complex<double>, std::complex<double> > const shchC
+			{ sinhCosh(cc) };
+		std::pair<std::complex<double>, std::complex<double> > const shchZ
+			{ sinhCosh(zz) };
+		std::complex<double> const & sinhC = shchC.first;
+		std::complex<double> const & coshC = shchC.second;
+		std::complex<double> const & coshZ = shchZ.second;
+		// as with sinhc(), use series for small arguments
+		std::complex<double> sinhcZ{ 1., 0. };
+		if (std::norm(zz) < 1.e-8)
+		{
+			std::complex<double> const zSq{ zz * zz };
+			sinhcZ = (zSq*zSq/120. + zSq/6. + 1.);
+		}
+		else
+		{
+			sinhcZ = shchZ.first / zz;
+		}
+		return
+			{ sinhC * coshZ, coshC * sinhcZ
+			, coshC * coshZ, sinhC * sinhcZ
+			};
+	}
+
+	/*! \brief Split values {aaSin, ggSin, aaCos, ggCos} (ref fromSplit())
+	 *
+	 * Uses the (central) unit trivector, I, for which sin(M)=-I*sinh(I*M)
+	 * and cos(M)=cosh(I*M). The argument I*M has split values (I*c, I*zz).
+	 */
+	inline
+	std::array<std::complex<double>, 4u>
+	splitSinCos
+		( std::complex<double> const & cc
+		, std::complex<double> const & zz
+		)
+	{
+		constexpr std::complex<double> ii{ 0., 1. };
+		std::array<std::complex<double>, 4u> const hyp
+			{ splitSinhCosh(ii*cc, ii*zz) };
+		// sinh(I*M) = aa + gg*(I*d) so that -I*sinh(I*M) = -I*aa + gg*d
+		// cosh(I*M) = aa + gg*(I*d) = aa + (I*gg)*d
+		return { -ii*hyp[0], hyp[1], hyp[2], ii*hyp[3] };
+	}
+
+	//! Pair of MultiVectors from split values {aa0, gg0, aa1, gg1}
+	inline
+	std::pair<MultiVector, MultiVector>
+	pairFromSplit
+		( std::array<std::complex<double>, 4u> const & splits
+		, MultiVector const & mv
+		)
+	{
+		return
+			{ fromSplit(splits[0], splits[1], mv)
+			, fromSplit(splits[2], splits[3], mv)
+			};
+	}
+
+	//! Pair of Spinors from split values {aa0, gg0, aa1, gg1}
+	inline
+	std::pair<Spinor, Spinor>
+	pairFromSplit
+		( std::array<std::complex<double>, 4u> const & splits
+		, Spinor const & spin
+		)
+	{
+		// the split values are real for (Scalar+BiVector) arguments
+		return
+			{ Spinor
+				{ std::real(splits[0])
+				, std::real(splits[1]) * spin.theBiv
+				}
+			, Spinor
+				{ std::real(splits[2])
+				, std::real(splits[3]) * spin.theBiv
+				}
+			};
+	}
+
+	//! Complex argument values {cc,zz} (ref dirRoot()) for Spinor
+	inline
+	std::pair<std::complex<double>, std::complex<double> >
+	spinSplitArgs
+		( Spinor const & spin
+		)
+	{
+		// biv*biv = -magSq(biv) so that zz = I*magnitude(biv)
+		return
+			{ std::complex<double>{ spin.theSca.theData[0] + 0., 0. }
+			, std::complex<double>{ 0., magnitude(spin.theBiv) }
+			};
+	}
+
+} // [priv]
+
+	/*! \brief Simultaneous {sinh(), cosh()} of a MultiVector.
+	 *
+	 * Both values are computed from a single set of transcendental
+	 * function evaluations (using the ComPlex/DirPlex split, ref log()).
+	 */
+	inline
+	std::pair<MultiVector, MultiVector>
+	sinhcosh
+		( MultiVector const & mv
+		)
+	{
+		Engabra_INSTR_FUNC("sinhcosh", MultiVector, 90u);
+		std::pair<MultiVector, MultiVector> result
+			{ null<MultiVector>(), null<MultiVector>() };
+		if (isValid(mv))
+		{
+			std::array<std::complex<double>, 4u> const splits
+				{ priv::splitSinhCosh(priv::comPart(mv), priv::dirRoot(mv)) };
+			result = priv::pairFromSplit(splits, mv);
+		}
+		return result;
+	}
+
+	//! Simultaneous {sinh(), cosh()} of a Spinor.
+	inline
+	std::pair<Spinor, Spinor>
+	sinhcosh
+		( Spinor const & spin
+		)
+	{
+		Engabra_INSTR_FUNC("sinhcosh", Spinor, 60u);
+		std::pair<Spinor, Spinor> result{ null<Spinor>(), null<Spinor>() };
+		if (isValid(spin))
+		{
+			std::pair<std::complex<double>, std::complex<double> > const args
+				{ priv::spinSplitArgs(spin) };
+			std::array<std::complex<double>, 4u> const splits
+				{ priv::splitSinhCosh(args.first, args.second) };
+			result = priv::pairFromSplit(splits, spin);
+		}
+		return result;
+	}
+
+	//! Simultaneous {sinh(), cosh()} of a BiVector (as Spinors).
+	inline
+	std::pair<Spinor, Spinor>
+	sinhcosh
+		( BiVector const & biv
+		)
+	{
+		Engabra_INSTR_FUNC("sinhcosh", BiVector, 60u);
+		return sinhcosh(Spinor{ 0., biv });
+	}
+
+	//! Simultaneous {sinh(), cosh()} of a ComPlex.
+	inline
+	std::pair<ComPlex, ComPlex>
+	sinhcosh
+		( ComPlex const & cplx
+		)
+	{
+		Engabra_INSTR_FUNC("sinhcosh", ComPlex, 20u);
+		std::pair<ComPlex, ComPlex> result
+			{ null<ComPlex>(), null<ComPlex>() };
+		if (isValid(cplx))
+		{
+			std::complex<double> const cc
+				{ cplx.theSca.theData[0] + 0., cplx.theTri.theData[0] + 0. };
+			std::array<std::complex<double>, 4u> const splits
+				{ priv::splitSinhCosh(cc, std::complex<double>{ 0., 0. }) };
+			result = { ComPlex::from(splits[0]), ComPlex::from(splits[2]) };
+		}
+		return result;
+	}
+
+	//! Hyperbolic sine of BiVector (ref sinhcosh() for evaluating both)
+	inline
+	Spinor
+	sinh
+		( BiVector const & biv
+		)
+	{
+		Engabra_INSTR_FUNC("sinh", BiVector, 60u);
+		return sinhcosh(biv).first;
+	}
+
+	//! Hyperbolic sine of Spinor (ref sinhcosh() for evaluating both)
+	inline
+	Spinor
+	sinh
+		( Spinor const & spin
+		)
+	{
+		Engabra_INSTR_FUNC("sinh", Spinor, 60u);
+		return sinhcosh(spin).first;
+	}
+
+	//! Hyperbolic sine of ComPlex (ref sinhcosh() for evaluating both)
+	inline
+	ComPlex
+	sinh
+		( ComPlex const & cplx
+		)
+	{
+		Engabra_INSTR_FUNC("sinh", ComPlex, 20u);
+		return sinhcosh(cplx).first;
+	}
+
+	//! Hyperbolic sine of MultiVector (ref sinhcosh() for evaluating both)
+	inline
+	MultiVector
+	sinh
+		( MultiVector const & mv
+		)
+	{
+		Engabra_INSTR_FUNC("sinh", MultiVector, 90u);
+		return sinhcosh(mv).first;
+	}
+
+	//! Hyperbolic cosine of BiVector (ref sinhcosh() for evaluating both)
+	inline
+	Spinor
+	cosh
+		( BiVector const & biv
+		)
+	{
+		Engabra_INSTR_FUNC("cosh", BiVector, 60u);
+		return sinhcosh(biv).second;
+	}
+
+	//! Hyperbolic cosine of Spinor (ref sinhcosh() for evaluating both)
+	inline
+	Spinor
+	cosh
+		( Spinor const & spin
+		)
+	{
+		Engabra_INSTR_FUNC("cosh", Spinor, 60u);
+		return sinhcosh(spin).second;
+	}
+
+	//! Hyperbolic cosine of ComPlex (ref sinhcosh() for evaluating both)
+	inline
+	ComPlex
+	cosh
+		( ComPlex const & cplx
+		)
+	{
+		Engabra_INSTR_FUNC("cosh", ComPlex, 20u);
+		return sinhcosh(cplx).second;
+	}
+
+	//! Hyperbolic cosine of MultiVector (ref sinhcosh() for evaluating both)
+	inline
+	MultiVector
+	cosh
+		( MultiVector const & mv
+		)
+	{
+		Engabra_INSTR_FUNC("cosh", MultiVector, 90u);
+		return sinhcosh(mv).second;
+	}
+
+	/*! \brief Simultaneous {sin(), cos()} of a MultiVector.
+	 *
+	 * Both values are computed from a single set of transcendental
+	 * function evaluations (using the ComPlex/DirPlex split, ref log()).
+	 */
+	inline
+	std::pair<MultiVector, MultiVector>
+	sincos
+		( MultiVector const & mv
+		)
+	{
+		Engabra_INSTR_FUNC("sincos", MultiVector, 90u);
+		std::pair<MultiVector, MultiVector> result
+			{ null<MultiVector>(), null<MultiVector>() };
+		if (isValid(mv))
+		{
+			std::array<std::complex<double>, 4u> const splits
+				{ priv::splitSinCos(priv::comPart(mv), priv::dirRoot(mv)) };
+			result = priv::pairFromSplit(splits, mv);
+		}
+		return result;
+	}
+
+	//! Simultaneous {sin(), cos()} of a Spinor.
+	inline
+	std::pair<Spinor, Spinor>
+	sincos
+		( Spinor const & spin
+		)
+	{
+		Engabra_INSTR_FUNC("sincos", Spinor, 60u);
+		std::pair<Spinor, Spinor> result{ null<Spinor>(), null<Spinor>() };
+		if (isValid(spin))
+		{
+			std::pair<std::complex<double>, std::complex<double> > const args
+				{ priv::spinSplitArgs(spin) };
+			std::array<std::complex<double>, 4u> const splits
+				{ priv::splitSinCos(args.first, args.second) };
+			result = priv::pairFromSplit(splits, spin);
+		}
+		return result;
+	}
+
+	//! Simultaneous {sin(), cos()} of a BiVector (as Spinors).
+	inline
+	std::pair<Spinor, Spinor>
+	sincos
+		( BiVector const & biv
+		)
+	{
+		Engabra_INSTR_FUNC("sincos", BiVector, 60u);
+		return sincos(Spinor{ 0., biv });
+	}
+
+	//! Simultaneous {sin(), cos()} of a ComPlex.
+	inline
+	std::pair<ComPlex, ComPlex>
+	sincos
+		( ComPlex const & cplx
+		)
+	{
+		Engabra_INSTR_FUNC("sincos", ComPlex, 20u);
+		std::pair<ComPlex, ComPlex> result
+			{ null<ComPlex>(), null<ComPlex>() };
+		if (isValid(cplx))
+		{
+			std::complex<double> const cc
+				{ cplx.theSca.theData[0] + 0., cplx.theTri.theData[0] + 0. };
+			std::array<std::complex<double>, 4u> const splits
+				{ priv::splitSinCos(cc, std::complex<double>{ 0., 0. }) };
+			result = { ComPlex::from(splits[0]), ComPlex::from(splits[2]) };
+		}
+		return result;
+	}
+
+	//! Circular sine of BiVector (ref sincos() for evaluating both)
+	inline
+	Spinor
+	sin
+		( BiVector const & biv
+		)
+	{
+		Engabra_INSTR_FUNC("sin", BiVector, 60u);
+		return sincos(biv).first;
+	}
+
+	//! Circular sine of Spinor (ref sincos() for evaluating both)
+	inline
+	Spinor
+	sin
+		( Spinor const & spin
+		)
+	{
+		Engabra_INSTR_FUNC("sin", Spinor, 60u);
+		return sincos(spin).first;
+	}
+
+	//! Circular sine of ComPlex (ref sincos() for evaluating both)
+	inline
+	ComPlex
+	sin
+		( ComPlex const & cplx
+		)
+	{
+		Engabra_INSTR_FUNC("sin", ComPlex, 20u);
+		return sincos(cplx).first;
+	}
+
+	//! Circular sine of MultiVector (ref sincos() for evaluating both)
+	inline
+	MultiVector
+	sin
+		( MultiVector const & mv
+		)
+	{
+		Engabra_INSTR_FUNC("sin", MultiVector, 90u);
+		return sincos(mv).first;
+	}
+
+	//! Circular cosine of BiVector (ref sincos() for evaluating both)
+	inline
+	Spinor
+	cos
+		( BiVector const & biv
+		)
+	{
+		Engabra_INSTR_FUNC("cos", BiVector, 60u);
+		return sincos(biv).second;
+	}
+
+	//! Circular cosine of Spinor (ref sincos() for evaluating both)
+	inline
+	Spinor
+	cos
+		( Spinor const & spin
+		)
+	{
+		Engabra_INSTR_FUNC("cos", Spinor, 60u);
+		return sincos(spin).second;
+	}
+
+	//! Circular cosine of ComPlex (ref sincos() for evaluating both)
+	inline
+	ComPlex
+	cos
+		( ComPlex const & cplx
+		)
+	{
+		Engabra_INSTR_FUNC("cos", ComPlex, 20u);
+		return sincos(cplx).second;
+	}
+
+	//! Circular cosine of MultiVector (ref sincos() for evaluating both)
+	inline
+	MultiVector
+	cos
+		( MultiVector const & mv
+		)
+	{
+		Engabra_INSTR_FUNC("cos", MultiVector, 90u);
+		return sincos(mv).second;
+	}
+
 	//
 	// TBD/TODO
 	//
@@ -0,0 +1,394 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3ingest_INCL_
+#define engabra_g3ingest_INCL_
+
+/*! \file
+\brief Parallel ingestion of (large) text files of g3 entities.
+
+\b Overview
+
+Text data with one entity per line (components separated by
+whitespace and/or commas) is parsed concurrently into a contiguous
+array of a chosen g3 type:
+
+\arg The text is split into chunks (one per thread) at line boundaries
+and each chunk is parsed independently. Results are concatenated in
+line order such that the result is independent of the thread count.
+
+\arg Blank lines and comment lines (with '#' as first non-blank
+character) are skipped.
+
+\arg Lines that cannot be parsed (e.g. too few or too many values, or
+invalid numbers) produce a null entity in the result (as with the
+g3io.hpp extraction operators) and a LineError entry reporting the
+(1-based) line number and item index.
+
+Streams (and files) are ingested in blocks (of bounded size) such that
+memory use is independent of file size (other than for the result).
+
+Example:
+\snippet test_g3ingest_all.cpp DoxyExample01
+
+*/
+
+
+#include "g3_parallel.hpp"
+#include "g3const.hpp"
+#include "g3type.hpp"
+#include "g3validity.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+namespace io
+{
+	//! Location of a text line that could not be parsed
+	struct LineError
+	{
+		//! Line number (1-based) within the input
+		std::size_t theLineNum;
+
+		//! Index of the (null) entity in Ingested::theItems
+		std::size_t theNdxItem;
+	};
+
+	//! Entities and errors from ingestText() and related functions
+	template <typename Type>
+	struct Ingested
+	{
+		//! Entities in line order (null for lines in theErrors)
+		std::vector<Type> theItems{};
+
+		//! Lines that could not be parsed
+		std::vector<LineError> theErrors{};
+
+		//! Number of lines processed (including blanks and comments)
+		std::size_t theNumLines{ 0u };
+
+		//! Append other (following lines) onto this instance
+		inline
+		void
+		append
+			( Ingested const & other
+			)
+		{
+			for (LineError const & err : other.theErrors)
+			{
+				theErrors.emplace_back
+					( LineError
+						{ theNumLines + err.theLineNum
+						, theItems.size() + err.theNdxItem
+						}
+					);
+			}
+			theItems.insert
+				( theItems.end()
+				, other.theItems.cbegin(), other.theItems.cend()
+				);
+			theNumLines += other.theNumLines;
+		}
+	};
+
+namespace priv
+{
+	//! Minimum number of bytes (per thread) for which threads are started.
+	constexpr std::size_t sIngestMinBytes{ 1024u * 1024u };
+
+	//! Number of double components in g3 Type
+	template <typename Type>
+	constexpr std::size_t sNumDoubles{ sizeof(Type) / sizeof(double) };
+
+	//! True for characters separating values
+	inline
+	bool
+	isSeparator
+		( char const & chr
+		)
+	{
+		return (' ' == chr) || ('\t' == chr) || (',' == chr) || ('\r' == chr);
+	}
+
+	/*! \brief Parse one line [beg, end) into item.
+	 *
+	 * Returns true if the line is to be skipped (blank or comment).
+	 * Assigns null to item if values cannot be parsed (or are invalid).
+	 */
+	template <typename Type>
+	inline
+	bool
+	parseLine
+		( char const * beg
+		, char const * const end
+		, Type & item
+		)
+	{
+		static_assert
+			( std::is_trivially_copyable<Type>::value
+			  && (0u == (sizeof(Type) % sizeof(double)))
+			, "Type must be composed (only) of double values"
+			);
+		constexpr std::size_t numComps{ sNumDoubles<Type> };
+
+		while ((beg < end) && isSeparator(*beg))
+		{
+			++beg;
+		}
+		bool const isSkip{ (end == beg) || ('#' == *beg) };
+		if (! isSkip)
+		{
+			std::array<double, numComps> comps;
+			bool okay{ true };
+			for (std::size_t nn{0u} ; okay && (nn < numComps) ; ++nn)
+			{
+				if ((beg < end) && ('+' == *beg))
+				{
+					++beg; // from_chars() does not accept leading '+'
+				}
+				std::from_chars_result const res
+					{ std::from_chars(beg, end, comps[nn]) };
+				okay = (std::errc{} == res.ec) && isValid(comps[nn]);
+				beg = res.ptr;
+				// require separator (or end) after each value
+				okay &= (end == beg) || isSeparator(*beg);
+				while ((beg < end) && isSeparator(*beg))
+				{
+					++beg;
+				}
+			}
+			okay &= (end == beg); // no extra values
+			if (okay)
+			{
+				std::memcpy(&item, comps.data(), sizeof(Type));
+			}
+			else
+			{
+				item = null<Type>();
+			}
+		}
+		return isSkip;
+	}
+
+	/*! \brief Parse lines that start within [ndxBeg, ndxEnd) of text.
+	 *
+	 * Line numbers and item indices in the result are relative to the
+	 * first line starting in the range.
+	 */
+	template <typename Type>
+	inline
+	Ingested<Type>
+	ingestRange
+		( char const * const text
+		, std::size_t const & numChars
+		, std::size_t const & ndxBeg
+		, std::size_t const & ndxEnd
+		)
+	{
+		Ingested<Type> result;
+		char const * const textEnd{ text + numChars };
+		char const * lineBeg{ text + ndxBeg };
+		if ((0u < ndxBeg) && ('\n' != text[ndxBeg - 1u]))
+		{
+			// first line starting in range is after next newline
+			char const * const eol
+				{ static_cast<char const *>
+					(std::memchr(lineBeg, '\n', numChars - ndxBeg))
+				};
+			lineBeg = (eol) ? (eol + 1) : textEnd;
+		}
+		char const * const rangeEnd{ text + ndxEnd };
+		while (lineBeg < rangeEnd)
+		{
+			std::size_t const numLeft
+				{ static_cast<std::size_t>(textEnd - lineBeg) };
+			char const * const eol
+				{ static_cast<char const *>
+					(std::memchr(lineBeg, '\n', numLeft))
+				};
+			char const * const lineEnd{ (eol) ? eol : textEnd };
+			++result.theNumLines;
+			Type item;
+			if (! parseLine(lineBeg, lineEnd, item))
+			{
+				if (! isValid(item))
+				{
+					LineError const err
+						{ result.theNumLines, result.theItems.size() };
+					result.theErrors.emplace_back(err);
+				}
+				result.theItems.emplace_back(item);
+			}
+			lineBeg = (eol) ? (eol + 1) : textEnd;
+		}
+		return result;
+	}
+
+} // [priv]
+
+	/*! \brief Entities parsed from text characters [text, text+numChars).
+	 *
+	 * Chunks of text are parsed concurrently with (up to) numThreads
+	 * threads (zero for hardware concurrency).
+	 */
+	template <typename Type>
+	inline
+	Ingested<Type>
+	ingestText
+		( char const * const text
+		, std::size_t const & numChars
+		, std::size_t const & numThreads = 0u
+		)
+	{
+		std::vector<Ingested<Type> > const parts
+			{ g3::priv::parallelPartials<Ingested<Type> >
+				( numChars
+				, [&text, &numChars]
+					(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+					{
+						return priv::ingestRange<Type>
+							(text, numChars, ndxBeg, ndxEnd);
+					}
+				, numThreads
+				, priv::sIngestMinBytes
+				)
+			};
+		Ingested<Type> result;
+		std::size_t numItems{ 0u };
+		for (Ingested<Type> const & part : parts)
+		{
+			numItems += part.theItems.size();
+		}
+		result.theItems.reserve(numItems);
+		for (Ingested<Type> const & part : parts)
+		{
+			result.append(part);
+		}
+		return result;
+	}
+
+	//! Entities parsed from text string (ref ingestText())
+	template <typename Type>
+	inline
+	Ingested<Type>
+	ingestText
+		( std::string const & text
+		, std::size_t const & numThreads = 0u
+		)
+	{
+		return ingestText<Type>(text.data(), text.size(), numThreads);
+	}
+
+	/*! \brief Entities parsed from stream (in blocks of about blockSize).
+	 *
+	 * Each block (extended to a line boundary) is processed with
+	 * ingestText() such that memory use (other than for the result) is
+	 * bounded by about blockSize.
+	 */
+	template <typename Type>
+	inline
+	Ingested<Type>
+	ingestStream
+		( std::istream & istrm
+		, std::size_t const & numThreads = 0u
+		, std::size_t const & blockSize = 64u * 1024u * 1024u
+		)
+	{
+		Ingested<Type> result;
+		std::string block;
+		std::string tail; // partial line carried to next block
+		std::vector<char> buf(std::max(blockSize, std::size_t{ 1u }));
+		while (istrm)
+		{
+			istrm.read(buf.data(), static_cast<std::streamsize>(buf.size()));
+			std::size_t const numGot
+				{ static_cast<std::size_t>(istrm.gcount()) };
+			block.assign(tail);
+			block.append(buf.data(), numGot);
+			std::size_t numUse{ block.size() };
+			if (istrm) // more data may follow: hold back partial line
+			{
+				std::size_t const ndxLast{ block.rfind('\n') };
+				numUse = (std::string::npos == ndxLast) ? 0u : (ndxLast + 1u);
+			}
+			tail.assign(block, numUse, std::string::npos);
+			if (0u < numUse)
+			{
+				result.append
+					(ingestText<Type>(block.data(), numUse, numThreads));
+			}
+		}
+		return result;
+	}
+
+	/*! \brief Entities parsed from file at path (ref ingestStream()).
+	 *
+	 * If the file cannot be opened, the result has no items and a single
+	 * LineError with line number zero.
+	 */
+	template <typename Type>
+	inline
+	Ingested<Type>
+	ingestFile
+		( std::string const & path
+		, std::size_t const & numThreads = 0u
+		)
+	{
+		Ingested<Type> result;
+		std::ifstream ifs(path, std::ios::binary);
+		if (ifs.is_open())
+		{
+			result = ingestStream<Type>(ifs, numThreads);
+		}
+		else
+		{
+			result.theErrors.emplace_back(LineError{ 0u, 0u });
+		}
+		return result;
+	}
+
+} // [io]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3ingest_INCL_
@@ -0,0 +1,509 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3instr_INCL_
+#define engabra_g3instr_INCL_
+
+/*! \file
+\brief Optional operation count (and flop estimate) instrumentation.
+
+\b Overview
+
+If the preprocessor symbol Engabra_Instrument is defined (e.g. via
+cmake -DEngabra_Instrument=ON, or before including any engabra header),
+each operator overload (from g3ops*.hpp files) and each principal
+function (from g3func.hpp) counts the number of times it is called.
+Otherwise, the instrumentation macros expand to nothing and there is no
+run time cost.
+
+Only calls from outside of instrumented code are counted (e.g. the
+operator*() calls made inside exp() are not), such that the counts
+indicate which operations application code actually uses. Each count is
+accompanied by a (rough) estimate of floating point operations based on
+the number of components involved (for functions, with transcendental
+library calls counted as one operation each).
+
+Counters are kept per thread (each updated only by its own thread
+without locking) and are aggregated on demand by siteCounts() or
+report(). Function reportAtExit() arranges for report() to std::clog at
+program exit.
+
+\note Symbol Engabra_Instrument must be consistently defined (or not)
+for all translation units of a program.
+
+Example:
+\snippet test_g3instr_all.cpp DoxyExample01
+
+*/
+
+
+#include "g3type.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(Engabra_Instrument)
+#	include <algorithm>
+#	include <array>
+#	include <atomic>
+#	include <cstdlib>
+#	include <iomanip>
+#	include <iostream>
+#	include <mutex>
+#endif
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+//! Operation count instrumentation (ref g3instr.hpp)
+namespace instr
+{
+	//! Aggregated calls for one instrumented site (operation overload)
+	struct SiteCount
+	{
+		//! Operation identity (e.g. "Spinor*Vector", "exp(BiVector)")
+		std::string theName{};
+
+		//! Number of (externally made) calls
+		std::uint64_t theNumCalls{ 0u };
+
+		//! Estimated number of floating point operations for all calls
+		std::uint64_t theNumFlops{ 0u };
+	};
+
+namespace priv
+{
+	//! Name of (g3) Type for use in site names
+	template <typename Type>
+	constexpr
+	char const *
+	nameOf
+		()
+	{
+		if constexpr (std::is_same_v<Type, double>) { return "double"; }
+		else if constexpr (std::is_same_v<Type, Scalar>) { return "Scalar"; }
+		else if constexpr (std::is_same_v<Type, Vector>) { return "Vector"; }
+		else if constexpr (std::is_same_v<Type, BiVector>)
+			{ return "BiVector"; }
+		else if constexpr (std::is_same_v<Type, TriVector>)
+			{ return "TriVector"; }
+		else if constexpr (std::is_same_v<Type, Spinor>) { return "Spinor"; }
+		else if constexpr (std::is_same_v<Type, ImSpin>) { return "ImSpin"; }
+		else if constexpr (std::is_same_v<Type, ComPlex>)
+			{ return "ComPlex"; }
+		else if constexpr (std::is_same_v<Type, DirPlex>)
+			{ return "DirPlex"; }
+		else if constexpr (std::is_same_v<Type, MultiVector>)
+			{ return "MultiVector"; }
+		else { return "?"; }
+	}
+
+	//! Number of double components in Type
+	template <typename Type>
+	constexpr std::uint64_t sNumComp{ sizeof(Type) / sizeof(double) };
+
+	/*! \brief Estimated flops for binary operation (op is "+","-","*")
+	 *
+	 * Products: each pair of components is multiplied and results are
+	 * summed into output components. Sums: one operation for each
+	 * component common to both arguments.
+	 */
+	template <typename TypeA, typename TypeB, typename TypeOut>
+	constexpr
+	std::uint64_t
+	flopsBinary
+		( char const * const & op
+		)
+	{
+		constexpr std::uint64_t nA{ sNumComp<TypeA> };
+		constexpr std::uint64_t nB{ sNumComp<TypeB> };
+		constexpr std::uint64_t nOut{ sNumComp<TypeOut> };
+		std::uint64_t flops{ 0u };
+		if ('*' == op[0])
+		{
+			constexpr std::uint64_t nProd{ nA * nB };
+			flops = nProd + ((nOut < nProd) ? (nProd - nOut) : 0u);
+		}
+		else
+		if (nOut < (nA + nB))
+		{
+			flops = (nA + nB) - nOut;
+		}
+		return flops;
+	}
+
+} // [priv]
+
+#if defined(Engabra_Instrument)
+
+	//! True if instrumentation is compiled in
+	constexpr bool sIsEnabled{ true };
+
+namespace priv
+{
+	//! Maximum number of distinct sites (last one collects overflow)
+	constexpr std::size_t sMaxSites{ 1024u };
+
+	//! Call counters for one thread (updated only by that thread)
+	struct ThreadCounts
+	{
+		//! Calls per site index
+		std::array<std::atomic<std::uint64_t>, sMaxSites> theCalls{};
+
+		//! Nesting depth of instrumented calls in progress
+		std::size_t theDepth{ 0u };
+
+		inline
+		ThreadCounts
+			();
+
+		inline
+		~ThreadCounts
+			();
+	};
+
+	//! Site descriptions and collection of active thread counters
+	struct Registry
+	{
+		std::mutex theMutex{}; //!< Guards all members
+		std::array<std::string, sMaxSites> theNames{}; //!< Per site
+		std::array<std::uint64_t, sMaxSites> theFlops{}; //!< Per call
+		std::size_t theNumSites{ 0u }; //!< Sites registered so far
+		std::vector<ThreadCounts *> theThreads{}; //!< Active threads
+		std::array<std::uint64_t, sMaxSites> theRetired{}; //!< Exited
+	};
+
+	//! Process wide registry instance
+	inline
+	Registry &
+	registry
+		()
+	{
+		static Registry reg;
+		return reg;
+	}
+
+	//! Register thread counters with registry
+	ThreadCounts :: ThreadCounts
+		()
+	{
+		Registry & reg = registry();
+		std::lock_guard<std::mutex> lock(reg.theMutex);
+		reg.theThreads.emplace_back(this);
+	}
+
+	//! Fold thread counts into retired totals (and unregister)
+	ThreadCounts :: ~ThreadCounts
+		()
+	{
+		Registry & reg = registry();
+		std::lock_guard<std::mutex> lock(reg.theMutex);
+		for (std::size_t ndx{ 0u } ; ndx < reg.theNumSites ; ++ndx)
+		{
+			reg.theRetired[ndx]
+				+= theCalls[ndx].load(std::memory_order_relaxed);
+		}
+		reg.theThreads.erase
+			( std::remove(reg.theThreads.begin(), reg.theThreads.end(), this)
+			, reg.theThreads.end()
+			);
+	}
+
+	//! Counters for current thread
+	inline
+	ThreadCounts &
+	threadCounts
+		()
+	{
+		thread_local ThreadCounts counts;
+		return counts;
+	}
+
+	//! Register a new site and return its index
+	inline
+	std::size_t
+	siteIndex
+		( std::string const & name
+		, std::uint64_t const & flopsPerCall
+		)
+	{
+		Registry & reg = registry();
+		std::lock_guard<std::mutex> lock(reg.theMutex);
+		std::size_t ndx{ reg.theNumSites };
+		if (ndx < (sMaxSites - 1u))
+		{
+			reg.theNames[ndx] = name;
+			reg.theFlops[ndx] = flopsPerCall;
+			++reg.theNumSites;
+		}
+		else
+		{
+			ndx = sMaxSites - 1u;
+			reg.theNames[ndx] = "(other)";
+			reg.theNumSites = sMaxSites;
+		}
+		return ndx;
+	}
+
+	//! Counts call at site (if not nested within another instrumented call)
+	struct Scope
+	{
+		ThreadCounts & theCounts; //!< Counters for this thread
+
+		//! Count call (if outermost)
+		explicit
+		Scope
+			( std::size_t const & ndx
+			)
+			: theCounts{ threadCounts() }
+		{
+			if (0u == theCounts.theDepth)
+			{
+				std::atomic<std::uint64_t> & count = theCounts.theCalls[ndx];
+				count.store
+					( count.load(std::memory_order_relaxed) + 1u
+					, std::memory_order_relaxed
+					);
+			}
+			++theCounts.theDepth;
+		}
+
+		Scope(Scope const &) = delete;
+		Scope & operator=(Scope const &) = delete;
+
+		//! End of call
+		~Scope
+			()
+		{
+			--theCounts.theDepth;
+		}
+	};
+
+} // [priv]
+
+	/*! \brief Counts for all sites called so far (most called first).
+	 *
+	 * Includes counts from exited threads and (current values from)
+	 * running threads.
+	 */
+	inline
+	std::vector<SiteCount>
+	siteCounts
+		()
+	{
+		std::vector<SiteCount> counts;
+		priv::Registry & reg = priv::registry();
+		std::lock_guard<std::mutex> lock(reg.theMutex);
+		for (std::size_t ndx{ 0u } ; ndx < reg.theNumSites ; ++ndx)
+		{
+			std::uint64_t numCalls{ reg.theRetired[ndx] };
+			for (priv::ThreadCounts const * const & ptThread : reg.theThreads)
+			{
+				numCalls += ptThread->theCalls[ndx]
+					.load(std::memory_order_relaxed);
+			}
+			if (0u < numCalls)
+			{
+				counts.emplace_back
+					(SiteCount{ reg.theNames[ndx], numCalls
+						, numCalls * reg.theFlops[ndx] }
+					);
+			}
+		}
+		std::stable_sort
+			( counts.begin(), counts.end()
+			, [] (SiteCount const & sc1, SiteCount const & sc2)
+				{ return (sc2.theNumCalls < sc1.theNumCalls); }
+			);
+		return counts;
+	}
+
+	/*! \brief Set all counts to zero.
+	 *
+	 * \note Should be called while no other threads are making calls.
+	 */
+	inline
+	void
+	reset
+		()
+	{
+		priv::Registry & reg = priv::registry();
+		std::lock_guard<std::mutex> lock(reg.theMutex);
+		reg.theRetired.fill(0u);
+		for (priv::ThreadCounts * const & ptThread : reg.theThreads)
+		{
+			for (std::atomic<std::uint64_t> & count : ptThread->theCalls)
+			{
+				count.store(0u, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	//! Table of siteCounts() (and totals) to ostrm
+	inline
+	void
+	report
+		( std::ostream & ostrm
+		)
+	{
+		std::vector<SiteCount> const counts{ siteCounts() };
+		std::uint64_t sumCalls{ 0u };
+		std::uint64_t sumFlops{ 0u };
+		ostrm << "# engabra instrumentation: calls, est.flops, operation\n";
+		for (SiteCount const & count : counts)
+		{
+			ostrm
+				<< std::setw(14u) << count.theNumCalls
+				<< ' ' << std::setw(16u) << count.theNumFlops
+				<< ' ' << count.theName
+				<< '\n';
+			sumCalls += count.theNumCalls;
+			sumFlops += count.theNumFlops;
+		}
+		ostrm
+			<< std::setw(14u) << sumCalls
+			<< ' ' << std::setw(16u) << sumFlops
+			<< ' ' << "(total)"
+			<< '\n';
+	}
+
+	/*! \brief Arrange for report() to std::clog at program exit (once).
+	 *
+	 * The registry (and counters for this thread) are constructed here,
+	 * before the handler is registered, such that they are destroyed
+	 * only after the handler has run (e.g. if called first in main()).
+	 */
+	inline
+	void
+	reportAtExit
+		()
+	{
+		(void)priv::registry();
+		(void)priv::threadCounts();
+		static bool const isSet
+			{ 0 == std::atexit([] () { report(std::clog); }) };
+		(void)isSet;
+	}
+
+#else // Engabra_Instrument
+
+	//! True if instrumentation is compiled in
+	constexpr bool sIsEnabled{ false };
+
+	//! Empty (instrumentation is not compiled in)
+	inline
+	std::vector<SiteCount>
+	siteCounts
+		()
+	{
+		return {};
+	}
+
+	//! Does nothing (instrumentation is not compiled in)
+	inline
+	void
+	reset
+		()
+	{ }
+
+	//! Note that instrumentation is not compiled in
+	inline
+	void
+	report
+		( std::ostream & ostrm
+		)
+	{
+		ostrm << "# engabra instrumentation: disabled\n";
+	}
+
+	//! Does nothing (instrumentation is not compiled in)
+	inline
+	void
+	reportAtExit
+		()
+	{ }
+
+#endif // Engabra_Instrument
+
+} // [instr]
+
+} // [g3]
+
+} // [engabra]
+
+
+#if defined(Engabra_Instrument)
+
+	//! Count call to site name (with flops estimated per call)
+#	define Engabra_INSTR_SITE(name, flops) \
+		static std::size_t const engabraInstrNdx \
+			{ ::engabra::g3::instr::priv::siteIndex((name), (flops)) }; \
+		::engabra::g3::instr::priv::Scope const engabraInstrScope \
+			{ engabraInstrNdx }
+
+	//! Count call to binary operator op ("+","-","*") on A,B giving Out
+#	define Engabra_INSTR_OP(op, TypeA, TypeB, TypeOut) \
+		Engabra_INSTR_SITE \
+			( std::string(::engabra::g3::instr::priv::nameOf<TypeA>()) \
+				+ (op) + ::engabra::g3::instr::priv::nameOf<TypeB>() \
+			, (::engabra::g3::instr::priv::flopsBinary \
+				<TypeA, TypeB, TypeOut>(op)) \
+			)
+
+	//! Count call to unary operator op on Type
+#	define Engabra_INSTR_UNI(op, Type) \
+		Engabra_INSTR_SITE \
+			( std::string(op) + ::engabra::g3::instr::priv::nameOf<Type>() \
+			, (::engabra::g3::instr::priv::sNumComp<Type>) \
+			)
+
+	//! Count call to function name with argument Type
+#	define Engabra_INSTR_FUNC(name, Type, flops) \
+		Engabra_INSTR_SITE \
+			( std::string(name) + "(" \
+				+ ::engabra::g3::instr::priv::nameOf<Type>() + ")" \
+			, (flops) \
+			)
+
+#else
+
+#	define Engabra_INSTR_SITE(name, flops)
+#	define Engabra_INSTR_OP(op, TypeA, TypeB, TypeOut)
+#	define Engabra_INSTR_UNI(op, Type)
+#	define Engabra_INSTR_FUNC(name, Type, flops)
+
+#endif // Engabra_Instrument
+
+
+#endif // engabra_g3instr_INCL_
@@ -0,0 +1,368 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3jacobian_INCL_
+#define engabra_g3jacobian_INCL_
+
+/*! \file
+\brief Analytic Jacobians for exp(), logG2() and spinor rotation.
+
+\b Overview
+
+Optimization over attitudes commonly parameterizes rotation by the
+bivector argument, B, of the spinor, S = exp(B). The functions here
+return function values together with their (closed form) partial
+derivatives as fixed size, row-major, arrays:
+
+\arg expJac() - Spinor exp(B) and 4x3 Jacobian. Rows correspond to
+Spinor components (sca, e23, e31, e12) and columns to the bivector
+components of B (e23, e31, e12).
+
+\arg logG2Jac() - Spinor logG2(S) and 4x4 Jacobian with respect to the
+four Spinor components of S.
+
+\arg rotateJac() - Vector exp(B)*v*reverse(exp(B)) and 3x3 Jacobian
+with respect to the bivector components of B.
+
+Terms that involve ratios of trigonometric functions are evaluated with
+series expansions near zero angle such that the Jacobians are accurate
+for arbitrarily small bivectors.
+
+Example:
+\snippet test_g3jacobian_all.cpp DoxyExample01
+
+Batch versions are provided in namespace batch.
+
+*/
+
+
+#include "g3const.hpp"
+#include "g3func.hpp"
+#include "g3ops.hpp"
+#include "g3type.hpp"
+#include "g3validity.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+	//! Jacobian (row major) of 4 values with respect to 3 parameters.
+	using Jac4x3 = std::array<double, 12u>;
+
+	//! Jacobian (row major) of 4 values with respect to 4 parameters.
+	using Jac4x4 = std::array<double, 16u>;
+
+	//! Jacobian (row major) of 3 values with respect to 3 parameters.
+	using Jac3x3 = std::array<double, 9u>;
+
+namespace priv
+{
+	/*! \brief Values sin(t)/t and (cos(t)-sin(t)/t)/t^2 for angle t.
+	 *
+	 * The second is the radial derivative factor of sin(t)/t, i.e.
+	 * d(sin(t)/t)/dt = t * (second value).
+	 */
+	inline
+	std::pair<double, double>
+	sincAndDeriv
+		( double const & angle
+		)
+	{
+		double const tSq{ angle * angle };
+		std::pair<double, double> result;
+		if (1.e-3 < angle)
+		{
+			double const sinc{ std::sin(angle) / angle };
+			result = { sinc, (std::cos(angle) - sinc) / tSq };
+		}
+		else
+		{
+			result =
+				{ 1. + tSq * (-1./6. + tSq * (1./120.))
+				, -1./3. + tSq * (1./30. - tSq * (1./840.))
+				};
+		}
+		return result;
+	}
+
+} // [priv]
+
+	/*! \brief Spinor exp(biv) and its Jacobian with respect to biv.
+	 *
+	 * Ref file description for Jacobian layout.
+	 */
+	inline
+	std::pair<Spinor, Jac4x3>
+	expJac
+		( BiVector const & biv
+		)
+	{
+		std::array<double, 3u> const & bb = biv.theData;
+		double const angle{ magnitude(biv) };
+		std::pair<double, double> const sd{ priv::sincAndDeriv(angle) };
+		double const & sinc = sd.first;
+		double const & dsinc = sd.second;
+
+		Spinor const spin{ std::cos(angle), sinc * biv };
+		Jac4x3 jac;
+		for (std::size_t col{0u} ; col < 3u ; ++col)
+		{
+			// d(cos(t))/db = -sin(t) * b/t
+			jac[col] = -sinc * bb[col];
+			for (std::size_t row{0u} ; row < 3u ; ++row)
+			{
+				double const diag{ (row == col) ? sinc : 0. };
+				jac[3u*(row + 1u) + col] = diag + dsinc * bb[row] * bb[col];
+			}
+		}
+		return { spin, jac };
+	}
+
+	/*! \brief Spinor logG2(spin) and its Jacobian with respect to spin.
+	 *
+	 * The Jacobian is null wherever logG2() uses its half turn special
+	 * case (bivector direction undefined) and for spinors for which
+	 * logG2() is null (null spinors or magnitude not above epsilon).
+	 */
+	inline
+	std::pair<Spinor, Jac4x4>
+	logG2Jac
+		( Spinor const & spin
+		)
+	{
+		Jac4x4 jac;
+		jac.fill(nan);
+
+		double const & aa = spin.theSca.theData[0];
+		std::array<double, 3u> const & bb = spin.theBiv.theData;
+		double const mSq{ magSq(spin.theBiv) };
+		double const mm{ std::sqrt(mSq) };
+		double const rSq{ aa*aa + mSq };
+		// same zero magnitude and half turn tests as for logG2()
+		constexpr double eps{ std::numeric_limits<double>::epsilon() };
+		constexpr double almostOne{ 1. - eps };
+		double const spinMag{ std::sqrt(rSq) };
+		bool const hasLog{ (eps < spinMag) };
+		bool const isSmall{ (mm < (1.e-4 * aa)) };
+		bool const isHalfTurn{ hasLog && ((aa / spinMag) < (-almostOne)) };
+		if (isValid(spin) && hasLog && (! isHalfTurn))
+		{
+			// bivector scale, phi, and factor (dphi/dm)/m
+			double phi;
+			double dPhiByM;
+			if (isSmall)
+			{
+				double const ia{ 1. / aa };
+				double const xSq{ mSq * ia * ia };
+				phi = ia * (1. + xSq * (-1./3. + xSq * (1./5.)));
+				dPhiByM = ia*ia*ia * (-2./3. + xSq * (4./5.));
+			}
+			else
+			{
+				phi = std::atan2(mm, aa) / mm;
+				dPhiByM = (aa / rSq - phi) / mSq;
+			}
+
+			double const invRSq{ 1. / rSq };
+			// scalar row: d(ln|S|)
+			jac[0] = aa * invRSq;
+			for (std::size_t col{0u} ; col < 3u ; ++col)
+			{
+				jac[1u + col] = bb[col] * invRSq;
+			}
+			// bivector rows: d(phi * b)
+			for (std::size_t row{0u} ; row < 3u ; ++row)
+			{
+				jac[4u*(row + 1u)] = -bb[row] * invRSq;
+				for (std::size_t col{0u} ; col < 3u ; ++col)
+				{
+					double const diag{ (row == col) ? phi : 0. };
+					jac[4u*(row + 1u) + 1u + col]
+						= diag + dPhiByM * bb[row] * bb[col];
+				}
+			}
+		}
+		return { logG2(spin), jac };
+	}
+
+	/*! \brief Vector rotated by exp(biv) and Jacobian with respect to biv.
+	 *
+	 * The rotated vector is exp(biv)*vec*reverse(exp(biv)).
+	 */
+	inline
+	std::pair<Vector, Jac3x3>
+	rotateJac
+		( BiVector const & biv
+		, Vector const & vec
+		)
+	{
+		std::pair<Spinor, Jac4x3> const sj{ expJac(biv) };
+		Spinor const & spin = sj.first;
+		Jac4x3 const & jacExp = sj.second;
+		Spinor const spinRev{ reverse(spin) };
+
+		// partials of sandwich w.r.t. each spinor component:
+		// d(S*v*rev(S))/ds_k = 2 * <E_k * v * rev(S)>_1
+		ImSpin const vs{ vec * spinRev };
+		std::array<Vector, 4u> const dRot
+			{ 2. * vs.theVec
+			, 2. * (e23 * vs).theVec
+			, 2. * (e31 * vs).theVec
+			, 2. * (e12 * vs).theVec
+			};
+
+		Jac3x3 jac;
+		for (std::size_t row{0u} ; row < 3u ; ++row)
+		{
+			for (std::size_t col{0u} ; col < 3u ; ++col)
+			{
+				double sum{ 0. };
+				for (std::size_t kk{0u} ; kk < 4u ; ++kk)
+				{
+					sum += dRot[kk].theData[row] * jacExp[3u*kk + col];
+				}
+				jac[3u*row + col] = sum;
+			}
+		}
+		Vector const rot{ (spin * vs).theVec };
+		return { rot, jac };
+	}
+
+
+namespace batch
+{
+	/*! \brief Evaluate expJac() for each bivector in range.
+	 *
+	 * Spinor values are written to itVal and Jacobians to itJac. The
+	 * return contains both output iterators advanced past the end.
+	 */
+	template <typename InIter, typename OutIterVal, typename OutIterJac>
+	inline
+	std::pair<OutIterVal, OutIterJac>
+	expJac
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIterVal itVal
+		, OutIterJac itJac
+		)
+	{
+		for (InIter itIn{ itBeg } ; itEnd != itIn ; ++itIn)
+		{
+			std::pair<Spinor, Jac4x3> const sj{ g3::expJac(*itIn) };
+			*itVal++ = sj.first;
+			*itJac++ = sj.second;
+		}
+		return { itVal, itJac };
+	}
+
+	//! Evaluate logG2Jac() for each spinor in range (ref batch::expJac()).
+	template <typename InIter, typename OutIterVal, typename OutIterJac>
+	inline
+	std::pair<OutIterVal, OutIterJac>
+	logG2Jac
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIterVal itVal
+		, OutIterJac itJac
+		)
+	{
+		for (InIter itIn{ itBeg } ; itEnd != itIn ; ++itIn)
+		{
+			std::pair<Spinor, Jac4x4> const sj{ g3::logG2Jac(*itIn) };
+			*itVal++ = sj.first;
+			*itJac++ = sj.second;
+		}
+		return { itVal, itJac };
+	}
+
+	/*! \brief Evaluate rotateJac() for one bivector and many vectors.
+	 *
+	 * The exponential and its partials are evaluated once. Rotated
+	 * vectors are written to itVal and Jacobians to itJac.
+	 */
+	template <typename InIter, typename OutIterVal, typename OutIterJac>
+	inline
+	std::pair<OutIterVal, OutIterJac>
+	rotateJac
+		( BiVector const & biv
+		, InIter const & itBeg
+		, InIter const & itEnd
+		, OutIterVal itVal
+		, OutIterJac itJac
+		)
+	{
+		std::pair<Spinor, Jac4x3> const sj{ g3::expJac(biv) };
+		Spinor const & spin = sj.first;
+		Jac4x3 const & jacExp = sj.second;
+		Spinor const spinRev{ reverse(spin) };
+
+		// combine constant spinor partials into coefficients of the
+		// sandwich partials: d(rot)/db_j = 2 * <D_j * v * rev(S)>_1
+		// with D_j = sum_k (dS_k/db_j) E_k
+		std::array<Spinor, 3u> dSpins;
+		for (std::size_t col{0u} ; col < 3u ; ++col)
+		{
+			dSpins[col] = Spinor
+				{ jacExp[col]
+				, BiVector
+					{ jacExp[3u + col], jacExp[6u + col], jacExp[9u + col] }
+				};
+		}
+
+		for (InIter itIn{ itBeg } ; itEnd != itIn ; ++itIn)
+		{
+			ImSpin const vs{ (*itIn) * spinRev };
+			Jac3x3 jac;
+			for (std::size_t col{0u} ; col < 3u ; ++col)
+			{
+				Vector const dRot{ 2. * (dSpins[col] * vs).theVec };
+				jac[col] = dRot.theData[0];
+				jac[3u + col] = dRot.theData[1];
+				jac[6u + col] = dRot.theData[2];
+			}
+			*itVal++ = (spin * vs).theVec;
+			*itJac++ = jac;
+		}
+		return { itVal, itJac };
+	}
+
+} // [batch]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3jacobian_INCL_
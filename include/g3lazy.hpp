@@ -0,0 +1,698 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3lazy_INCL_
+#define engabra_g3lazy_INCL_
+
+/*! \file
+\brief Lazy (pull) streams of g3 entities for pipelined processing.
+
+\b Overview
+
+Processing of large inputs can be organized as a chain of stages in
+which each entity is produced, transformed and consumed one at a time
+(i.e. without materializing intermediate collections). Every stage here
+is a "source" that provides
+
+\arg value_type - type of entities produced
+
+\arg bool next(value_type & item) - assign next entity to item and
+return true, or return false when exhausted.
+
+Sources include:
+\arg fromRange() - entities from an iterator range (e.g. a buffer)
+\arg fromStream() - entities parsed from text (ref io::RecordReader)
+
+Stages are composed with operator|() and adaptors:
+\arg map(func) - transform each entity (e.g. rotate, exp, inverse)
+\arg filter(pred) - pass only entities satisfying predicate
+\arg threaded(capacity) - evaluate all upstream stages on a separate
+thread, passing entities through a bounded queue (of given capacity)
+
+Sinks include forEach() and collect(). Sources can also be traversed
+with range-for loops (via begin() and end() on each source).
+
+Example:
+\snippet test_g3lazy_all.cpp DoxyExample01
+
+The facility uses C++17 pull iteration (rather than C++20 coroutines)
+consistent with the rest of the package.
+
+*/
+
+
+#include "g3record.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+//! Lazy (pull) stream sources, stages and sinks
+namespace lazy
+{
+	//
+	// Iteration support
+	//
+
+	//! Input iterator over a source (for range-for loops)
+	template <typename Source>
+	struct SourceIter
+	{
+		using iterator_category = std::input_iterator_tag;
+		using value_type = typename Source::value_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = value_type const *;
+		using reference = value_type const &;
+
+		//! Source being traversed (nullptr at end)
+		Source * theSource{ nullptr };
+
+		//! Current entity
+		value_type theItem{};
+
+		//! Iterator at first entity of source (or end if none)
+		explicit
+		SourceIter
+			( Source * const & source = nullptr
+			)
+			: theSource{ source }
+		{
+			advance();
+		}
+
+		//! Current entity
+		inline
+		reference
+		operator*
+			() const
+		{
+			return theItem;
+		}
+
+		//! Pull next entity from source
+		inline
+		SourceIter &
+		operator++
+			()
+		{
+			advance();
+			return *this;
+		}
+
+		//! Only end iterators compare equal
+		inline
+		bool
+		operator==
+			( SourceIter const & other
+			) const
+		{
+			return (theSource == other.theSource);
+		}
+
+		//! Inverse of operator==()
+		inline
+		bool
+		operator!=
+			( SourceIter const & other
+			) const
+		{
+			return (! operator==(other));
+		}
+
+	private:
+
+		//! Get next item (becoming end iterator if source is exhausted)
+		inline
+		void
+		advance
+			()
+		{
+			if (theSource && (! theSource->next(theItem)))
+			{
+				theSource = nullptr;
+			}
+		}
+	};
+
+	//! Common begin()/end() for Derived source types (CRTP base)
+	template <typename Derived>
+	struct Iterable
+	{
+		//! Iterator pulling from this source
+		inline
+		SourceIter<Derived>
+		begin
+			()
+		{
+			return SourceIter<Derived>(static_cast<Derived *>(this));
+		}
+
+		//! End (exhausted) iterator
+		inline
+		SourceIter<Derived>
+		end
+			()
+		{
+			return SourceIter<Derived>{};
+		}
+	};
+
+	//
+	// Sources
+	//
+
+	//! Source of entities from iterator range
+	template <typename InIter>
+	struct RangeSource : public Iterable<RangeSource<InIter> >
+	{
+		//! Type of entity produced
+		using value_type = typename std::iterator_traits<InIter>::value_type;
+
+		InIter theIt; //!< Next position
+		InIter theEnd; //!< End of range
+
+		//! Assign next entity (if any)
+		inline
+		bool
+		next
+			( value_type & item
+			)
+		{
+			bool const okay{ theEnd != theIt };
+			if (okay)
+			{
+				item = *theIt;
+				++theIt;
+			}
+			return okay;
+		}
+	};
+
+	//! Source producing entities from [itBeg, itEnd)
+	template <typename InIter>
+	inline
+	RangeSource<InIter>
+	fromRange
+		( InIter const & itBeg
+		, InIter const & itEnd
+		)
+	{
+		return RangeSource<InIter>{ {}, itBeg, itEnd };
+	}
+
+	/*! \brief Source of entities parsed from text lines.
+	 *
+	 * Each (non blank, non comment) line provides one entity (with
+	 * components separated by theDelim). Lines that cannot be parsed
+	 * produce null entities (ref io::RecordReader).
+	 */
+	template <typename Type>
+	struct StreamSource : public Iterable<StreamSource<Type> >
+	{
+		//! Type of entity produced
+		using value_type = Type;
+
+		//! Parser (reusing its line buffer)
+		io::RecordReader<Type> theReader;
+
+		//! Assign next entity (if any)
+		inline
+		bool
+		next
+			( value_type & item
+			)
+		{
+			bool const okay{ theReader.next() };
+			if (okay)
+			{
+				item = std::get<0>(theReader.theRecord);
+			}
+			return okay;
+		}
+	};
+
+	//! Source producing entities of Type parsed from istrm
+	template <typename Type>
+	inline
+	StreamSource<Type>
+	fromStream
+		( std::istream & istrm
+		, char const & delim = ' '
+		)
+	{
+		return StreamSource<Type>{ {}, io::RecordReader<Type>(istrm, delim) };
+	}
+
+	//
+	// Stages
+	//
+
+	//! Stage transforming each entity from upstream source
+	template <typename Source, typename Func>
+	struct Mapped : public Iterable<Mapped<Source, Func> >
+	{
+		//! Type of entity produced
+		using value_type = std::decay_t
+			< std::invoke_result_t
+				<Func, typename Source::value_type const &>
+			>;
+
+		Source theSource; //!< Upstream source
+		Func theFunc; //!< Transformation
+		typename Source::value_type theTmp{}; //!< Upstream entity
+
+		//! Assign next (transformed) entity (if any)
+		inline
+		bool
+		next
+			( value_type & item
+			)
+		{
+			bool const okay{ theSource.next(theTmp) };
+			if (okay)
+			{
+				item = theFunc(theTmp);
+			}
+			return okay;
+		}
+	};
+
+	//! Stage passing only entities for which predicate is true
+	template <typename Source, typename Pred>
+	struct Filtered : public Iterable<Filtered<Source, Pred> >
+	{
+		//! Type of entity produced
+		using value_type = typename Source::value_type;
+
+		Source theSource; //!< Upstream source
+		Pred thePred; //!< Test for entities to pass
+
+		//! Assign next (passing) entity (if any)
+		inline
+		bool
+		next
+			( value_type & item
+			)
+		{
+			bool okay{ theSource.next(item) };
+			while (okay && (! thePred(item)))
+			{
+				okay = theSource.next(item);
+			}
+			return okay;
+		}
+	};
+
+namespace priv
+{
+	/*! \brief Bounded (blocking) queue connecting producer and consumer.
+	 *
+	 * The producer calls push() until finish(). The consumer calls pop()
+	 * until it returns false, or calls close() to stop the producer.
+	 */
+	template <typename Type>
+	struct BoundedQueue
+	{
+		std::size_t theCapacity; //!< Maximum number of queued items
+		std::deque<Type> theItems{}; //!< Queued items
+		bool theIsFinished{ false }; //!< Producer is done
+		bool theIsClosed{ false }; //!< Consumer is done
+		std::mutex theMutex{}; //!< Guards members
+		std::condition_variable theCvPush{}; //!< Space available
+		std::condition_variable theCvPop{}; //!< Item (or finish) available
+
+		//! Construct with capacity (at least one)
+		explicit
+		BoundedQueue
+			( std::size_t const & capacity
+			)
+			: theCapacity{ std::max(capacity, std::size_t{ 1u }) }
+		{ }
+
+		//! Add item (blocking while full). False if consumer closed.
+		inline
+		bool
+		push
+			( Type && item
+			)
+		{
+			std::unique_lock<std::mutex> lock(theMutex);
+			theCvPush.wait
+				( lock
+				, [this] ()
+					{ return theIsClosed || (theItems.size() < theCapacity); }
+				);
+			bool const okay{ ! theIsClosed };
+			if (okay)
+			{
+				theItems.emplace_back(std::move(item));
+				theCvPop.notify_one();
+			}
+			return okay;
+		}
+
+		//! Indicate that no more items will be pushed
+		inline
+		void
+		finish
+			()
+		{
+			std::lock_guard<std::mutex> lock(theMutex);
+			theIsFinished = true;
+			theCvPop.notify_one();
+		}
+
+		//! Indicate that no more items will be popped
+		inline
+		void
+		close
+			()
+		{
+			std::lock_guard<std::mutex> lock(theMutex);
+			theIsClosed = true;
+			theCvPush.notify_one();
+		}
+
+		//! Remove next item (blocking while empty). False when finished.
+		inline
+		bool
+		pop
+			( Type & item
+			)
+		{
+			std::unique_lock<std::mutex> lock(theMutex);
+			theCvPop.wait
+				( lock
+				, [this] () { return theIsFinished || (! theItems.empty()); }
+				);
+			bool const okay{ ! theItems.empty() };
+			if (okay)
+			{
+				item = std::move(theItems.front());
+				theItems.pop_front();
+				theCvPush.notify_one();
+			}
+			return okay;
+		}
+	};
+
+} // [priv]
+
+	/*! \brief Stage evaluating upstream source on a separate thread.
+	 *
+	 * The worker thread starts at the first call to next(). Entities
+	 * are passed through a queue of bounded capacity (such that a fast
+	 * producer blocks rather than consuming unbounded memory). If this
+	 * stage is destroyed before the source is exhausted, the worker is
+	 * stopped (after completing its current entity).
+	 *
+	 * The source and queue are held in heap storage (used by the worker)
+	 * such that this stage may be moved at any time. An exception thrown
+	 * by the source (on the worker thread) ends the stream and is
+	 * rethrown from next() after all previously queued entities.
+	 */
+	template <typename Source>
+	struct Threaded : public Iterable<Threaded<Source> >
+	{
+		//! Type of entity produced
+		using value_type = typename Source::value_type;
+
+		//! Data shared with worker thread
+		struct Shared
+		{
+			Source theSource; //!< Upstream source (used by worker thread)
+			priv::BoundedQueue<value_type> theQueue; //!< Passed entities
+			std::exception_ptr theError{}; //!< Exception from source
+
+			//! Take ownership of source
+			Shared
+				( Source && source
+				, std::size_t const & capacity
+				)
+				: theSource{ std::move(source) }
+				, theQueue(capacity)
+			{ }
+		};
+
+		std::unique_ptr<Shared> theShared; //!< Stable for worker thread
+		std::thread theWorker{}; //!< Thread evaluating upstream stages
+
+		//! Construct (without starting thread)
+		Threaded
+			( Source && source
+			, std::size_t const & capacity
+			)
+			: theShared
+				{ std::make_unique<Shared>(std::move(source), capacity) }
+		{ }
+
+		Threaded(Threaded &&) = default;
+		Threaded(Threaded const &) = delete;
+		Threaded & operator=(Threaded const &) = delete;
+		Threaded & operator=(Threaded &&) = delete;
+
+		//! Stop and join worker thread (if running)
+		~Threaded
+			()
+		{
+			if (theWorker.joinable())
+			{
+				theShared->theQueue.close();
+				theWorker.join();
+			}
+		}
+
+		//! Assign next entity from queue (if any)
+		inline
+		bool
+		next
+			( value_type & item
+			)
+		{
+			if (! theWorker.joinable())
+			{
+				start();
+			}
+			bool const okay{ theShared->theQueue.pop(item) };
+			if ((! okay) && theShared->theError)
+			{
+				// pop() synchronizes with finish() after error assignment
+				std::rethrow_exception(theShared->theError);
+			}
+			return okay;
+		}
+
+	private:
+
+		//! Start worker thread
+		inline
+		void
+		start
+			()
+		{
+			theWorker = std::thread
+				( [shared = theShared.get()] ()
+					{
+						try
+						{
+							value_type item;
+							while (shared->theSource.next(item))
+							{
+								if (! shared->theQueue.push(std::move(item)))
+								{
+									break; // consumer closed
+								}
+							}
+						}
+						catch (...)
+						{
+							shared->theError = std::current_exception();
+						}
+						shared->theQueue.finish();
+					}
+				);
+		}
+	};
+
+	//
+	// Adaptors and composition
+	//
+
+	//! Adaptor for map() stage
+	template <typename Func>
+	struct MapAdaptor
+	{
+		Func theFunc; //!< Transformation
+	};
+
+	//! Adaptor for filter() stage
+	template <typename Pred>
+	struct FilterAdaptor
+	{
+		Pred thePred; //!< Test for entities to pass
+	};
+
+	//! Adaptor for threaded() stage
+	struct ThreadAdaptor
+	{
+		std::size_t theCapacity; //!< Queue capacity
+	};
+
+	//! Adaptor: transform each entity with func
+	template <typename Func>
+	inline
+	MapAdaptor<Func>
+	map
+		( Func const & func
+		)
+	{
+		return MapAdaptor<Func>{ func };
+	}
+
+	//! Adaptor: pass entities for which pred(entity) is true
+	template <typename Pred>
+	inline
+	FilterAdaptor<Pred>
+	filter
+		( Pred const & pred
+		)
+	{
+		return FilterAdaptor<Pred>{ pred };
+	}
+
+	//! Adaptor: evaluate upstream stages on separate thread
+	inline
+	ThreadAdaptor
+	threaded
+		( std::size_t const & capacity = 1024u
+		)
+	{
+		return ThreadAdaptor{ capacity };
+	}
+
+	//! Compose source with map() stage
+	template <typename Source, typename Func>
+	inline
+	Mapped<std::decay_t<Source>, Func>
+	operator|
+		( Source && source
+		, MapAdaptor<Func> const & adaptor
+		)
+	{
+		return Mapped<std::decay_t<Source>, Func>
+			{ {}, std::forward<Source>(source), adaptor.theFunc, {} };
+	}
+
+	//! Compose source with filter() stage
+	template <typename Source, typename Pred>
+	inline
+	Filtered<std::decay_t<Source>, Pred>
+	operator|
+		( Source && source
+		, FilterAdaptor<Pred> const & adaptor
+		)
+	{
+		return Filtered<std::decay_t<Source>, Pred>
+			{ {}, std::forward<Source>(source), adaptor.thePred };
+	}
+
+	//! Compose source with threaded() stage
+	template <typename Source>
+	inline
+	Threaded<std::decay_t<Source> >
+	operator|
+		( Source && source
+		, ThreadAdaptor const & adaptor
+		)
+	{
+		using Upstream = std::decay_t<Source>;
+		return Threaded<Upstream>
+			(Upstream(std::forward<Source>(source)), adaptor.theCapacity);
+	}
+
+	//
+	// Sinks
+	//
+
+	//! Call func(entity) for each entity from source. Returns count.
+	template <typename Source, typename Func>
+	inline
+	std::size_t
+	forEach
+		( Source && source
+		, Func const & func
+		)
+	{
+		std::size_t count{ 0u };
+		typename std::decay_t<Source>::value_type item;
+		while (source.next(item))
+		{
+			func(item);
+			++count;
+		}
+		return count;
+	}
+
+	//! Assign each entity from source to itOut. Returns advanced itOut.
+	template <typename Source, typename OutIter>
+	inline
+	OutIter
+	collect
+		( Source && source
+		, OutIter itOut
+		)
+	{
+		forEach
+			( std::forward<Source>(source)
+			, [&itOut] (auto const & item) { *itOut++ = item; }
+			);
+		return itOut;
+	}
+
+} // [lazy]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3lazy_INCL_
@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsAdd_same.hpp"
 #include "g3opsAdd_Scalar.hpp"
 #include "g3opsAdd_Vector.hpp"
@@ -60,6 +61,7 @@ namespace g3
 		, Scalar const & sca
 		)
 	{
+		Engabra_INSTR_OP("+", BiVector, Scalar, Spinor);
 		return sca + biv;
 	}
 
@@ -71,6 +73,7 @@ namespace g3
 		, Vector const & vec
 		)
 	{
+		Engabra_INSTR_OP("+", BiVector, Vector, DirPlex);
 		return vec + biv;
 	}
 
@@ -90,6 +93,7 @@ namespace g3
 		, Spinor const & spin
 		)
 	{
+		Engabra_INSTR_OP("+", BiVector, Spinor, Spinor);
 		return Spinor{ spin.theSca, biv + spin.theBiv };
 	}
 
@@ -103,6 +107,7 @@ namespace g3
 		, DirPlex const & dplx
 		)
 	{
+		Engabra_INSTR_OP("+", BiVector, DirPlex, DirPlex);
 		return DirPlex{ dplx.theVec, biv + dplx.theBiv };
 	}
 
@@ -114,6 +119,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("+", BiVector, MultiVector, MultiVector);
 		return MultiVector
 			{ mv.theSca
 			, mv.theVec
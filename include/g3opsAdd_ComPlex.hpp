@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsAdd_same.hpp"
 #include "g3opsAdd_Scalar.hpp"
 #include "g3opsAdd_TriVector.hpp"
@@ -61,6 +62,7 @@ namespace g3
 		, Scalar const & sca
 		)
 	{
+		Engabra_INSTR_OP("+", ComPlex, Scalar, ComPlex);
 		return sca + cplx;
 	}
 
@@ -76,6 +78,7 @@ namespace g3
 		, TriVector const & tri
 		)
 	{
+		Engabra_INSTR_OP("+", ComPlex, TriVector, ComPlex);
 		return tri + cplx;
 	}
 
@@ -97,6 +100,7 @@ namespace g3
 		, DirPlex const & dplx
 		)
 	{
+		Engabra_INSTR_OP("+", ComPlex, DirPlex, MultiVector);
 		return MultiVector
 			{ cplx.theSca
 			, dplx.theVec
@@ -113,6 +117,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("+", ComPlex, MultiVector, MultiVector);
 		return MultiVector
 			{ cplx.theSca + mv.theSca
 			, mv.theVec
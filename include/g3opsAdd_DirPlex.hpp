@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsAdd_same.hpp"
 #include "g3opsAdd_Vector.hpp"
 #include "g3opsAdd_BiVector.hpp"
@@ -64,6 +65,7 @@ namespace g3
 		, Vector const & vec
 		)
 	{
+		Engabra_INSTR_OP("+", DirPlex, Vector, DirPlex);
 		return vec + dplx;
 	}
 
@@ -75,6 +77,7 @@ namespace g3
 		, BiVector const & biv
 		)
 	{
+		Engabra_INSTR_OP("+", DirPlex, BiVector, DirPlex);
 		return biv + dplx;
 	}
 
@@ -92,6 +95,7 @@ namespace g3
 		, ComPlex const & cplx
 		)
 	{
+		Engabra_INSTR_OP("+", DirPlex, ComPlex, MultiVector);
 		return cplx + dplx;
 	}
 
@@ -109,6 +113,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("+", DirPlex, MultiVector, MultiVector);
 		return MultiVector
 			{ mv.theSca
 			, dplx.theVec + mv.theVec
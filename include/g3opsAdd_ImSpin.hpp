@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsAdd_same.hpp"
 #include "g3opsAdd_Vector.hpp"
 #include "g3opsAdd_TriVector.hpp"
@@ -63,6 +64,7 @@ namespace g3
 		, Vector const & vec
 		)
 	{
+		Engabra_INSTR_OP("+", ImSpin, Vector, ImSpin);
 		return vec + imsp;
 	}
 
@@ -76,6 +78,7 @@ namespace g3
 		, TriVector const & tri
 		)
 	{
+		Engabra_INSTR_OP("+", ImSpin, TriVector, ImSpin);
 		return tri + imsp;
 	}
 
@@ -87,6 +90,7 @@ namespace g3
 		, Spinor const & spin
 		)
 	{
+		Engabra_INSTR_OP("+", ImSpin, Spinor, MultiVector);
 		return spin + imsp;
 	}
 
@@ -108,6 +112,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("+", ImSpin, MultiVector, MultiVector);
 		return MultiVector
 			{ mv.theSca
 			, imsp.theVec + mv.theVec
@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsAdd_same.hpp"
 #include "g3opsAdd_Scalar.hpp"
 #include "g3opsAdd_Vector.hpp"
@@ -67,6 +68,7 @@ namespace g3
 		, Scalar const & sca
 		)
 	{
+		Engabra_INSTR_OP("+", MultiVector, Scalar, MultiVector);
 		return sca + mv;
 	}
 
@@ -78,6 +80,7 @@ namespace g3
 		, Vector const & vec
 		)
 	{
+		Engabra_INSTR_OP("+", MultiVector, Vector, MultiVector);
 		return vec + mv;
 	}
 
@@ -89,6 +92,7 @@ namespace g3
 		, BiVector const & biv
 		)
 	{
+		Engabra_INSTR_OP("+", MultiVector, BiVector, MultiVector);
 		return biv + mv;
 	}
 
@@ -100,6 +104,7 @@ namespace g3
 		, TriVector const & tri
 		)
 	{
+		Engabra_INSTR_OP("+", MultiVector, TriVector, MultiVector);
 		return tri + mv;
 	}
 
@@ -111,6 +116,7 @@ namespace g3
 		, Spinor const & spin
 		)
 	{
+		Engabra_INSTR_OP("+", MultiVector, Spinor, MultiVector);
 		return spin + mv;
 	}
 
@@ -122,6 +128,7 @@ namespace g3
 		, ImSpin const & imsp
 		)
 	{
+		Engabra_INSTR_OP("+", MultiVector, ImSpin, MultiVector);
 		return imsp + mv;
 	}
 
@@ -133,6 +140,7 @@ namespace g3
 		, ComPlex const & cplx
 		)
 	{
+		Engabra_INSTR_OP("+", MultiVector, ComPlex, MultiVector);
 		return cplx + mv;
 	}
 
@@ -144,6 +152,7 @@ namespace g3
 		, DirPlex const & dplx
 		)
 	{
+		Engabra_INSTR_OP("+", MultiVector, DirPlex, MultiVector);
 		return dplx + mv;
 	}
 
@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsAdd_same.hpp"
 
 
@@ -61,6 +62,7 @@ namespace g3
 		, BiVector const & biv
 		)
 	{
+		Engabra_INSTR_OP("+", Scalar, BiVector, Spinor);
 		return Spinor{ sca, biv };
 	}
 
@@ -72,6 +74,7 @@ namespace g3
 		, TriVector const & tri
 		)
 	{
+		Engabra_INSTR_OP("+", Scalar, TriVector, ComPlex);
 		return ComPlex{ sca, tri };
 	}
 
@@ -83,6 +86,7 @@ namespace g3
 		, Spinor const & spin
 		)
 	{
+		Engabra_INSTR_OP("+", Scalar, Spinor, Spinor);
 		return
 			{ sca + spin.theSca
 			, spin.theBiv
@@ -99,6 +103,7 @@ namespace g3
 		, ComPlex const & cplx
 		)
 	{
+		Engabra_INSTR_OP("+", Scalar, ComPlex, ComPlex);
 		return ComPlex
 			{ sca + cplx.theSca
 			, cplx.theTri
@@ -115,6 +120,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("+", Scalar, MultiVector, MultiVector);
 		return MultiVector
 			{ sca + mv.theSca
 			, mv.theVec
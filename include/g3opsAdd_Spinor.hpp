@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsAdd_same.hpp"
 #include "g3opsAdd_Scalar.hpp"
 #include "g3opsAdd_BiVector.hpp"
@@ -60,6 +61,7 @@ namespace g3
 		, Scalar const & sca
 		)
 	{
+		Engabra_INSTR_OP("+", Spinor, Scalar, Spinor);
 		return sca + spin;
 	}
 
@@ -73,6 +75,7 @@ namespace g3
 		, BiVector const & biv
 		)
 	{
+		Engabra_INSTR_OP("+", Spinor, BiVector, Spinor);
 		return biv + spin;
 	}
 
@@ -92,6 +95,7 @@ namespace g3
 		, ImSpin const & imsp
 		)
 	{
+		Engabra_INSTR_OP("+", Spinor, ImSpin, MultiVector);
 		return MultiVector
 			{ spin.theSca
 			, imsp.theVec
@@ -112,6 +116,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("+", Spinor, MultiVector, MultiVector);
 		return MultiVector
 			{ spin.theSca + mv.theSca
 			, mv.theVec
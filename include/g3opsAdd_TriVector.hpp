@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsAdd_same.hpp"
 #include "g3opsAdd_Scalar.hpp"
 #include "g3opsAdd_Vector.hpp"
@@ -60,6 +61,7 @@ namespace g3
 		, Scalar const & sca
 		)
 	{
+		Engabra_INSTR_OP("+", TriVector, Scalar, ComPlex);
 		return sca + tri;
 	}
 
@@ -71,6 +73,7 @@ namespace g3
 		, Vector const & vec
 		)
 	{
+		Engabra_INSTR_OP("+", TriVector, Vector, ImSpin);
 		return vec + tri;
 	}
 
@@ -92,6 +95,7 @@ namespace g3
 		, ImSpin const & imsp
 		)
 	{
+		Engabra_INSTR_OP("+", TriVector, ImSpin, ImSpin);
 		return ImSpin{ imsp.theVec, tri + imsp.theTri };
 	}
 
@@ -103,6 +107,7 @@ namespace g3
 		, ComPlex const & cplx
 		)
 	{
+		Engabra_INSTR_OP("+", TriVector, ComPlex, ComPlex);
 		return ComPlex{ cplx.theSca, tri + cplx.theTri };
 	}
 
@@ -116,6 +121,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("+", TriVector, MultiVector, MultiVector);
 		return MultiVector
 			{ mv.theSca
 			, mv.theVec
@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsAdd_same.hpp"
 
 
@@ -65,6 +66,7 @@ namespace g3
 		, BiVector const & biv
 		)
 	{
+		Engabra_INSTR_OP("+", Vector, BiVector, DirPlex);
 		return DirPlex{ vec, biv };
 	}
 
@@ -76,6 +78,7 @@ namespace g3
 		, TriVector const & tri
 		)
 	{
+		Engabra_INSTR_OP("+", Vector, TriVector, ImSpin);
 		return ImSpin{ vec, tri };
 	}
 
@@ -87,6 +90,7 @@ namespace g3
 		, ImSpin const & imsp
 		)
 	{
+		Engabra_INSTR_OP("+", Vector, ImSpin, ImSpin);
 		return ImSpin
 			{ vec + imsp.theVec
 			, imsp.theTri
@@ -103,6 +107,7 @@ namespace g3
 		, DirPlex const & dplx
 		)
 	{
+		Engabra_INSTR_OP("+", Vector, DirPlex, DirPlex);
 		return DirPlex
 			{ vec + dplx.theVec
 			, dplx.theBiv
@@ -117,6 +122,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("+", Vector, MultiVector, MultiVector);
 		return MultiVector
 			{ mv.theSca
 			, vec + mv.theVec
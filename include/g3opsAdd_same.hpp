@@ -39,6 +39,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 #include "g3_private.hpp"
 
 #include <algorithm>
@@ -67,6 +68,7 @@ namespace g3
 		, Blade const & bladeB
 		)
 	{
+		Engabra_INSTR_OP("+", Blade, Blade, Blade);
 		return priv::binaryElementByElement
 			( bladeA
 			, bladeB
@@ -89,6 +91,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("+", Spinor, Spinor, Spinor);
 		return Spinor
 			{ spinA.theSca + spinB.theSca
 			, spinA.theBiv + spinB.theBiv
@@ -103,6 +106,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("+", ImSpin, ImSpin, ImSpin);
 		return ImSpin
 			{ imspA.theVec + imspB.theVec
 			, imspA.theTri + imspB.theTri
@@ -117,6 +121,7 @@ namespace g3
 		, ComPlex const & cplxB
 		)
 	{
+		Engabra_INSTR_OP("+", ComPlex, ComPlex, ComPlex);
 		return ComPlex
 			{ cplxA.theSca + cplxB.theSca
 			, cplxA.theTri + cplxB.theTri
@@ -131,6 +136,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("+", DirPlex, DirPlex, DirPlex);
 		return DirPlex
 			{ dplxA.theVec + dplxB.theVec
 			, dplxA.theBiv + dplxB.theBiv
@@ -145,6 +151,7 @@ namespace g3
 		, MultiVector const & mvB
 		)
 	{
+		Engabra_INSTR_OP("+", MultiVector, MultiVector, MultiVector);
 		return MultiVector
 			{ mvA.theSca + mvB.theSca
 			, mvA.theVec + mvB.theVec
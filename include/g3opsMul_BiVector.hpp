@@ -37,6 +37,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 
 #include "g3_private.hpp"
 #include "g3opsAdd.hpp"
@@ -70,6 +71,7 @@ namespace g3
 		, double const & dubB
 		)
 	{
+		Engabra_INSTR_OP("*", BiVector, double, BiVector);
 		return dubB * bivA;
 	}
 
@@ -86,6 +88,7 @@ namespace g3
 		, Scalar const & scaB
 		)
 	{
+		Engabra_INSTR_OP("*", BiVector, Scalar, BiVector);
 		return scaB * bivA;
 	}
 
@@ -102,6 +105,7 @@ namespace g3
 		, Vector const & vecB
 		)
 	{
+		Engabra_INSTR_OP("*", BiVector, Vector, ImSpin);
 		// B*v = B.v + B^v = (-I*b).v + B^v
 		Vector const anti{ priv::prodAnti(bivA.theData, vecB.theData) };
 		TriVector const symm{ priv::prodComm(bivA.theData, vecB.theData) };
@@ -125,6 +129,7 @@ namespace g3
 		, BiVector const & bivB
 		)
 	{
+		Engabra_INSTR_OP("*", BiVector, BiVector, Spinor);
 		Scalar const symm{ priv::prodComm(bivA.theData, bivB.theData) };
 		BiVector const anti{ priv::prodAnti(bivA.theData, bivB.theData) };
 		// note negation (e.g. A*B = I*a*I*b = I*I*a*b = -a*b)
@@ -156,6 +161,7 @@ namespace g3
 		, TriVector const & triB
 		)
 	{
+		Engabra_INSTR_OP("*", BiVector, TriVector, Vector);
 		// V = B*T = (-Ib)*(Is)
 		return Vector
 			{ - triB.theData[0] * bivA.theData[0]
@@ -177,6 +183,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("*", BiVector, Spinor, Spinor);
 		BiVector const & b1 = bivA;
 		double const & s2 = spinB.theSca.theData[0];
 		BiVector const & b2 = spinB.theBiv;
@@ -212,6 +219,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("*", BiVector, ImSpin, ImSpin);
 		BiVector const & b1 = bivA;
 		Vector const & v2 = imspB.theVec;
 		TriVector const & t2 = imspB.theTri;
@@ -247,6 +255,7 @@ namespace g3
 		, ComPlex const & cplxB
 		)
 	{
+		Engabra_INSTR_OP("*", BiVector, ComPlex, DirPlex);
 		BiVector const & b1 = bivA;
 		Scalar const & s2 = cplxB.theSca;
 		TriVector const & t2 = cplxB.theTri;
@@ -281,6 +290,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("*", BiVector, DirPlex, MultiVector);
 		BiVector const & b1 = bivA;
 		Vector const & v2 = dplxB.theVec;
 		BiVector const & b2 = dplxB.theBiv;
@@ -321,6 +331,7 @@ namespace g3
 		, MultiVector const & mvB
 		)
 	{
+		Engabra_INSTR_OP("*", BiVector, MultiVector, MultiVector);
 		BiVector const & b1 = bivA;
 		Scalar const & s2 = mvB.theSca;
 		Vector const & v2 = mvB.theVec;
@@ -37,6 +37,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 
 #include "g3_private.hpp"
 
@@ -75,6 +76,7 @@ namespace g3
 		, double const & dubB
 		)
 	{
+		Engabra_INSTR_OP("*", ComPlex, double, ComPlex);
 		return dubB * cplxA; // ComPlex type is commuting
 	}
 
@@ -90,6 +92,7 @@ namespace g3
 		, Scalar const & scaB
 		)
 	{
+		Engabra_INSTR_OP("*", ComPlex, Scalar, ComPlex);
 		return scaB * cplxA; // ComPlex type is commuting
 	}
 
@@ -105,6 +108,7 @@ namespace g3
 		, Vector const & vecB
 		)
 	{
+		Engabra_INSTR_OP("*", ComPlex, Vector, DirPlex);
 		return vecB * cplxA; // ComPlex type is commuting
 	}
 
@@ -120,6 +124,7 @@ namespace g3
 		, BiVector const & bivB
 		)
 	{
+		Engabra_INSTR_OP("*", ComPlex, BiVector, DirPlex);
 		return bivB * cplxA; // ComPlex type is commuting
 	}
 
@@ -135,6 +140,7 @@ namespace g3
 		, TriVector const & triB
 		)
 	{
+		Engabra_INSTR_OP("*", ComPlex, TriVector, ComPlex);
 		return triB * cplxA; // ComPlex type is commuting
 	}
 
@@ -150,6 +156,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("*", ComPlex, Spinor, MultiVector);
 		return spinB * cplxA; // ComPlex type is commuting
 	}
 
@@ -165,6 +172,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("*", ComPlex, ImSpin, MultiVector);
 		return imspB * cplxA; // ComPlex type is commuting
 	}
 
@@ -184,6 +192,7 @@ namespace g3
 		, ComPlex const & cplxB
 		)
 	{
+		Engabra_INSTR_OP("*", ComPlex, ComPlex, ComPlex);
 		return ComPlex // classic complex multiply
 			{ Scalar
 				{ cplxA.theSca.theData[0] * cplxB.theSca.theData[0]
@@ -212,6 +221,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("*", ComPlex, DirPlex, DirPlex);
 		return DirPlex
 		{ Vector
 			{ cplxA.theSca * dplxB.theVec
@@ -236,6 +246,7 @@ namespace g3
 		, MultiVector const & mvecB
 		)
 	{
+		Engabra_INSTR_OP("*", ComPlex, MultiVector, MultiVector);
 		return MultiVector
 			{ cplxA.theSca * mvecB.theSca
 			+ cplxA.theTri * mvecB.theTri
@@ -37,6 +37,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 
 #include "g3_private.hpp"
 
@@ -76,6 +77,7 @@ namespace g3
 		, double const & dubB
 		)
 	{
+		Engabra_INSTR_OP("*", DirPlex, double, DirPlex);
 		return { dubB * dplxA }; // commutative
 	}
 
@@ -91,6 +93,7 @@ namespace g3
 		, Scalar const & scaB
 		)
 	{
+		Engabra_INSTR_OP("*", DirPlex, Scalar, DirPlex);
 		return { scaB * dplxA }; // commutative
 	}
 
@@ -106,6 +109,7 @@ namespace g3
 		, Vector const & vecB
 		)
 	{
+		Engabra_INSTR_OP("*", DirPlex, Vector, MultiVector);
 		Spinor const spin{ dplxA.theVec * vecB };
 		ImSpin const imspRev{ vecB * reverse(dplxA.theBiv) };
 		ImSpin const imsp{ reverse(imspRev) };
@@ -129,6 +133,7 @@ namespace g3
 		, BiVector const & bivB
 		)
 	{
+		Engabra_INSTR_OP("*", DirPlex, BiVector, MultiVector);
 		ImSpin const imsp{ dplxA.theVec * bivB };
 		Spinor const spinRev{ reverse(bivB) * reverse(dplxA.theBiv) };
 		Spinor const spin{ reverse(spinRev) };
@@ -152,6 +157,7 @@ namespace g3
 		, TriVector const & triB
 		)
 	{
+		Engabra_INSTR_OP("*", DirPlex, TriVector, DirPlex);
 		return DirPlex
 			{ dplxA.theBiv * triB
 			, dplxA.theVec * triB
@@ -170,6 +176,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("*", DirPlex, Spinor, MultiVector);
 		ImSpin const imsp{ dplxA.theVec * spinB.theBiv };
 		Spinor const spin{ dplxA.theBiv * spinB.theBiv };
 		return MultiVector
@@ -192,6 +199,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("*", DirPlex, ImSpin, MultiVector);
 		Spinor const spin{ dplxA.theVec * imspB.theVec };
 		ImSpin const imsp{ dplxA.theBiv * imspB.theVec };
 		return MultiVector
@@ -214,6 +222,7 @@ namespace g3
 		, ComPlex const & cplxB
 		)
 	{
+		Engabra_INSTR_OP("*", DirPlex, ComPlex, DirPlex);
 		return DirPlex
 			{ cplxB.theSca * dplxA.theVec
 			+ dplxA.theBiv * cplxB.theTri
@@ -238,6 +247,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("*", DirPlex, DirPlex, MultiVector);
 		Spinor const spin1{ dplxA.theVec * dplxB.theVec };
 		ImSpin const imsp1{ dplxA.theBiv * dplxB.theVec };
 		ImSpin const imsp2{ dplxA.theVec * dplxB.theBiv };
@@ -266,6 +276,7 @@ namespace g3
 		, MultiVector const & mvecB
 		)
 	{
+		Engabra_INSTR_OP("*", DirPlex, MultiVector, MultiVector);
 		Spinor const spin1{ dplxA.theVec * mvecB.theVec };
 		ImSpin const imsp1{ dplxA.theVec * mvecB.theBiv };
 		Spinor const spin2{ dplxA.theBiv * mvecB.theBiv };
@@ -37,6 +37,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 
 #include "g3_private.hpp"
 
@@ -74,6 +75,7 @@ namespace g3
 		, double const & dubB
 		)
 	{
+		Engabra_INSTR_OP("*", ImSpin, double, ImSpin);
 		return ImSpin{ dubB * imspA.theVec, dubB * imspA.theTri };
 	}
 
@@ -89,6 +91,7 @@ namespace g3
 		, Scalar const & scaB
 		)
 	{
+		Engabra_INSTR_OP("*", ImSpin, Scalar, ImSpin);
 		double const & dubB = scaB.theData[0];
 		return ImSpin{ dubB * imspA.theVec, dubB * imspA.theTri };
 	}
@@ -105,6 +108,7 @@ namespace g3
 		, Vector const & vecB
 		)
 	{
+		Engabra_INSTR_OP("*", ImSpin, Vector, Spinor);
 		// a.b + a^b + A*b
 		Spinor const spinAB{ imspA.theVec * vecB };
 		BiVector const bivAB{ imspA.theTri * vecB };
@@ -123,6 +127,7 @@ namespace g3
 		, BiVector const & bivB
 		)
 	{
+		Engabra_INSTR_OP("*", ImSpin, BiVector, ImSpin);
 		ImSpin const imsp1{ imspA.theVec * bivB };
 		Vector const vec1{ imspA.theTri * bivB };
 		return { imsp1.theVec + vec1, imsp1.theTri };
@@ -141,6 +146,7 @@ namespace g3
 		, TriVector const & triB
 		)
 	{
+		Engabra_INSTR_OP("*", ImSpin, TriVector, Spinor);
 		return triB*imspA;
 	}
 
@@ -156,6 +162,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("*", ImSpin, Spinor, ImSpin);
 		ImSpin const imsp1{ imspA.theVec * spinB };
 		ImSpin const imsp2{ imspA.theTri * spinB };
 		return ImSpin{ imsp1 + imsp2 };
@@ -177,6 +184,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("*", ImSpin, ImSpin, Spinor);
 		Spinor const spin1{ imspA.theVec * imspB };
 		Spinor const spin2{ imspA.theTri * imspB };
 		return Spinor{ spin1 + spin2 };
@@ -198,6 +206,7 @@ namespace g3
 		, ComPlex const & cplxB
 		)
 	{
+		Engabra_INSTR_OP("*", ImSpin, ComPlex, MultiVector);
 		return MultiVector
 			{ imspA.theTri * cplxB.theTri
 			, imspA.theVec * cplxB.theSca
@@ -218,6 +227,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("*", ImSpin, DirPlex, MultiVector);
 		Spinor const spin{ imspA.theVec * dplxB.theVec };
 		ImSpin const imsp{ imspA.theVec * dplxB.theBiv };
 		return MultiVector
@@ -240,6 +250,7 @@ namespace g3
 		, MultiVector const & mvB
 		)
 	{
+		Engabra_INSTR_OP("*", ImSpin, MultiVector, MultiVector);
 		return MultiVector
 			{ imspA.theVec * mvB
 			+ imspA.theTri * mvB
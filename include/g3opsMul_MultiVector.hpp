@@ -37,6 +37,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 
 #include "g3_private.hpp"
 
@@ -77,6 +78,7 @@ namespace g3
 		, double const dubB
 		)
 	{
+		Engabra_INSTR_OP("*", MultiVector, double, MultiVector);
 		return MultiVector
 			{ dubB * mvA.theSca
 			, dubB * mvA.theVec
@@ -97,6 +99,7 @@ namespace g3
 		, Scalar const scaB
 		)
 	{
+		Engabra_INSTR_OP("*", MultiVector, Scalar, MultiVector);
 		double const & dubB = scaB.theData[0];
 		return MultiVector
 			{ dubB * mvA.theSca
@@ -118,6 +121,7 @@ namespace g3
 		, Vector const vecB
 		)
 	{
+		Engabra_INSTR_OP("*", MultiVector, Vector, MultiVector);
 		Vector const vec1{ mvA.theSca * vecB };
 		Spinor const spin1{ mvA.theVec * vecB };
 		ImSpin const imsp1{ mvA.theBiv * vecB };
@@ -142,6 +146,7 @@ namespace g3
 		, BiVector const bivB
 		)
 	{
+		Engabra_INSTR_OP("*", MultiVector, BiVector, MultiVector);
 		BiVector const biv1{ mvA.theSca * bivB };
 		ImSpin const imsp1{ mvA.theVec * bivB };
 		Spinor const spin1{ mvA.theBiv * bivB };
@@ -166,6 +171,7 @@ namespace g3
 		, TriVector const triB
 		)
 	{
+		Engabra_INSTR_OP("*", MultiVector, TriVector, MultiVector);
 		TriVector const tri1{ mvA.theSca * triB };
 		BiVector const biv1{ mvA.theVec * triB };
 		Vector const vec1{ mvA.theBiv * triB };
@@ -185,6 +191,7 @@ namespace g3
 		, Spinor const spinB
 		)
 	{
+		Engabra_INSTR_OP("*", MultiVector, Spinor, MultiVector);
 		return MultiVector
 			( mvA * spinB.theSca
 			+ mvA * spinB.theBiv
@@ -203,6 +210,7 @@ namespace g3
 		, ImSpin const imspB
 		)
 	{
+		Engabra_INSTR_OP("*", MultiVector, ImSpin, MultiVector);
 		return MultiVector
 			( mvA * imspB.theVec
 			+ mvA * imspB.theTri
@@ -221,6 +229,7 @@ namespace g3
 		, ComPlex const & cplxB
 		)
 	{
+		Engabra_INSTR_OP("*", MultiVector, ComPlex, MultiVector);
 		return (cplxB * mvA); // commutative
 	}
 
@@ -236,6 +245,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("*", MultiVector, DirPlex, MultiVector);
 		Spinor const spin1{ mvA.theVec * dplxB.theVec };
 		ImSpin const imsp1{ mvA.theBiv * dplxB.theVec };
 		ImSpin const imsp2{ mvA.theVec * dplxB.theBiv };
@@ -284,6 +294,7 @@ namespace g3
 		, MultiVector const & mvB
 		)
 	{
+		Engabra_INSTR_OP("*", MultiVector, MultiVector, MultiVector);
 		MultiVector result{};
 
 		result.theSca.theData[0]
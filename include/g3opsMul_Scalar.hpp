@@ -37,6 +37,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 
 #include "g3opsMul_double.hpp"
 
@@ -64,6 +65,7 @@ namespace g3
 		, double const & dubB
 		)
 	{
+		Engabra_INSTR_OP("*", Scalar, double, Scalar);
 		return dubB * scaA;
 	}
 
@@ -84,6 +86,7 @@ namespace g3
 		, Scalar const & scaB
 		)
 	{
+		Engabra_INSTR_OP("*", Scalar, Scalar, Scalar);
 		return Scalar{ scaA.theData[0] * scaB.theData[0] };
 	}
 
@@ -104,6 +107,7 @@ namespace g3
 		, Vector const & vecB
 		)
 	{
+		Engabra_INSTR_OP("*", Scalar, Vector, Vector);
 		return Vector
 			{ scaA.theData[0] * vecB.theData[0]
 			, scaA.theData[0] * vecB.theData[1]
@@ -124,6 +128,7 @@ namespace g3
 		, BiVector const & bivB
 		)
 	{
+		Engabra_INSTR_OP("*", Scalar, BiVector, BiVector);
 		return BiVector
 			{ scaA.theData[0] * bivB.theData[0]
 			, scaA.theData[0] * bivB.theData[1]
@@ -144,6 +149,7 @@ namespace g3
 		, TriVector const & triB
 		)
 	{
+		Engabra_INSTR_OP("*", Scalar, TriVector, TriVector);
 		return TriVector{ scaA.theData[0] * triB.theData[0] };
 	}
 
@@ -160,6 +166,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("*", Scalar, Spinor, Spinor);
 		return Spinor
 			{ Scalar
 				{ scaA.theData[0] * spinB.theSca.theData[0] }
@@ -184,6 +191,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("*", Scalar, ImSpin, ImSpin);
 		return ImSpin
 			{ Vector
 				{ scaA.theData[0] * imspB.theVec.theData[0]
@@ -208,6 +216,7 @@ namespace g3
 		, ComPlex const & cplxB
 		)
 	{
+		Engabra_INSTR_OP("*", Scalar, ComPlex, ComPlex);
 		return ComPlex
 			{ scaA.theData[0] * cplxB.theSca.theData[0]
 			, scaA.theData[0] * cplxB.theTri.theData[0]
@@ -227,6 +236,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("*", Scalar, DirPlex, DirPlex);
 		return DirPlex
 			{ Vector
 				{ scaA.theData[0] * dplxB.theVec.theData[0]
@@ -254,6 +264,7 @@ namespace g3
 		, MultiVector const & mvB
 		)
 	{
+		Engabra_INSTR_OP("*", Scalar, MultiVector, MultiVector);
 		return MultiVector
 			{ Scalar
 				{ scaA.theData[0] * mvB.theSca.theData[0] }
@@ -37,6 +37,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 
 #include "g3_private.hpp"
 
@@ -73,6 +74,7 @@ namespace g3
 		, double const & dubB
 		)
 	{
+		Engabra_INSTR_OP("*", Spinor, double, Spinor);
 		return Spinor{ dubB * spinA.theSca, dubB * spinA.theBiv };
 	}
 
@@ -88,6 +90,7 @@ namespace g3
 		, Scalar const & scaB
 		)
 	{
+		Engabra_INSTR_OP("*", Spinor, Scalar, Spinor);
 		return Spinor
 			{ scaB.theData[0] * spinA.theSca
 			, scaB.theData[0] * spinA.theBiv
@@ -106,6 +109,7 @@ namespace g3
 		, Vector const & vecB
 		)
 	{
+		Engabra_INSTR_OP("*", Spinor, Vector, ImSpin);
 		// (Sca + Biv) * Vec
 		// (ScaA * VecB) + (BivA * VecB)
 		// (ScaA * VecB) + (BivA . VecB) + (BivA ^ VecB)
@@ -131,6 +135,7 @@ namespace g3
 		, BiVector const & bivB
 		)
 	{
+		Engabra_INSTR_OP("*", Spinor, BiVector, Spinor);
 		BiVector const biv1{ spinA.theSca * bivB };
 		Spinor const spin1{ spinA.theBiv * bivB };
 		return Spinor{ spin1.theSca, spin1.theBiv + biv1 };
@@ -148,6 +153,7 @@ namespace g3
 		, TriVector const & triB
 		)
 	{
+		Engabra_INSTR_OP("*", Spinor, TriVector, ImSpin);
 		return ImSpin{ triB * spinA.theBiv, triB * spinA.theSca };
 	}
 
@@ -167,6 +173,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("*", Spinor, Spinor, Spinor);
 		// access individual grades of each factor
 		double const & alpha = spinA.theSca.theData[0];
 		BiVector const & bivA = spinA.theBiv;
@@ -202,6 +209,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("*", Spinor, ImSpin, ImSpin);
 		ImSpin const imsp1{ spinA.theSca.theData[0] * imspB };
 		ImSpin const imsp2{ spinA.theBiv * imspB };
 		return { imsp1 + imsp2 };
@@ -219,6 +227,7 @@ namespace g3
 		, ComPlex const & cplxB
 		)
 	{
+		Engabra_INSTR_OP("*", Spinor, ComPlex, MultiVector);
 		return MultiVector
 			{ Scalar{ spinA.theSca.theData[0] * cplxB.theSca.theData[0] }
 			, Vector{ spinA.theBiv * cplxB.theTri }
@@ -239,6 +248,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("*", Spinor, DirPlex, MultiVector);
 		Vector const vec{ spinA.theSca.theData[0] * dplxB.theVec };
 		BiVector const biv{ spinA.theSca.theData[0] * dplxB.theBiv };
 		ImSpin const imsp{ spinA.theBiv * dplxB.theVec };
@@ -264,6 +274,7 @@ namespace g3
 		, MultiVector const & mvB
 		)
 	{
+		Engabra_INSTR_OP("*", Spinor, MultiVector, MultiVector);
 		MultiVector const mv1{ spinA.theSca.theData[0] * mvB };
 		MultiVector const mv2{ spinA.theBiv * mvB };
 		return { mv1 + mv2 };
@@ -37,6 +37,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 
 #include "g3_private.hpp"
 #include "g3opsAdd.hpp"
@@ -71,6 +72,7 @@ namespace g3
 		, double const & dubB
 		)
 	{
+		Engabra_INSTR_OP("*", TriVector, double, TriVector);
 		return TriVector{ dubB * triA.theData[0] };
 	}
 
@@ -87,6 +89,7 @@ namespace g3
 		, Scalar const & scaB
 		)
 	{
+		Engabra_INSTR_OP("*", TriVector, Scalar, TriVector);
 		// T = t*S = S*t
 		return TriVector{ scaB.theData[0] * triA.theData[0] };
 	}
@@ -104,6 +107,7 @@ namespace g3
 		, Vector const & vecB
 		)
 	{
+		Engabra_INSTR_OP("*", TriVector, Vector, BiVector);
 		// B = t*v = v*t
 		return vecB * triA;
 	}
@@ -121,6 +125,7 @@ namespace g3
 		, BiVector const & bivB
 		)
 	{
+		Engabra_INSTR_OP("*", TriVector, BiVector, Vector);
 		// V = t*B = B*t
 		return bivB * triA;
 	}
@@ -142,6 +147,7 @@ namespace g3
 		, TriVector const & triB
 		)
 	{
+		Engabra_INSTR_OP("*", TriVector, TriVector, Scalar);
 		// S = T*T = -|T*T|
 		// note negation
 		return Scalar
@@ -166,6 +172,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("*", TriVector, Spinor, ImSpin);
 		return ImSpin
 			{ Vector
 				{ - triA.theData[0] * spinB.theBiv.theData[0]
@@ -191,6 +198,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("*", TriVector, ImSpin, Spinor);
 		return Spinor
 			{ Scalar
 				{ - triA.theData[0] * imspB.theTri.theData[0] }
@@ -215,6 +223,7 @@ namespace g3
 		, ComPlex const & cplx
 		)
 	{
+		Engabra_INSTR_OP("*", TriVector, ComPlex, ComPlex);
 		return ComPlex
 			{ - triA.theData[0] * cplx.theTri.theData[0]
 			, triA.theData[0] * cplx.theSca.theData[0]
@@ -234,6 +243,7 @@ namespace g3
 		, DirPlex const & dplx
 		)
 	{
+		Engabra_INSTR_OP("*", TriVector, DirPlex, DirPlex);
 		return DirPlex
 			{ Vector
 				{ - triA.theData[0] * dplx.theBiv.theData[0]
@@ -261,6 +271,7 @@ namespace g3
 		, MultiVector const & mvB
 		)
 	{
+		Engabra_INSTR_OP("*", TriVector, MultiVector, MultiVector);
 		return MultiVector
 			{ Scalar
 				{ - triA.theData[0] * mvB.theTri.theData[0]
@@ -37,6 +37,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 
 #include "g3_private.hpp"
 #include "g3opsAdd.hpp"
@@ -69,6 +70,7 @@ namespace g3
 		, double const & dubB
 		)
 	{
+		Engabra_INSTR_OP("*", Vector, double, Vector);
 		return dubB * vecA;
 	}
 
@@ -85,6 +87,7 @@ namespace g3
 		, Scalar const & scaB
 		)
 	{
+		Engabra_INSTR_OP("*", Vector, Scalar, Vector);
 		return scaB * vecA;
 	}
 
@@ -105,6 +108,7 @@ namespace g3
 		, Vector const & vecB
 		)
 	{
+		Engabra_INSTR_OP("*", Vector, Vector, Spinor);
 		Scalar const dot{ priv::prodComm(vecA.theData, vecB.theData) };
 		BiVector const wedge{ priv::prodAnti(vecA.theData, vecB.theData) };
 		return Spinor{ dot, wedge };
@@ -127,6 +131,7 @@ namespace g3
 		, BiVector const & bivB
 		)
 	{
+		Engabra_INSTR_OP("*", Vector, BiVector, ImSpin);
 		// v*B = v.B + v^B = v.(-b*I) + v^B
 		Vector const v1{ priv::prodAnti(vecA.theData, bivB.theData) };
 		TriVector const t1{ priv::prodComm(vecA.theData, bivB.theData) };
@@ -146,6 +151,7 @@ namespace g3
 		, TriVector const & triB
 		)
 	{
+		Engabra_INSTR_OP("*", Vector, TriVector, BiVector);
 		// v*T = v*I*s
 		return BiVector
 			{ triB.theData[0] * vecA.theData[0]
@@ -167,6 +173,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("*", Vector, Spinor, ImSpin);
 		Vector const v1
 			{ spinB.theSca.theData[0] * vecA.theData[0]
 			, spinB.theSca.theData[0] * vecA.theData[1]
@@ -192,6 +199,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("*", Vector, ImSpin, Spinor);
 		Vector const & v1 = vecA;
 		Vector const & v2 = imspB.theVec;
 		TriVector const & t2 = imspB.theTri;
@@ -227,6 +235,7 @@ namespace g3
 		, ComPlex const & mvB
 		)
 	{
+		Engabra_INSTR_OP("*", Vector, ComPlex, DirPlex);
 		return DirPlex
 			{ Vector
 				{ vecA.theData[0] * mvB.theSca.theData[0]
@@ -254,6 +263,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("*", Vector, DirPlex, MultiVector);
 		Vector const & v1 = vecA;
 		Vector const & v2 = dplxB.theVec;
 		BiVector const & b2 = dplxB.theBiv;
@@ -284,6 +294,7 @@ namespace g3
 		, MultiVector const & mvB
 		)
 	{
+		Engabra_INSTR_OP("*", Vector, MultiVector, MultiVector);
 		Vector const vec1
 			{ vecA.theData[0] * mvB.theSca.theData[0]
 			, vecA.theData[1] * mvB.theSca.theData[0]
@@ -37,6 +37,7 @@
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 
 
 namespace engabra
@@ -72,6 +73,7 @@ namespace g3
 		, Scalar const & scaB
 		)
 	{
+		Engabra_INSTR_OP("*", double, Scalar, Scalar);
 		return Scalar{ dubA * scaB.theData[0] };
 	}
 
@@ -88,6 +90,7 @@ namespace g3
 		, Vector const & vecB
 		)
 	{
+		Engabra_INSTR_OP("*", double, Vector, Vector);
 		return Vector
 			{ dubA * vecB.theData[0]
 			, dubA * vecB.theData[1]
@@ -108,6 +111,7 @@ namespace g3
 		, BiVector const & bivB
 		)
 	{
+		Engabra_INSTR_OP("*", double, BiVector, BiVector);
 		return BiVector
 			{ dubA * bivB.theData[0]
 			, dubA * bivB.theData[1]
@@ -128,6 +132,7 @@ namespace g3
 		, TriVector const & triB
 		)
 	{
+		Engabra_INSTR_OP("*", double, TriVector, TriVector);
 		return TriVector{ dubA * triB.theData[0] };
 	}
 
@@ -144,6 +149,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("*", double, Spinor, Spinor);
 		return Spinor
 			{ Scalar
 				{ dubA * spinB.theSca.theData[0] }
@@ -168,6 +174,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("*", double, ImSpin, ImSpin);
 		return ImSpin
 			{ Vector
 				{ dubA * imspB.theVec.theData[0]
@@ -192,6 +199,7 @@ namespace g3
 		, ComPlex const & cplxB
 		)
 	{
+		Engabra_INSTR_OP("*", double, ComPlex, ComPlex);
 		return ComPlex
 			{ dubA * cplxB.theSca.theData[0]
 			, dubA * cplxB.theTri.theData[0]
@@ -211,6 +219,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("*", double, DirPlex, DirPlex);
 		return DirPlex
 			{ Vector
 				{ dubA*dplxB.theVec.theData[0]
@@ -238,6 +247,7 @@ namespace g3
 		, MultiVector const & mvB
 		)
 	{
+		Engabra_INSTR_OP("*", double, MultiVector, MultiVector);
 		return MultiVector
 			{ Scalar
 					{ dubA * mvB.theSca.theData[0] }
@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsSub_same.hpp"
 #include "g3opsUni.hpp" // unary negation used frequently
 #include "g3opsSub_Scalar.hpp"
@@ -61,6 +62,7 @@ namespace g3
 		, Scalar const & sca
 		)
 	{
+		Engabra_INSTR_OP("-", BiVector, Scalar, Spinor);
 		return sca - biv;
 	}
 
@@ -72,6 +74,7 @@ namespace g3
 		, Vector const & vec
 		)
 	{
+		Engabra_INSTR_OP("-", BiVector, Vector, DirPlex);
 		return vec - biv;
 	}
 
@@ -91,6 +94,7 @@ namespace g3
 		, Spinor const & spin
 		)
 	{
+		Engabra_INSTR_OP("-", BiVector, Spinor, Spinor);
 		return Spinor{ -spin.theSca, biv - spin.theBiv };
 	}
 
@@ -104,6 +108,7 @@ namespace g3
 		, DirPlex const & dplx
 		)
 	{
+		Engabra_INSTR_OP("-", BiVector, DirPlex, DirPlex);
 		return DirPlex{ -dplx.theVec, biv - dplx.theBiv };
 	}
 
@@ -115,6 +120,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("-", BiVector, MultiVector, MultiVector);
 		return MultiVector
 			{ -mv.theSca
 			, -mv.theVec
@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsSub_same.hpp"
 #include "g3opsUni.hpp" // unary negation used frequently
 #include "g3opsSub_Scalar.hpp"
@@ -62,6 +63,7 @@ namespace g3
 		, Scalar const & sca
 		)
 	{
+		Engabra_INSTR_OP("-", ComPlex, Scalar, ComPlex);
 		return -(sca - cplx);
 	}
 
@@ -77,6 +79,7 @@ namespace g3
 		, TriVector const & tri
 		)
 	{
+		Engabra_INSTR_OP("-", ComPlex, TriVector, ComPlex);
 		return -(tri - cplx);
 	}
 
@@ -98,6 +101,7 @@ namespace g3
 		, DirPlex const & dplx
 		)
 	{
+		Engabra_INSTR_OP("-", ComPlex, DirPlex, MultiVector);
 		return MultiVector
 			{ cplx.theSca
 			, -dplx.theVec
@@ -114,6 +118,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("-", ComPlex, MultiVector, MultiVector);
 		return MultiVector
 			{ cplx.theSca - mv.theSca
 			, -mv.theVec
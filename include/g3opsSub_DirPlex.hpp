@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsSub_same.hpp"
 #include "g3opsUni.hpp" // unary negation used frequently
 #include "g3opsSub_Vector.hpp"
@@ -65,6 +66,7 @@ namespace g3
 		, Vector const & vec
 		)
 	{
+		Engabra_INSTR_OP("-", DirPlex, Vector, DirPlex);
 		return -(vec - dplx);
 	}
 
@@ -76,6 +78,7 @@ namespace g3
 		, BiVector const & biv
 		)
 	{
+		Engabra_INSTR_OP("-", DirPlex, BiVector, DirPlex);
 		return -(biv - dplx);
 	}
 
@@ -93,6 +96,7 @@ namespace g3
 		, ComPlex const & cplx
 		)
 	{
+		Engabra_INSTR_OP("-", DirPlex, ComPlex, MultiVector);
 		return -(cplx - dplx);
 	}
 
@@ -110,6 +114,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("-", DirPlex, MultiVector, MultiVector);
 		return MultiVector
 			{ -mv.theSca
 			, dplx.theVec - mv.theVec
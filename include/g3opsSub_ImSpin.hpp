@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsSub_same.hpp"
 #include "g3opsUni.hpp" // unary negation used frequently
 #include "g3opsSub_Vector.hpp"
@@ -64,6 +65,7 @@ namespace g3
 		, Vector const & vec
 		)
 	{
+		Engabra_INSTR_OP("-", ImSpin, Vector, ImSpin);
 		return -(vec - imsp);
 	}
 
@@ -77,6 +79,7 @@ namespace g3
 		, TriVector const & tri
 		)
 	{
+		Engabra_INSTR_OP("-", ImSpin, TriVector, ImSpin);
 		return -(tri - imsp);
 	}
 
@@ -88,6 +91,7 @@ namespace g3
 		, Spinor const & spin
 		)
 	{
+		Engabra_INSTR_OP("-", ImSpin, Spinor, MultiVector);
 		return -(spin - imsp);
 	}
 
@@ -109,6 +113,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("-", ImSpin, MultiVector, MultiVector);
 		return MultiVector
 			{ -mv.theSca
 			, imsp.theVec - mv.theVec
@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsSub_same.hpp"
 #include "g3opsUni.hpp" // unary negation used frequently
 #include "g3opsSub_Scalar.hpp"
@@ -68,6 +69,7 @@ namespace g3
 		, Scalar const & sca
 		)
 	{
+		Engabra_INSTR_OP("-", MultiVector, Scalar, MultiVector);
 		return -(sca - mv);
 	}
 
@@ -79,6 +81,7 @@ namespace g3
 		, Vector const & vec
 		)
 	{
+		Engabra_INSTR_OP("-", MultiVector, Vector, MultiVector);
 		return -(vec - mv);
 	}
 
@@ -90,6 +93,7 @@ namespace g3
 		, BiVector const & biv
 		)
 	{
+		Engabra_INSTR_OP("-", MultiVector, BiVector, MultiVector);
 		return -(biv - mv);
 	}
 
@@ -101,6 +105,7 @@ namespace g3
 		, TriVector const & tri
 		)
 	{
+		Engabra_INSTR_OP("-", MultiVector, TriVector, MultiVector);
 		return -(tri - mv);
 	}
 
@@ -112,6 +117,7 @@ namespace g3
 		, Spinor const & spin
 		)
 	{
+		Engabra_INSTR_OP("-", MultiVector, Spinor, MultiVector);
 		return -(spin - mv);
 	}
 
@@ -123,6 +129,7 @@ namespace g3
 		, ImSpin const & imsp
 		)
 	{
+		Engabra_INSTR_OP("-", MultiVector, ImSpin, MultiVector);
 		return -(imsp - mv);
 	}
 
@@ -134,6 +141,7 @@ namespace g3
 		, ComPlex const & cplx
 		)
 	{
+		Engabra_INSTR_OP("-", MultiVector, ComPlex, MultiVector);
 		return -(cplx - mv);
 	}
 
@@ -145,6 +153,7 @@ namespace g3
 		, DirPlex const & dplx
 		)
 	{
+		Engabra_INSTR_OP("-", MultiVector, DirPlex, MultiVector);
 		return -(dplx - mv);
 	}
 
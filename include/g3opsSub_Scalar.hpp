@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsSub_same.hpp"
 #include "g3opsUni.hpp" // unary negation used frequently
 
@@ -62,6 +63,7 @@ namespace g3
 		, BiVector const & biv
 		)
 	{
+		Engabra_INSTR_OP("-", Scalar, BiVector, Spinor);
 		return Spinor{ sca, -biv };
 	}
 
@@ -73,6 +75,7 @@ namespace g3
 		, TriVector const & tri
 		)
 	{
+		Engabra_INSTR_OP("-", Scalar, TriVector, ComPlex);
 		return ComPlex{ sca, -tri };
 	}
 
@@ -84,6 +87,7 @@ namespace g3
 		, Spinor const & spin
 		)
 	{
+		Engabra_INSTR_OP("-", Scalar, Spinor, Spinor);
 		return
 			{ sca - spin.theSca
 			, -spin.theBiv
@@ -100,6 +104,7 @@ namespace g3
 		, ComPlex const & cplx
 		)
 	{
+		Engabra_INSTR_OP("-", Scalar, ComPlex, ComPlex);
 		return ComPlex
 			{ sca - cplx.theSca
 			, -cplx.theTri
@@ -116,6 +121,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("-", Scalar, MultiVector, MultiVector);
 		return MultiVector
 			{ sca - mv.theSca
 			, -mv.theVec
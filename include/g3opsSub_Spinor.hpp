@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsSub_same.hpp"
 #include "g3opsUni.hpp" // unary negation used frequently
 #include "g3opsSub_Scalar.hpp"
@@ -61,6 +62,7 @@ namespace g3
 		, Scalar const & sca
 		)
 	{
+		Engabra_INSTR_OP("-", Spinor, Scalar, Spinor);
 		return sca - spin;
 	}
 
@@ -74,6 +76,7 @@ namespace g3
 		, BiVector const & biv
 		)
 	{
+		Engabra_INSTR_OP("-", Spinor, BiVector, Spinor);
 		return biv - spin;
 	}
 
@@ -93,6 +96,7 @@ namespace g3
 		, ImSpin const & imsp
 		)
 	{
+		Engabra_INSTR_OP("-", Spinor, ImSpin, MultiVector);
 		return MultiVector
 			{ spin.theSca
 			, -imsp.theVec
@@ -113,6 +117,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("-", Spinor, MultiVector, MultiVector);
 		return MultiVector
 			{ spin.theSca - mv.theSca
 			, -mv.theVec
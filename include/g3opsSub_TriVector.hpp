@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsSub_same.hpp"
 #include "g3opsUni.hpp" // unary negation used frequently
 #include "g3opsSub_Scalar.hpp"
@@ -61,6 +62,7 @@ namespace g3
 		, Scalar const & sca
 		)
 	{
+		Engabra_INSTR_OP("-", TriVector, Scalar, ComPlex);
 		return sca - tri;
 	}
 
@@ -72,6 +74,7 @@ namespace g3
 		, Vector const & vec
 		)
 	{
+		Engabra_INSTR_OP("-", TriVector, Vector, ImSpin);
 		return vec - tri;
 	}
 
@@ -93,6 +96,7 @@ namespace g3
 		, ImSpin const & imsp
 		)
 	{
+		Engabra_INSTR_OP("-", TriVector, ImSpin, ImSpin);
 		return ImSpin{ -imsp.theVec, tri - imsp.theTri };
 	}
 
@@ -104,6 +108,7 @@ namespace g3
 		, ComPlex const & cplx
 		)
 	{
+		Engabra_INSTR_OP("-", TriVector, ComPlex, ComPlex);
 		return ComPlex{ -cplx.theSca, tri - cplx.theTri };
 	}
 
@@ -117,6 +122,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("-", TriVector, MultiVector, MultiVector);
 		return MultiVector
 			{ -mv.theSca
 			, -mv.theVec
@@ -37,6 +37,7 @@ Example:
 */
 
 
+#include "g3instr.hpp"
 #include "g3opsSub_same.hpp"
 #include "g3opsUni.hpp" // unary negation used frequently
 
@@ -66,6 +67,7 @@ namespace g3
 		, BiVector const & biv
 		)
 	{
+		Engabra_INSTR_OP("-", Vector, BiVector, DirPlex);
 		return DirPlex{ vec, -biv };
 	}
 
@@ -77,6 +79,7 @@ namespace g3
 		, TriVector const & tri
 		)
 	{
+		Engabra_INSTR_OP("-", Vector, TriVector, ImSpin);
 		return ImSpin{ vec, -tri };
 	}
 
@@ -88,6 +91,7 @@ namespace g3
 		, ImSpin const & imsp
 		)
 	{
+		Engabra_INSTR_OP("-", Vector, ImSpin, ImSpin);
 		return ImSpin
 			{ vec - imsp.theVec
 			, -imsp.theTri
@@ -104,6 +108,7 @@ namespace g3
 		, DirPlex const & dplx
 		)
 	{
+		Engabra_INSTR_OP("-", Vector, DirPlex, DirPlex);
 		return DirPlex
 			{ vec - dplx.theVec
 			, -dplx.theBiv
@@ -118,6 +123,7 @@ namespace g3
 		, MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_OP("-", Vector, MultiVector, MultiVector);
 		return MultiVector
 			{ -mv.theSca
 			, vec - mv.theVec
@@ -39,6 +39,7 @@ Example:
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 #include "g3_private.hpp"
 
 #include <algorithm>
@@ -74,6 +75,7 @@ namespace g3
 		, Blade const & bladeB
 		)
 	{
+		Engabra_INSTR_OP("-", Blade, Blade, Blade);
 		return priv::binaryElementByElement
 			( bladeA
 			, bladeB
@@ -90,6 +92,7 @@ namespace g3
 		, Spinor const & spinB
 		)
 	{
+		Engabra_INSTR_OP("-", Spinor, Spinor, Spinor);
 		return Spinor
 			{ spinA.theSca - spinB.theSca
 			, spinA.theBiv - spinB.theBiv
@@ -104,6 +107,7 @@ namespace g3
 		, ImSpin const & imspB
 		)
 	{
+		Engabra_INSTR_OP("-", ImSpin, ImSpin, ImSpin);
 		return ImSpin
 			{ imspA.theVec - imspB.theVec
 			, imspA.theTri - imspB.theTri
@@ -118,6 +122,7 @@ namespace g3
 		, ComPlex const & cplxB
 		)
 	{
+		Engabra_INSTR_OP("-", ComPlex, ComPlex, ComPlex);
 		return ComPlex
 			{ cplxA.theSca - cplxB.theSca
 			, cplxA.theTri - cplxB.theTri
@@ -132,6 +137,7 @@ namespace g3
 		, DirPlex const & dplxB
 		)
 	{
+		Engabra_INSTR_OP("-", DirPlex, DirPlex, DirPlex);
 		return DirPlex
 			{ dplxA.theVec - dplxB.theVec
 			, dplxA.theBiv - dplxB.theBiv
@@ -146,6 +152,7 @@ namespace g3
 		, MultiVector const & mvB
 		)
 	{
+		Engabra_INSTR_OP("-", MultiVector, MultiVector, MultiVector);
 		return MultiVector
 			{ mvA.theSca - mvB.theSca
 			, mvA.theVec - mvB.theVec
@@ -105,6 +105,7 @@ changes sign on the spatially directed, vector and bivector, grades.
 
 
 #include "g3type.hpp"
+#include "g3instr.hpp"
 #include "g3traits.hpp"
 
 #include <algorithm>
@@ -130,6 +131,7 @@ namespace g3
 		( Blade const & anyBlade
 		)
 	{
+		Engabra_INSTR_UNI("-", Blade);
 		Blade outBlade{}; // okay uninitialized, each element is filled
 		std::transform
 			( std::cbegin(anyBlade.theData)
@@ -147,6 +149,7 @@ namespace g3
 		( Spinor const & spin
 		)
 	{
+		Engabra_INSTR_UNI("-", Spinor);
 		return Spinor{ -spin.theSca, -spin.theBiv };
 	}
 
@@ -157,6 +160,7 @@ namespace g3
 		( ImSpin const & imsp
 		)
 	{
+		Engabra_INSTR_UNI("-", ImSpin);
 		return ImSpin{ -imsp.theVec, -imsp.theTri };
 	}
 
@@ -167,6 +171,7 @@ namespace g3
 		( ComPlex const & cplex
 		)
 	{
+		Engabra_INSTR_UNI("-", ComPlex);
 		return ComPlex{ -cplex.theSca, -cplex.theTri };
 	}
 
@@ -177,6 +182,7 @@ namespace g3
 		( DirPlex const & dplex
 		)
 	{
+		Engabra_INSTR_UNI("-", DirPlex);
 		return DirPlex{ -dplex.theVec, -dplex.theBiv };
 	}
 
@@ -187,6 +193,7 @@ namespace g3
 		( MultiVector const & mv
 		)
 	{
+		Engabra_INSTR_UNI("-", MultiVector);
 		return MultiVector{ -mv.theSca, -mv.theVec, -mv.theBiv, -mv.theTri };
 	}
 
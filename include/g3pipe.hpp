@@ -0,0 +1,314 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3pipe_INCL_
+#define engabra_g3pipe_INCL_
+
+/*! \file
+\brief Overlapped (read, transform, write) processing of binary entities.
+
+\b Overview
+
+Function io::pipeBlocks() reads binary entity records from an input
+stream, passes fixed size blocks of them to a transformation function
+and writes the resulting entities to an output stream. Reading and
+writing are performed by background threads such that computation on
+one block overlaps I/O of neighboring blocks.
+
+A fixed number of block buffers (ref PipeParms::theNumBuffers) cycle
+between reader, transformation and writer. If any stage is slower than
+the others, the faster stages wait for buffers to be returned (i.e.
+backpressure) such that memory use remains bounded.
+
+Binary records are the in-memory (native byte order) representation of
+each entity (i.e. sizeof(Type)/sizeof(double) consecutive doubles).
+
+Example:
+\snippet test_g3pipe_all.cpp DoxyExample01
+
+*/
+
+
+#include "g3lazy.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+namespace io
+{
+	//! Configuration for pipeBlocks()
+	struct PipeParms
+	{
+		//! Number of entities per block
+		std::size_t theBlockSize{ 4096u };
+
+		//! Number of buffers for each of input and output (at least 2)
+		std::size_t theNumBuffers{ 3u };
+	};
+
+	//! Summary of pipeBlocks() processing
+	struct PipeResult
+	{
+		//! Number of (complete) entities read
+		std::size_t theNumIn{ 0u };
+
+		//! Number of entities written
+		std::size_t theNumOut{ 0u };
+
+		//! False if write failed or input ended with a partial record
+		bool theIsOkay{ false };
+	};
+
+namespace priv
+{
+	//! Block of entities (capacity is block size, theCount are valid)
+	template <typename Type>
+	struct Block
+	{
+		std::vector<Type> theItems{}; //!< Storage
+		std::size_t theCount{ 0u }; //!< Number of valid items
+	};
+
+	//! Channel passing blocks between pipeline threads
+	template <typename Type>
+	using BlockQueue = lazy::priv::BoundedQueue<Block<Type> >;
+
+	//! Channel pre-filled with numBuffers empty blocks of blockSize
+	template <typename Type>
+	inline
+	void
+	fillWithBlocks
+		( BlockQueue<Type> * const & ptQueue
+		, std::size_t const & numBuffers
+		, std::size_t const & blockSize
+		)
+	{
+		for (std::size_t nn{ 0u } ; nn < numBuffers ; ++nn)
+		{
+			ptQueue->push(Block<Type>{ std::vector<Type>(blockSize), 0u });
+		}
+	}
+
+} // [priv]
+
+	/*! \brief Transform binary InType records from istrm into ostrm.
+	 *
+	 * For each block of entities read, the function is called as
+	 * \code
+	 * func(InType const * inBeg, InType const * inEnd, OutType * outBeg)
+	 * \endcode
+	 * and must assign (inEnd-inBeg) entities starting at outBeg. The
+	 * function is called (in order of input) from the calling thread,
+	 * and may itself use threads (e.g. g3::batch functions).
+	 *
+	 * Reading (from istrm) and writing (to ostrm) are performed by
+	 * separate background threads. A trailing partial record in istrm
+	 * is ignored (and theIsOkay is set false). If func throws, both
+	 * threads are stopped and joined before the exception is rethrown.
+	 */
+	template <typename InType, typename OutType, typename Func>
+	inline
+	PipeResult
+	pipeBlocks
+		( std::istream & istrm
+		, std::ostream & ostrm
+		, Func const & func
+		, PipeParms const & parms = {}
+		)
+	{
+		static_assert
+			( std::is_trivially_copyable_v<InType>
+			&& std::is_trivially_copyable_v<OutType>
+			, "Binary records require trivially copyable entity types"
+			);
+		using InBlock = priv::Block<InType>;
+		using OutBlock = priv::Block<OutType>;
+
+		std::size_t const blockSize
+			{ std::max(parms.theBlockSize, std::size_t{ 1u }) };
+		std::size_t const numBuffers
+			{ std::max(parms.theNumBuffers, std::size_t{ 2u }) };
+
+		// empty blocks cycle: free -> full -> (processed) -> free
+		priv::BlockQueue<InType> freeIns(numBuffers);
+		priv::BlockQueue<InType> fullIns(numBuffers);
+		priv::BlockQueue<OutType> freeOuts(numBuffers);
+		priv::BlockQueue<OutType> fullOuts(numBuffers);
+		priv::fillWithBlocks(&freeIns, numBuffers, blockSize);
+		priv::fillWithBlocks(&freeOuts, numBuffers, blockSize);
+
+		PipeResult result;
+		bool isPartial{ false };
+		bool isWriteOkay{ true };
+
+		// reader: fill free input blocks until end of input
+		std::thread reader
+			( [&] ()
+				{
+					std::streamsize const numBytes
+						{ static_cast<std::streamsize>
+							(blockSize * sizeof(InType))
+						};
+					InBlock block;
+					while (istrm && freeIns.pop(block))
+					{
+						istrm.read
+							( reinterpret_cast<char *>(block.theItems.data())
+							, numBytes
+							);
+						std::size_t const gotBytes
+							{ static_cast<std::size_t>(istrm.gcount()) };
+						block.theCount = gotBytes / sizeof(InType);
+						isPartial = (0u != (gotBytes % sizeof(InType)));
+						result.theNumIn += block.theCount;
+						if ((0u == block.theCount)
+							|| (! fullIns.push(std::move(block))))
+						{
+							break;
+						}
+					}
+					fullIns.finish();
+				}
+			);
+
+		// writer: write full output blocks until transformation is done
+		std::thread writer
+			( [&] ()
+				{
+					OutBlock block;
+					while (fullOuts.pop(block))
+					{
+						if (isWriteOkay)
+						{
+							ostrm.write
+								( reinterpret_cast<char const *>
+									(block.theItems.data())
+								, static_cast<std::streamsize>
+									(block.theCount * sizeof(OutType))
+								);
+							isWriteOkay = (! ostrm.fail());
+							if (isWriteOkay)
+							{
+								result.theNumOut += block.theCount;
+							}
+						}
+						freeOuts.push(std::move(block));
+					}
+				}
+			);
+
+		// transformation (on this thread)
+		std::exception_ptr error{};
+		try
+		{
+			InBlock inBlock;
+			OutBlock outBlock;
+			while (fullIns.pop(inBlock))
+			{
+				freeOuts.pop(outBlock);
+				InType const * const inBeg{ inBlock.theItems.data() };
+				func(inBeg, inBeg + inBlock.theCount, outBlock.theItems.data());
+				outBlock.theCount = inBlock.theCount;
+				freeIns.push(std::move(inBlock));
+				fullOuts.push(std::move(outBlock));
+			}
+		}
+		catch (...)
+		{
+			// stop reader (whether blocked on free or full input blocks)
+			error = std::current_exception();
+			fullIns.close();
+			freeIns.finish();
+		}
+		fullOuts.finish();
+
+		reader.join();
+		writer.join();
+
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+		result.theIsOkay = isWriteOkay && (! isPartial);
+		return result;
+	}
+
+	/*! \brief Transform binary records from file inPath into file outPath.
+	 *
+	 * Same as pipeBlocks() with file streams. If either file cannot be
+	 * opened, the result has theIsOkay false (and no data are processed).
+	 * The output file is not created (or truncated) unless the input
+	 * file is opened.
+	 */
+	template <typename InType, typename OutType, typename Func>
+	inline
+	PipeResult
+	pipeFiles
+		( std::string const & inPath
+		, std::string const & outPath
+		, Func const & func
+		, PipeParms const & parms = {}
+		)
+	{
+		PipeResult result;
+		std::ifstream ifs(inPath, std::ios::binary);
+		if (ifs.is_open())
+		{
+			// open (and truncate) output only if there is input
+			std::ofstream ofs(outPath, std::ios::binary);
+			if (ofs.is_open())
+			{
+				result = pipeBlocks<InType, OutType>(ifs, ofs, func, parms);
+				ofs.flush();
+				result.theIsOkay = result.theIsOkay && (! ofs.fail());
+			}
+		}
+		return result;
+	}
+
+} // [io]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3pipe_INCL_
@@ -0,0 +1,469 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3quat_INCL_
+#define engabra_g3quat_INCL_
+
+/*! \file
+\brief Interoperation with external quaternion arrays (without copying).
+
+\b Overview
+
+A Spinor is stored as four contiguous doubles, (sca, e23, e31, e12),
+and is therefore memory compatible with a quaternion array provided
+that the component order and signs agree. Quaternion conventions vary
+in two ways:
+
+\arg Order - scalar first (w,x,y,z) or scalar last (x,y,z,w).
+
+\arg Sign - For Hamilton quaternions (i*j=k, rotation q*v*conj(q)), the
+equivalent spinor is (w - x*e23 - y*e31 - z*e12). For the "Direct"
+convention (e.g. JPL style quaternions, i*j=-k) the quaternion
+components are the same as the spinor components (w + x*e23 + ...).
+
+The functions in namespace quat support two styles of interoperation:
+
+\arg Lazy - quat::View provides Spinor element access into an
+external buffer with the order and sign adaptation applied on each
+access. The buffer is neither copied nor modified.
+
+\arg Bulk in-place - quat::toSpinors() rearranges an external buffer
+(in place) into spinor layout and returns it as a Spinor pointer.
+quat::fromSpinors() performs the opposite rearrangement. For
+quaternion buffers already in spinor layout (Order::WXYZ with
+Sign::Direct), these are no-ops.
+
+Example:
+\snippet test_g3quat_all.cpp DoxyExample01
+
+*/
+
+
+#include "g3type.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+	// Memory compatibility required for reinterpreting buffers
+	static_assert(sizeof(Spinor) == (4u * sizeof(double)));
+	static_assert(std::is_standard_layout<Spinor>::value);
+	static_assert(std::is_trivially_copyable<Spinor>::value);
+
+//! Interoperation with external quaternion data buffers.
+namespace quat
+{
+	//! Memory order of quaternion components
+	enum class Order
+	{
+		  WXYZ //!< Scalar component first (same as Spinor)
+		, XYZW //!< Scalar component last
+	};
+
+	//! Relationship of quaternion (x,y,z) to spinor bivector components
+	enum class Sign
+	{
+		  Hamilton //!< BiVector components are {-x, -y, -z}
+		, Direct //!< BiVector components are {x, y, z}
+	};
+
+	//! Spinor from four quaternion components at ptQuat.
+	template <Order TheOrder, Sign TheSign>
+	inline
+	Spinor
+	spinorFrom
+		( double const * const & ptQuat
+		)
+	{
+		constexpr double sgn{ (Sign::Hamilton == TheSign) ? -1. : 1. };
+		constexpr std::size_t ndxW{ (Order::WXYZ == TheOrder) ? 0u : 3u };
+		constexpr std::size_t ndxX{ (Order::WXYZ == TheOrder) ? 1u : 0u };
+		return Spinor
+			{ ptQuat[ndxW]
+			, BiVector
+				{ sgn * ptQuat[ndxX]
+				, sgn * ptQuat[ndxX + 1u]
+				, sgn * ptQuat[ndxX + 2u]
+				}
+			};
+	}
+
+	//! Store spinor components into four quaternion components at ptQuat.
+	template <Order TheOrder, Sign TheSign>
+	inline
+	void
+	assignFrom
+		( Spinor const & spin
+		, double * const & ptQuat
+		)
+	{
+		constexpr double sgn{ (Sign::Hamilton == TheSign) ? -1. : 1. };
+		constexpr std::size_t ndxW{ (Order::WXYZ == TheOrder) ? 0u : 3u };
+		constexpr std::size_t ndxX{ (Order::WXYZ == TheOrder) ? 1u : 0u };
+		double const & biv1 = spin.theBiv.theData[0];
+		double const & biv2 = spin.theBiv.theData[1];
+		double const & biv3 = spin.theBiv.theData[2];
+		ptQuat[ndxW] = spin.theSca.theData[0];
+		ptQuat[ndxX] = sgn * biv1;
+		ptQuat[ndxX + 1u] = sgn * biv2;
+		ptQuat[ndxX + 2u] = sgn * biv3;
+	}
+
+	/*! \brief Spinor access into an external quaternion buffer (no copy).
+	 *
+	 * The Data type is either "double" (for read/write access) or
+	 * "double const" (for read only access).
+	 *
+	 * Example:
+	 * \snippet test_g3quat_all.cpp DoxyExampleView
+	 */
+	template <Order TheOrder, Sign TheSign, typename Data = double const>
+	struct View
+	{
+		Data * theData; //!< Start of quaternion buffer (4 doubles each)
+		std::size_t theSize; //!< Number of quaternions in buffer
+
+		//! Read-only iterator producing Spinor values.
+		struct const_iterator
+		{
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = Spinor;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = Spinor;
+
+			Data * thePtr; //!< Current quaternion location
+
+			//! Spinor at current location.
+			inline
+			Spinor
+			operator*
+				() const
+			{
+				return spinorFrom<TheOrder, TheSign>(thePtr);
+			}
+
+			//! Spinor at offset from current location.
+			inline
+			Spinor
+			operator[]
+				( difference_type const & offset
+				) const
+			{
+				return spinorFrom<TheOrder, TheSign>(thePtr + 4 * offset);
+			}
+
+			//! Advance to next quaternion.
+			inline
+			const_iterator &
+			operator++
+				()
+			{
+				thePtr += 4;
+				return *this;
+			}
+
+			//! Advance to next quaternion (post-increment).
+			inline
+			const_iterator
+			operator++
+				( int
+				)
+			{
+				const_iterator const orig{ *this };
+				thePtr += 4;
+				return orig;
+			}
+
+			//! Retreat to previous quaternion.
+			inline
+			const_iterator &
+			operator--
+				()
+			{
+				thePtr -= 4;
+				return *this;
+			}
+
+			//! Retreat to previous quaternion (post-decrement).
+			inline
+			const_iterator
+			operator--
+				( int
+				)
+			{
+				const_iterator const orig{ *this };
+				thePtr -= 4;
+				return orig;
+			}
+
+			//! Advance by offset number of quaternions.
+			inline
+			const_iterator &
+			operator+=
+				( difference_type const & offset
+				)
+			{
+				thePtr += 4 * offset;
+				return *this;
+			}
+
+			//! Retreat by offset number of quaternions.
+			inline
+			const_iterator &
+			operator-=
+				( difference_type const & offset
+				)
+			{
+				thePtr -= 4 * offset;
+				return *this;
+			}
+
+			//! Iterator offset by number of quaternions.
+			inline
+			const_iterator
+			operator+
+				( difference_type const & offset
+				) const
+			{
+				return const_iterator{ thePtr + 4 * offset };
+			}
+
+			//! Iterator offset by number of quaternions (offset first).
+			friend
+			inline
+			const_iterator
+			operator+
+				( difference_type const & offset
+				, const_iterator const & iter
+				)
+			{
+				return iter + offset;
+			}
+
+			//! Iterator offset backward by number of quaternions.
+			inline
+			const_iterator
+			operator-
+				( difference_type const & offset
+				) const
+			{
+				return const_iterator{ thePtr - 4 * offset };
+			}
+
+			//! Number of quaternions between iterators.
+			inline
+			difference_type
+			operator-
+				( const_iterator const & other
+				) const
+			{
+				return (thePtr - other.thePtr) / 4;
+			}
+
+			//! True if iterators address the same quaternion.
+			inline
+			bool
+			operator==
+				( const_iterator const & other
+				) const
+			{
+				return (thePtr == other.thePtr);
+			}
+
+			//! True if iterators address different quaternions.
+			inline
+			bool
+			operator!=
+				( const_iterator const & other
+				) const
+			{
+				return (thePtr != other.thePtr);
+			}
+
+			//! True if this addresses a quaternion before other.
+			inline
+			bool
+			operator<
+				( const_iterator const & other
+				) const
+			{
+				return (thePtr < other.thePtr);
+			}
+
+			//! True if this addresses a quaternion after other.
+			inline
+			bool
+			operator>
+				( const_iterator const & other
+				) const
+			{
+				return (other.thePtr < thePtr);
+			}
+
+			//! True if this addresses a quaternion not after other.
+			inline
+			bool
+			operator<=
+				( const_iterator const & other
+				) const
+			{
+				return (! (other.thePtr < thePtr));
+			}
+
+			//! True if this addresses a quaternion not before other.
+			inline
+			bool
+			operator>=
+				( const_iterator const & other
+				) const
+			{
+				return (! (thePtr < other.thePtr));
+			}
+		};
+
+		//! Number of quaternions (Spinors) in view.
+		inline
+		std::size_t
+		size
+			() const
+		{
+			return theSize;
+		}
+
+		//! Spinor equivalent of quaternion at index ndx.
+		inline
+		Spinor
+		operator[]
+			( std::size_t const & ndx
+			) const
+		{
+			return spinorFrom<TheOrder, TheSign>(theData + 4u*ndx);
+		}
+
+		//! Overwrite quaternion at index ndx with equivalent of spin.
+		inline
+		void
+		assign
+			( std::size_t const & ndx
+			, Spinor const & spin
+			) const
+		{
+			static_assert
+				( ! std::is_const<Data>::value
+				, "assign() requires View with non-const Data"
+				);
+			assignFrom<TheOrder, TheSign>(spin, theData + 4u*ndx);
+		}
+
+		//! Iterator to first Spinor.
+		inline
+		const_iterator
+		begin
+			() const
+		{
+			return const_iterator{ theData };
+		}
+
+		//! Iterator past last Spinor.
+		inline
+		const_iterator
+		end
+			() const
+		{
+			return const_iterator{ theData + 4u*theSize };
+		}
+	};
+
+	/*! \brief Spinor buffer overlaid (in place) on quaternion buffer.
+	 *
+	 * The numQuats quaternions at ptQuats are rearranged (in place) into
+	 * spinor layout and the same memory is returned as a Spinor pointer.
+	 * Use fromSpinors() to restore the original quaternion layout.
+	 */
+	template <Order TheOrder, Sign TheSign>
+	inline
+	Spinor *
+	toSpinors
+		( double * const & ptQuats
+		, std::size_t const & numQuats
+		)
+	{
+		if ((Order::WXYZ != TheOrder) || (Sign::Direct != TheSign))
+		{
+			for (std::size_t nn{0u} ; nn < numQuats ; ++nn)
+			{
+				double * const ptQuat{ ptQuats + 4u*nn };
+				Spinor const spin{ spinorFrom<TheOrder, TheSign>(ptQuat) };
+				assignFrom<Order::WXYZ, Sign::Direct>(spin, ptQuat);
+			}
+		}
+		return reinterpret_cast<Spinor *>(ptQuats);
+	}
+
+	/*! \brief Quaternion buffer overlaid (in place) on spinor buffer.
+	 *
+	 * The numSpins spinors at ptSpins are rearranged (in place) into
+	 * quaternion layout and the same memory is returned as a double
+	 * pointer (to 4*numSpins values). This is the inverse of toSpinors().
+	 */
+	template <Order TheOrder, Sign TheSign>
+	inline
+	double *
+	fromSpinors
+		( Spinor * const & ptSpins
+		, std::size_t const & numSpins
+		)
+	{
+		double * const ptQuats{ reinterpret_cast<double *>(ptSpins) };
+		if ((Order::WXYZ != TheOrder) || (Sign::Direct != TheSign))
+		{
+			for (std::size_t nn{0u} ; nn < numSpins ; ++nn)
+			{
+				double * const ptQuat{ ptQuats + 4u*nn };
+				Spinor const spin
+					{ spinorFrom<Order::WXYZ, Sign::Direct>(ptQuat) };
+				assignFrom<TheOrder, TheSign>(spin, ptQuat);
+			}
+		}
+		return ptQuats;
+	}
+
+} // [quat]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3quat_INCL_
@@ -0,0 +1,466 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3record_INCL_
+#define engabra_g3record_INCL_
+
+/*! \file
+\brief Schema driven streaming of delimited text records of g3 entities.
+
+\b Overview
+
+Delimited text files (e.g. CSV) often contain records with several
+columns of different types (e.g. a time value, a Vector location and a
+Spinor attitude). The schema of such records is specified by template
+parameters (e.g. RecordReader<double, Vector, Spinor>) with each entity
+occupying as many delimited fields as it has components (e.g. 1 + 3 + 4
+fields in this example).
+
+\arg RecordReader - reads records one at a time into a (reused)
+std::tuple. Fields that cannot be parsed produce null entities for the
+affected column (and the record is flagged as not okay).
+
+\arg RecordWriter - writes records with shortest round-trip formatting
+(via std::to_chars()) into a fixed size buffer.
+
+Any single character delimiter may be used. With a whitespace delimiter
+(' ' or '\\t'), consecutive whitespace characters are treated as one
+delimiter. Whitespace around fields is ignored. A (non-whitespace)
+delimiter after the last field implies an (empty) extra field such
+that the record is not okay (e.g. "1,2,3," for a Vector). After the
+first few records, neither reader nor writer allocates memory per
+record.
+
+Example:
+\snippet test_g3record_all.cpp DoxyExample01
+
+*/
+
+
+#include "g3ingest.hpp"
+#include "g3const.hpp"
+#include "g3type.hpp"
+#include "g3validity.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+namespace io
+{
+
+namespace priv
+{
+	//! True for whitespace delimiter characters
+	inline
+	bool
+	isSpaceDelim
+		( char const & delim
+		)
+	{
+		return (' ' == delim) || ('\t' == delim);
+	}
+
+	//! True for (non-newline) whitespace characters
+	inline
+	bool
+	isBlank
+		( char const & chr
+		)
+	{
+		return (' ' == chr) || ('\t' == chr) || ('\r' == chr);
+	}
+
+	/*! \brief Parse next field value from [beg, end) (advancing beg).
+	 *
+	 * Returns true if a valid number was parsed and is followed by
+	 * (optional whitespace and) a delimiter or the end of the line.
+	 */
+	inline
+	bool
+	parseField
+		( char const * & beg
+		, char const * const end
+		, char const & delim
+		, double & value
+		)
+	{
+		while ((beg < end) && isBlank(*beg))
+		{
+			++beg;
+		}
+		if ((beg < end) && ('+' == *beg))
+		{
+			++beg; // from_chars() does not accept leading '+'
+		}
+		std::from_chars_result const res{ std::from_chars(beg, end, value) };
+		bool okay{ (std::errc{} == res.ec) && isValid(value) };
+		// skip remainder of field (including delimiter)
+		beg = res.ptr;
+		while ((beg < end) && isBlank(*beg) && (delim != *beg))
+		{
+			++beg;
+		}
+		if (beg < end)
+		{
+			okay &= (delim == *beg);
+			while ((beg < end) && (delim != *beg))
+			{
+				++beg; // skip unparsed field content
+			}
+			if (beg < end)
+			{
+				++beg; // past delimiter
+			}
+		}
+		return okay;
+	}
+
+	//! Parse fields into (all components of) item (null on failure)
+	template <typename Type>
+	inline
+	bool
+	parseItem
+		( char const * & beg
+		, char const * const end
+		, char const & delim
+		, Type & item
+		)
+	{
+		static_assert
+			( std::is_trivially_copyable<Type>::value
+			  && (0u == (sizeof(Type) % sizeof(double)))
+			, "Type must be composed (only) of double values"
+			);
+		std::array<double, sNumDoubles<Type> > comps;
+		bool okay{ true };
+		for (double & comp : comps)
+		{
+			okay &= parseField(beg, end, delim, comp);
+		}
+		if (okay)
+		{
+			std::memcpy(&item, comps.data(), sizeof(Type));
+		}
+		else
+		{
+			item = null<Type>();
+		}
+		return okay;
+	}
+
+	/*! \brief Format (all components of) item into buffer with delimiters.
+	 *
+	 * Returns nullptr if [ptr, end) is too small (or if ptr is null).
+	 */
+	template <typename Type>
+	inline
+	char *
+	formatItem
+		( char * ptr
+		, char * const end
+		, char const & delim
+		, Type const & item
+		)
+	{
+		std::array<double, sNumDoubles<Type> > comps;
+		std::memcpy(comps.data(), &item, sizeof(Type));
+		for (double const & comp : comps)
+		{
+			if (ptr)
+			{
+				std::to_chars_result const res
+					{ std::to_chars(ptr, end, comp) };
+				if ((std::errc{} == res.ec) && (res.ptr < end))
+				{
+					ptr = res.ptr;
+					*ptr++ = delim;
+				}
+				else
+				{
+					ptr = nullptr; // no room for value and delimiter
+				}
+			}
+		}
+		return ptr;
+	}
+
+} // [priv]
+
+	/*! \brief Reader of delimited text records with columns of Types.
+	 *
+	 * Example usage:
+	 * \code
+	 * RecordReader<double, Vector> reader(istrm, ',');
+	 * while (reader.next())
+	 * {
+	 *     double const & time = std::get<0>(reader.theRecord);
+	 *     Vector const & loc = std::get<1>(reader.theRecord);
+	 * }
+	 * \endcode
+	 */
+	template <typename ... Types>
+	struct RecordReader
+	{
+		//! Source of text records
+		std::istream & theIstrm;
+
+		//! Delimiter between fields
+		char theDelim{ ',' };
+
+		//! Lines starting (after whitespace) with this are skipped
+		char theComment{ '#' };
+
+		//! Most recent record
+		std::tuple<Types ...> theRecord{};
+
+		//! True if all fields of most recent record were parsed
+		bool theIsOkay{ false };
+
+		//! Line number (1-based) of most recent record
+		std::size_t theLineNum{ 0u };
+
+		//! Text buffer (reused for each line)
+		std::string theLine{};
+
+		//! Attach to stream
+		explicit
+		RecordReader
+			( std::istream & istrm
+			, char const & delim = ','
+			, char const & comment = '#'
+			)
+			: theIstrm{ istrm }
+			, theDelim{ delim }
+			, theComment{ comment }
+		{ }
+
+		/*! \brief Read next record (skipping blank and comment lines).
+		 *
+		 * Returns false if no more records are available (otherwise
+		 * theRecord is assigned, with nulls for any unparsed columns).
+		 */
+		inline
+		bool
+		next
+			()
+		{
+			bool haveRecord{ false };
+			while ((! haveRecord) && std::getline(theIstrm, theLine))
+			{
+				++theLineNum;
+				char const * beg{ theLine.data() };
+				char const * const end{ beg + theLine.size() };
+				while ((beg < end) && priv::isBlank(*beg))
+				{
+					++beg;
+				}
+				haveRecord = (beg < end) && (theComment != *beg);
+				if (haveRecord)
+				{
+					theIsOkay = parseRecord
+						(beg, end, std::index_sequence_for<Types ...>{});
+				}
+			}
+			return haveRecord;
+		}
+
+	private:
+
+		//! Parse each column in order
+		template <std::size_t ... Ndxs>
+		inline
+		bool
+		parseRecord
+			( char const * beg
+			, char const * const end
+			, std::index_sequence<Ndxs ...>
+			)
+		{
+			bool okay{ true };
+			char const delim{ theDelim };
+			if (priv::isSpaceDelim(delim))
+			{
+				// treat any whitespace as delimiter (runs collapse)
+				((okay &= parseSpaced
+					(beg, end, std::get<Ndxs>(theRecord))), ...);
+			}
+			else
+			{
+				// a delimiter after the last field implies an extra field
+				char const * last{ end };
+				while ((beg < last) && priv::isBlank(*(last - 1)))
+				{
+					--last;
+				}
+				okay &= (beg < last) && (delim != *(last - 1));
+				((okay &= priv::parseItem
+					(beg, end, delim, std::get<Ndxs>(theRecord))), ...);
+			}
+			okay &= (end == beg); // no extra fields
+			return okay;
+		}
+
+		//! Parse whitespace delimited item
+		template <typename Type>
+		inline
+		static
+		bool
+		parseSpaced
+			( char const * & beg
+			, char const * const end
+			, Type & item
+			)
+		{
+			std::array<double, priv::sNumDoubles<Type> > comps;
+			bool okay{ true };
+			for (double & comp : comps)
+			{
+				while ((beg < end) && priv::isBlank(*beg))
+				{
+					++beg;
+				}
+				char const * fieldEnd{ beg };
+				while ((fieldEnd < end) && (! priv::isBlank(*fieldEnd)))
+				{
+					++fieldEnd;
+				}
+				char const * fieldBeg{ beg };
+				okay &= priv::parseField(fieldBeg, fieldEnd, ' ', comp);
+				beg = fieldEnd;
+				while ((beg < end) && priv::isBlank(*beg))
+				{
+					++beg;
+				}
+			}
+			if (okay)
+			{
+				std::memcpy(&item, comps.data(), sizeof(Type));
+			}
+			else
+			{
+				item = null<Type>();
+			}
+			return okay;
+		}
+	};
+
+	/*! \brief Writer of delimited text records with columns of Types.
+	 *
+	 * Values are formatted with shortest round-trip precision.
+	 */
+	template <typename ... Types>
+	struct RecordWriter
+	{
+		//! Number of double values in each record
+		static constexpr std::size_t theNumFields
+			{ (priv::sNumDoubles<Types> + ... + 0u) };
+
+		//! Maximum characters for one formatted value (plus delimiter)
+		static constexpr std::size_t theMaxFieldSize{ 32u };
+
+		//! Destination of text records
+		std::ostream & theOstrm;
+
+		//! Delimiter between fields
+		char theDelim{ ',' };
+
+		//! Text buffer (reused for each record)
+		std::array<char, theNumFields * theMaxFieldSize> theBuf{};
+
+		//! Attach to stream
+		explicit
+		RecordWriter
+			( std::ostream & ostrm
+			, char const & delim = ','
+			)
+			: theOstrm{ ostrm }
+			, theDelim{ delim }
+		{ }
+
+		/*! \brief Write one record (terminated by newline).
+		 *
+		 * Returns stream status. If the record cannot be formatted into
+		 * theBuf, nothing is written and failbit is set on theOstrm.
+		 */
+		inline
+		bool
+		write
+			( Types const & ... items
+			)
+		{
+			char * ptr{ theBuf.data() };
+			char * const end{ theBuf.data() + theBuf.size() };
+			((ptr = priv::formatItem(ptr, end, theDelim, items)), ...);
+			if (! ptr)
+			{
+				theOstrm.setstate(std::ios::failbit);
+			}
+			else
+			if (theBuf.data() < ptr)
+			{
+				*(ptr - 1) = '\n'; // replace final delimiter
+				std::streamsize const numChars{ ptr - theBuf.data() };
+				theOstrm.write(theBuf.data(), numChars);
+			}
+			return (! theOstrm.fail());
+		}
+
+		//! Write record from tuple (e.g. RecordReader::theRecord)
+		inline
+		bool
+		write
+			( std::tuple<Types ...> const & record
+			)
+		{
+			return std::apply
+				( [this] (Types const & ... items) { return write(items ...); }
+				, record
+				);
+		}
+	};
+
+} // [io]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3record_INCL_
@@ -0,0 +1,348 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3rigid_INCL_
+#define engabra_g3rigid_INCL_
+
+/*! \file
+\brief Rigid body transformation (rotation followed by translation).
+
+\b Overview
+
+A Rigid instance combines a unitary Spinor attitude with a translation
+Vector. Transformation of a location vector, vec, is
+
+	\f$ \bf{x} = S v \tilde{S} + t \f$
+
+i.e. the (sandwich) rotation by spinor, S, followed by addition of
+translation, t.
+
+Functions include:
+\arg Rigid::operator()() - transform a location vector
+\arg operator*() - composition (right hand transformation applied first)
+\arg inverse() - inverse transformation
+\arg interpolated() - rotation and translation interpolation
+\arg batch::apply() - transform many points (optionally multithreaded)
+
+Example:
+\snippet test_g3rigid_all.cpp DoxyExample01
+
+The batch functions evaluate the rotation as an equivalent 3x3 matrix
+(computed once per call) such that the per-point operation count is
+minimal (9 multiplies and 9 adds). The multithreaded versions split the
+point range into contiguous chunks (ref g3_parallel.hpp).
+
+Example:
+\snippet test_g3rigid_all.cpp DoxyExampleBatch
+
+*/
+
+
+#include "g3_parallel.hpp"
+#include "g3compare.hpp"
+#include "g3const.hpp"
+#include "g3func.hpp"
+#include "g3ops.hpp"
+#include "g3rotmat.hpp"
+#include "g3type.hpp"
+#include "g3validity.hpp"
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+namespace priv
+{
+	//! Vector from (row major) matrix product, mat*vec, plus tran.
+	inline
+	Vector
+	matVecPlus
+		( std::array<double, 9u> const & mat
+		, Vector const & vec
+		, Vector const & tran
+		)
+	{
+		double const & v1 = vec.theData[0];
+		double const & v2 = vec.theData[1];
+		double const & v3 = vec.theData[2];
+		return Vector
+			{ mat[0]*v1 + mat[1]*v2 + mat[2]*v3 + tran.theData[0]
+			, mat[3]*v1 + mat[4]*v2 + mat[5]*v3 + tran.theData[1]
+			, mat[6]*v1 + mat[7]*v2 + mat[8]*v3 + tran.theData[2]
+			};
+	}
+
+} // [priv]
+
+	/*! \brief Rigid body transformation - rotation then translation.
+	 *
+	 * The spinor is expected to be unitary (else the transformation
+	 * includes a scale of magSq(theSpin)).
+	 */
+	struct Rigid
+	{
+		Spinor theSpin; //!< Attitude: rotation as theSpin*vec*reverse(theSpin)
+		Vector theTran; //!< Translation: added after rotation
+
+		//! Identity transformation (no rotation and no translation).
+		inline
+		static
+		Rigid
+		identity
+			()
+		{
+			return Rigid{ one<Spinor>(), zero<Vector>() };
+		}
+
+		//! Location vector transformed by this instance.
+		inline
+		Vector
+		operator()
+			( Vector const & vec
+			) const
+		{
+			return priv::matVecPlus
+				(priv::sandwichMatrix(theSpin), vec, theTran);
+		}
+	};
+
+	//! Null instance (both spinor and translation are null)
+	template <>
+	inline
+	Rigid
+	null<Rigid>
+		()
+	{
+		return Rigid{ null<Spinor>(), null<Vector>() };
+	}
+
+	//! True if instance is not null
+	inline
+	bool
+	isValid
+		( Rigid const & xfm
+		)
+	{
+		return { isValid(xfm.theSpin) && isValid(xfm.theTran) };
+	}
+
+	/*! \brief True if both spinor and translation are nearlyEquals().
+	 *
+	 * Note that this compares representations. The transformations
+	 * for theSpin and -theSpin are equivalent but are not nearlyEqual.
+	 */
+	inline
+	bool
+	nearlyEquals
+		( Rigid const & xfmA
+		, Rigid const & xfmB
+		, double const & tol = { std::numeric_limits<double>::epsilon() }
+		)
+	{
+		return
+			{  nearlyEquals(xfmA.theSpin, xfmB.theSpin, tol)
+			&& nearlyEquals(xfmA.theTran, xfmB.theTran, tol)
+			};
+	}
+
+	/*! \brief Composition: transformation equivalent to xfmB then xfmA.
+	 *
+	 * I.e. (xfmA * xfmB)(vec) equals xfmA(xfmB(vec)).
+	 */
+	inline
+	Rigid
+	operator*
+		( Rigid const & xfmA
+		, Rigid const & xfmB
+		)
+	{
+		return Rigid{ xfmA.theSpin * xfmB.theSpin, xfmA(xfmB.theTran) };
+	}
+
+	/*! \brief Inverse transformation (for unitary theSpin).
+	 *
+	 * I.e. inverse(xfm)(xfm(vec)) equals vec.
+	 */
+	inline
+	Rigid
+	inverse
+		( Rigid const & xfm
+		)
+	{
+		Spinor const spinInv{ reverse(xfm.theSpin) };
+		Vector const tranInv
+			{ priv::matVecPlus
+				( priv::sandwichMatrix(spinInv)
+				, -xfm.theTran
+				, zero<Vector>()
+				)
+			};
+		return Rigid{ spinInv, tranInv };
+	}
+
+	/*! \brief Transformation fraction of the way from xfmA to xfmB.
+	 *
+	 * The rotation is interpolated at constant angular rate within
+	 * the plane of relative rotation (using pow() for Spinor) along
+	 * the shorter of the two arcs. The translation is interpolated
+	 * linearly. The results at frac equal 0 and 1 correspond to
+	 * xfmA and xfmB respectively (to within the spinor sign).
+	 */
+	inline
+	Rigid
+	interpolated
+		( Rigid const & xfmA
+		, Rigid const & xfmB
+		, double const & frac
+		)
+	{
+		Spinor spinDelta{ xfmB.theSpin * reverse(xfmA.theSpin) };
+		if (spinDelta.theSca.theData[0] < 0.)
+		{
+			spinDelta = -spinDelta; // equivalent rotation through shorter arc
+		}
+		return Rigid
+			{ pow(spinDelta, frac) * xfmA.theSpin
+			, (1. - frac) * xfmA.theTran + frac * xfmB.theTran
+			};
+	}
+
+
+namespace batch
+{
+	//! Transform each location vector in range by xfm.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	apply
+		( Rigid const & xfm
+		, InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		std::array<double, 9u> const mat{ priv::sandwichMatrix(xfm.theSpin) };
+		Vector const & tran = xfm.theTran;
+		for (InIter itIn{ itBeg } ; itEnd != itIn ; ++itIn)
+		{
+			*itOut++ = priv::matVecPlus(mat, *itIn, tran);
+		}
+		return itOut;
+	}
+
+	/*! \brief Transform location vectors concurrently (random access ranges).
+	 *
+	 * Same results as batch::apply() above. The range is processed
+	 * by numThreads threads (zero for hardware concurrency).
+	 */
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	apply
+		( Rigid const & xfm
+		, InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		, std::size_t const & numThreads
+		)
+	{
+		std::size_t const numPnts
+			{ static_cast<std::size_t>(std::distance(itBeg, itEnd)) };
+		priv::parallelFor
+			( numPnts
+			, [&xfm, &itBeg, &itOut]
+				(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+				{
+					batch::apply
+						( xfm
+						, itBeg + ndxBeg
+						, itBeg + ndxEnd
+						, itOut + ndxBeg
+						);
+				}
+			, numThreads
+			);
+		return itOut + numPnts;
+	}
+
+	/*! \brief Transform points stored as separate component arrays (SoA).
+	 *
+	 * The inXYZs arrays are the first, second and third vector components
+	 * of numPnts input points. Results are written to outXYZs (which
+	 * may be the same arrays as inXYZs for in-place operation).
+	 */
+	inline
+	void
+	apply
+		( Rigid const & xfm
+		, std::size_t const & numPnts
+		, std::array<double const *, 3u> const & inXYZs
+		, std::array<double *, 3u> const & outXYZs
+		, std::size_t const & numThreads = 1u
+		)
+	{
+		std::array<double, 9u> const mat{ priv::sandwichMatrix(xfm.theSpin) };
+		std::array<double, 3u> const tran{ xfm.theTran.theData };
+		priv::parallelFor
+			( numPnts
+			, [&mat, &tran, &inXYZs, &outXYZs]
+				(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+				{
+					double const * const inX{ inXYZs[0] };
+					double const * const inY{ inXYZs[1] };
+					double const * const inZ{ inXYZs[2] };
+					double * const outX{ outXYZs[0] };
+					double * const outY{ outXYZs[1] };
+					double * const outZ{ outXYZs[2] };
+					for (std::size_t nn{ndxBeg} ; nn < ndxEnd ; ++nn)
+					{
+						double const v1{ inX[nn] };
+						double const v2{ inY[nn] };
+						double const v3{ inZ[nn] };
+						outX[nn] = mat[0]*v1 + mat[1]*v2 + mat[2]*v3 + tran[0];
+						outY[nn] = mat[3]*v1 + mat[4]*v2 + mat[5]*v3 + tran[1];
+						outZ[nn] = mat[6]*v1 + mat[7]*v2 + mat[8]*v3 + tran[2];
+					}
+				}
+			, numThreads
+			);
+	}
+
+} // [batch]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3rigid_INCL_
@@ -0,0 +1,377 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3rotavg_INCL_
+#define engabra_g3rotavg_INCL_
+
+/*! \file
+\brief Averaging (mean) of many rotation spinors.
+
+\b Overview
+
+Component-wise averaging of spinors is not meaningful since S and -S
+represent the same rotation (the "double cover"). The functions here
+provide two well defined means:
+
+\arg chordalMean() - the unitary spinor that maximizes the weighted
+sum of squared scalar products with the inputs. This is the dominant
+eigenvector of the (4x4) weighted second moment matrix of the spinor
+components and is independent of the signs of the inputs. It requires
+a single pass through the data.
+
+\arg geodesicMean() - the unitary spinor that minimizes the weighted
+sum of squared rotation angles to the inputs (the Karcher mean). It is
+computed iteratively starting from the chordal mean: each iteration
+averages the bivector logarithms of the residual rotations (each
+aligned to the same hemisphere as the current mean) and updates the
+mean by exp() of the average. Iteration stops early once the update
+angle is below tolerance.
+
+Both means accept optional weights and accumulate partial sums
+concurrently (ref g3_parallel.hpp) with partial results combined in a
+fixed order (such that results are repeatable).
+
+Example:
+\snippet test_g3rotavg_all.cpp DoxyExample01
+
+*/
+
+
+#include "g3_eigen.hpp"
+#include "g3_parallel.hpp"
+#include "g3const.hpp"
+#include "g3func.hpp"
+#include "g3ops.hpp"
+#include "g3type.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+	//! Control parameters for the averaging functions.
+	struct AvgControl
+	{
+		//! Number of threads (zero for hardware concurrency)
+		std::size_t theNumThreads{ 0u };
+
+		//! Maximum number of geodesicMean() iterations
+		std::size_t theMaxIter{ 32u };
+
+		//! Convergence tolerance on geodesicMean() update [rad]
+		double theTol{ 1024. * std::numeric_limits<double>::epsilon() };
+	};
+
+	//! Result of geodesicMean()
+	struct SpinMean
+	{
+		//! Unitary mean spinor (null if no valid solution)
+		Spinor theSpin;
+
+		//! Weighted RMS of (full) rotation angles from inputs to mean
+		double theRmsAngle;
+
+		//! Number of iterations performed
+		std::size_t theNumIter;
+
+		//! True if update was below tolerance before theMaxIter
+		bool theConverged;
+	};
+
+namespace priv
+{
+	//! Upper triangle (10 elements) of weighted spinor moment matrix
+	using SpinMoments = std::array<double, 10u>;
+
+	//! Add weighted outer product of spin components to moments
+	inline
+	void
+	addSpinMoment
+		( SpinMoments & moms
+		, Spinor const & spin
+		, double const & wgt
+		)
+	{
+		std::array<double, 4u> const qq
+			{ spin.theSca.theData[0]
+			, spin.theBiv.theData[0]
+			, spin.theBiv.theData[1]
+			, spin.theBiv.theData[2]
+			};
+		std::size_t ndx{ 0u };
+		for (std::size_t row{0u} ; row < 4u ; ++row)
+		{
+			double const wq{ wgt * qq[row] };
+			for (std::size_t col{row} ; col < 4u ; ++col)
+			{
+				moms[ndx++] += wq * qq[col];
+			}
+		}
+	}
+
+	//! Unitary spinor (scalar >= 0) from dominant moment eigenvector
+	inline
+	Spinor
+	spinFromMoments
+		( SpinMoments const & moms
+		)
+	{
+		std::array<double, 16u> symMat{};
+		std::size_t ndx{ 0u };
+		for (std::size_t row{0u} ; row < 4u ; ++row)
+		{
+			for (std::size_t col{row} ; col < 4u ; ++col)
+			{
+				symMat[4u*row + col] = moms[ndx++];
+			}
+		}
+		Spinor spin{ null<Spinor>() };
+		if (isValid(moms) && (0. < (moms[0] + moms[4] + moms[7] + moms[9])))
+		{
+			SymEigen4 const eig{ SymEigen4::from(symMat) };
+			std::array<double, 4u> const & qq = eig.theVectors[0];
+			double const sgn{ (qq[0] < 0.) ? -1. : 1. };
+			spin = Spinor
+				{ sgn * qq[0]
+				, BiVector{ sgn * qq[1], sgn * qq[2], sgn * qq[3] }
+				};
+		}
+		return spin;
+	}
+
+	//! Unit weight source (for unweighted averages)
+	struct UnitWeights
+	{
+		//! Weight value (one) for any index
+		inline
+		double
+		operator[]
+			( std::size_t const & // ndx
+			) const
+		{
+			return 1.;
+		}
+	};
+
+	//! Chordal mean with weights accessible as itWgt[ndx]
+	template <typename SpinIter, typename WgtIter>
+	inline
+	Spinor
+	chordalMean
+		( SpinIter const & itBeg
+		, SpinIter const & itEnd
+		, WgtIter const & itWgt
+		, std::size_t const & numThreads
+		)
+	{
+		std::size_t const numItems
+			{ static_cast<std::size_t>(std::distance(itBeg, itEnd)) };
+		std::vector<SpinMoments> const parts
+			{ parallelPartials<SpinMoments>
+				( numItems
+				, [&itBeg, &itWgt]
+					(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+					{
+						SpinMoments part{};
+						for (std::size_t nn{ndxBeg} ; nn < ndxEnd ; ++nn)
+						{
+							addSpinMoment(part, itBeg[nn], itWgt[nn]);
+						}
+						return part;
+					}
+				, numThreads
+				)
+			};
+		SpinMoments moms{};
+		for (SpinMoments const & part : parts)
+		{
+			for (std::size_t nn{0u} ; nn < moms.size() ; ++nn)
+			{
+				moms[nn] += part[nn];
+			}
+		}
+		return spinFromMoments(moms);
+	}
+
+	//! Weighted sums of residual log bivectors (and squared magnitudes)
+	struct LogSums
+	{
+		BiVector theSumBiv{ 0., 0., 0. }; //!< Weighted sum of log bivectors
+		double theSumSq{ 0. }; //!< Weighted sum of squared log magnitudes
+		double theSumWgt{ 0. }; //!< Sum of weights
+	};
+
+	//! Geodesic mean with weights accessible as itWgt[ndx]
+	template <typename SpinIter, typename WgtIter>
+	inline
+	SpinMean
+	geodesicMean
+		( SpinIter const & itBeg
+		, SpinIter const & itEnd
+		, WgtIter const & itWgt
+		, AvgControl const & ctl
+		)
+	{
+		SpinMean result{ null<Spinor>(), null<double>(), 0u, false };
+		Spinor mean{ chordalMean(itBeg, itEnd, itWgt, ctl.theNumThreads) };
+		std::size_t const numItems
+			{ static_cast<std::size_t>(std::distance(itBeg, itEnd)) };
+		while (isValid(mean) && (result.theNumIter < ctl.theMaxIter))
+		{
+			Spinor const meanRev{ reverse(mean) };
+			std::vector<LogSums> const parts
+				{ parallelPartials<LogSums>
+					( numItems
+					, [&itBeg, &itWgt, &meanRev]
+						(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+						{
+							LogSums part;
+							for (std::size_t nn{ndxBeg} ; nn < ndxEnd ; ++nn)
+							{
+								Spinor rel{ meanRev * direction(itBeg[nn]) };
+								if (rel.theSca.theData[0] < 0.)
+								{
+									rel = -rel; // hemisphere alignment
+								}
+								BiVector const logBiv{ logBivOfUnit(rel) };
+								double const & wgt = itWgt[nn];
+								part.theSumBiv = part.theSumBiv + wgt * logBiv;
+								part.theSumSq += wgt * magSq(logBiv);
+								part.theSumWgt += wgt;
+							}
+							return part;
+						}
+					, ctl.theNumThreads
+					)
+				};
+			LogSums sums;
+			for (LogSums const & part : parts)
+			{
+				sums.theSumBiv = sums.theSumBiv + part.theSumBiv;
+				sums.theSumSq += part.theSumSq;
+				sums.theSumWgt += part.theSumWgt;
+			}
+			++result.theNumIter;
+
+			BiVector const delta{ (1. / sums.theSumWgt) * sums.theSumBiv };
+			mean = direction(mean * exp(delta));
+			// log bivector magnitude is half of rotation angle
+			result.theRmsAngle = 2. * std::sqrt(sums.theSumSq / sums.theSumWgt);
+			if (! (ctl.theTol < (2. * magnitude(delta))))
+			{
+				result.theConverged = isValid(mean);
+				break;
+			}
+		}
+		result.theSpin = mean;
+		return result;
+	}
+
+} // [priv]
+
+	/*! \brief Chordal mean of (unitary) spinors in range.
+	 *
+	 * The signs of the individual spinors do not matter. The result
+	 * is unitary with non-negative scalar grade. Requires random
+	 * access iterators. Null if the range is empty.
+	 */
+	template <typename SpinIter>
+	inline
+	Spinor
+	chordalMean
+		( SpinIter const & itBeg
+		, SpinIter const & itEnd
+		, AvgControl const & ctl = {}
+		)
+	{
+		return priv::chordalMean
+			(itBeg, itEnd, priv::UnitWeights{}, ctl.theNumThreads);
+	}
+
+	/*! \brief Weighted chordal mean of (unitary) spinors in range.
+	 *
+	 * The itWgt range provides one weight per spinor.
+	 */
+	template <typename SpinIter, typename WgtIter>
+	inline
+	Spinor
+	chordalMean
+		( SpinIter const & itBeg
+		, SpinIter const & itEnd
+		, WgtIter const & itWgt
+		, AvgControl const & ctl
+		)
+	{
+		return priv::chordalMean(itBeg, itEnd, itWgt, ctl.theNumThreads);
+	}
+
+	/*! \brief Geodesic (Karcher) mean of spinors in range.
+	 *
+	 * Input spinors are normalized (and aligned to the hemisphere of
+	 * the current mean) on each iteration. Requires random access
+	 * iterators. The result theSpin is null if the range is empty.
+	 */
+	template <typename SpinIter>
+	inline
+	SpinMean
+	geodesicMean
+		( SpinIter const & itBeg
+		, SpinIter const & itEnd
+		, AvgControl const & ctl = {}
+		)
+	{
+		return priv::geodesicMean(itBeg, itEnd, priv::UnitWeights{}, ctl);
+	}
+
+	//! Weighted geodesic mean (itWgt range provides one weight per spinor).
+	template <typename SpinIter, typename WgtIter>
+	inline
+	SpinMean
+	geodesicMean
+		( SpinIter const & itBeg
+		, SpinIter const & itEnd
+		, WgtIter const & itWgt
+		, AvgControl const & ctl
+		)
+	{
+		return priv::geodesicMean(itBeg, itEnd, itWgt, ctl);
+	}
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3rotavg_INCL_
@@ -0,0 +1,276 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3rotfit_INCL_
+#define engabra_g3rotfit_INCL_
+
+/*! \file
+\brief Best fit rotation (spinor) from vector correspondences.
+
+\b Overview
+
+Given pairs of vectors, (a_k, b_k), with optional weights, w_k, the
+RotFitter determines the unitary spinor, S, that minimizes
+
+	\f$ \sum_k w_k |b_k - S a_k \tilde{S}|^2 \f$
+
+(i.e. the orthogonal Procrustes, or Kabsch, problem restricted to
+proper rotations).
+
+The RotFitter is a streaming accumulator. Each correspondence adds
+to a 3x3 moment matrix and two scalar sums such that the memory and
+solution cost are independent of the number of correspondences.
+Accumulators (e.g. from different threads) combine with merge().
+
+The solution is the dominant eigenvector of a symmetric 4x4 matrix
+formed from the moments (in the manner of Horn's method). The sum of
+squared residuals follows from the dominant eigenvalue (without
+revisiting the data).
+
+Example:
+\snippet test_g3rotfit_all.cpp DoxyExample01
+
+The batch::rotFitterFor() function accumulates large correspondence
+arrays concurrently (ref g3_parallel.hpp).
+
+*/
+
+
+#include "g3_eigen.hpp"
+#include "g3_parallel.hpp"
+#include "g3const.hpp"
+#include "g3type.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+	//! Result from RotFitter::solution().
+	struct RotFit
+	{
+		//! Best fit unitary spinor (null if no solution).
+		Spinor theSpin;
+
+		//! Weighted sum of squared residual vector magnitudes.
+		double theSumSqRes;
+
+		//! Root mean square residual (per unit weight).
+		double theRmsRes;
+
+		/*! \brief Gap between two largest eigenvalues.
+		 *
+		 * A value near zero (relative to theSumSqRes) indicates that
+		 * the rotation is poorly determined (e.g. all vectors parallel).
+		 */
+		double theGap;
+
+		//! Number of correspondences used.
+		std::size_t theCount;
+	};
+
+	//! Streaming accumulator for best fit rotation estimation.
+	struct RotFitter
+	{
+		//! Moment: sum of weighted a[row]*b[col] (row major).
+		std::array<double, 9u> theMoms{};
+
+		//! Sum of weighted squared magnitudes of vecFrom (a) values.
+		double theSumSqFrom{ 0. };
+
+		//! Sum of weighted squared magnitudes of vecInto (b) values.
+		double theSumSqInto{ 0. };
+
+		//! Sum of weights.
+		double theSumWgt{ 0. };
+
+		//! Number of correspondences.
+		std::size_t theCount{ 0u };
+
+		//! Incorporate correspondence (vecInto is rotated vecFrom).
+		inline
+		void
+		add
+			( Vector const & vecFrom
+			, Vector const & vecInto
+			, double const & wgt = 1.
+			)
+		{
+			std::array<double, 3u> const & aa = vecFrom.theData;
+			std::array<double, 3u> const & bb = vecInto.theData;
+			for (std::size_t row{0u} ; row < 3u ; ++row)
+			{
+				double const wa{ wgt * aa[row] };
+				theMoms[3u*row    ] += wa * bb[0];
+				theMoms[3u*row + 1u] += wa * bb[1];
+				theMoms[3u*row + 2u] += wa * bb[2];
+			}
+			theSumSqFrom += wgt * (aa[0]*aa[0] + aa[1]*aa[1] + aa[2]*aa[2]);
+			theSumSqInto += wgt * (bb[0]*bb[0] + bb[1]*bb[1] + bb[2]*bb[2]);
+			theSumWgt += wgt;
+			++theCount;
+		}
+
+		//! Incorporate (unit weight) correspondences from two ranges.
+		template <typename FromIter, typename IntoIter>
+		inline
+		void
+		add
+			( FromIter const & itFromBeg
+			, FromIter const & itFromEnd
+			, IntoIter itInto
+			)
+		{
+			for (FromIter itFrom{ itFromBeg } ; itFromEnd != itFrom ; ++itFrom)
+			{
+				add(*itFrom, *itInto++);
+			}
+		}
+
+		//! Incorporate accumulations from another instance.
+		inline
+		void
+		merge
+			( RotFitter const & other
+			)
+		{
+			for (std::size_t nn{0u} ; nn < 9u ; ++nn)
+			{
+				theMoms[nn] += other.theMoms[nn];
+			}
+			theSumSqFrom += other.theSumSqFrom;
+			theSumSqInto += other.theSumSqInto;
+			theSumWgt += other.theSumWgt;
+			theCount += other.theCount;
+		}
+
+		//! Best fit rotation and residual statistics.
+		inline
+		RotFit
+		solution
+			() const
+		{
+			RotFit fit{ null<Spinor>(), nan, nan, nan, theCount };
+			if ((0u < theCount) && (0. < theSumWgt))
+			{
+				double const & sxx = theMoms[0];
+				double const & sxy = theMoms[1];
+				double const & sxz = theMoms[2];
+				double const & syx = theMoms[3];
+				double const & syy = theMoms[4];
+				double const & syz = theMoms[5];
+				double const & szx = theMoms[6];
+				double const & szy = theMoms[7];
+				double const & szz = theMoms[8];
+
+				// symmetric matrix in (w, x, y, z) with bivector = -(x,y,z)
+				std::array<double, 16u> const symMat
+					{ sxx + syy + szz, syz - szy, szx - sxz, sxy - syx
+					, 0., sxx - syy - szz, sxy + syx, szx + sxz
+					, 0., 0., -sxx + syy - szz, syz + szy
+					, 0., 0., 0., -sxx - syy + szz
+					};
+				priv::SymEigen4 const eig{ priv::SymEigen4::from(symMat) };
+				std::array<double, 4u> const & qq = eig.theVectors[0];
+				double const sgn{ (qq[0] < 0.) ? -1. : 1. };
+				fit.theSpin = Spinor
+					{ sgn * qq[0]
+					, BiVector{ -sgn * qq[1], -sgn * qq[2], -sgn * qq[3] }
+					};
+
+				double const sumSq
+					{ theSumSqFrom + theSumSqInto - 2. * eig.theValues[0] };
+				fit.theSumSqRes = std::max(0., sumSq);
+				fit.theRmsRes = std::sqrt(fit.theSumSqRes / theSumWgt);
+				fit.theGap = eig.theValues[0] - eig.theValues[1];
+			}
+			return fit;
+		}
+	};
+
+
+namespace batch
+{
+	/*! \brief RotFitter with all (unit weight) correspondences in ranges.
+	 *
+	 * Accumulation is performed concurrently (numThreads of zero for
+	 * hardware concurrency) with per-thread accumulators merged (in
+	 * range order) at completion. Requires random access iterators.
+	 */
+	template <typename FromIter, typename IntoIter>
+	inline
+	RotFitter
+	rotFitterFor
+		( FromIter const & itFromBeg
+		, FromIter const & itFromEnd
+		, IntoIter const & itInto
+		, std::size_t const & numThreads = 0u
+		)
+	{
+		std::size_t const numItems
+			{ static_cast<std::size_t>(std::distance(itFromBeg, itFromEnd)) };
+		std::vector<RotFitter> const parts
+			{ priv::parallelPartials<RotFitter>
+				( numItems
+				, [&itFromBeg, &itInto]
+					(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+					{
+						RotFitter part;
+						part.add
+							( itFromBeg + ndxBeg
+							, itFromBeg + ndxEnd
+							, itInto + ndxBeg
+							);
+						return part;
+					}
+				, numThreads
+				)
+			};
+		RotFitter fitter;
+		for (RotFitter const & part : parts)
+		{
+			fitter.merge(part);
+		}
+		return fitter;
+	}
+
+} // [batch]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3rotfit_INCL_
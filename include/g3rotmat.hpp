@@ -0,0 +1,324 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3rotmat_INCL_
+#define engabra_g3rotmat_INCL_
+
+/*! \file
+\brief Conversions between unitary Spinors and 3x3 rotation matrices.
+
+\b Overview
+
+A RotMatrix is a 3x3 matrix stored in row-major order. The matrix
+associated with a spinor, S, is that for which matrix multiplication
+produces the same result as the sandwich product. I.e.
+
+	\f$ M v == S v \tilde{S} \f$
+
+Functions include:
+\arg matrixFrom() - rotation matrix from (normalized) spinor
+\arg spinorFrom() - unitary spinor from rotation matrix
+\arg orthogonalityError() - departure of matrix from orthonormality
+
+The spinorFrom() conversion uses Shepperd's method. I.e. the largest of
+the four diagonal-sum combinations is used to determine one spinor
+component by a square root, and the remaining components are obtained
+from off-diagonal sums and differences divided by it. This avoids the
+loss of precision that occurs near half-turn rotations with trace-only
+formulae. The returned spinor is normalized with non-negative scalar
+grade (the spinors S and -S represent the same rotation). For exact
+half turns (zero scalar grade) the sign is that produced by the
+selected branch.
+
+Example:
+\snippet test_g3rotmat_all.cpp DoxyExample01
+
+Batch versions of the conversions (with optional multithreading) are
+provided in namespace batch.
+
+*/
+
+
+#include "g3_parallel.hpp"
+#include "g3func.hpp"
+#include "g3type.hpp"
+#include "g3validity.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+	//! 3x3 matrix with elements in row-major order.
+	using RotMatrix = std::array<double, 9u>;
+
+namespace priv
+{
+	/*! \brief Matrix (row major) equivalent to spin*vec*reverse(spin).
+	 *
+	 * For a unitary spin, this is an orthonormal rotation matrix. For a
+	 * non-unitary spin, the matrix is scaled by magSq(spin) (consistent
+	 * with the sandwich product).
+	 */
+	inline
+	std::array<double, 9u>
+	sandwichMatrix
+		( Spinor const & spin
+		)
+	{
+		double const & aa = spin.theSca.theData[0];
+		double const & b1 = spin.theBiv.theData[0];
+		double const & b2 = spin.theBiv.theData[1];
+		double const & b3 = spin.theBiv.theData[2];
+		double const a2{ aa * aa };
+		double const b11{ b1 * b1 };
+		double const b22{ b2 * b2 };
+		double const b33{ b3 * b3 };
+		double const b12{ 2. * b1 * b2 };
+		double const b13{ 2. * b1 * b3 };
+		double const b23{ 2. * b2 * b3 };
+		double const ab1{ 2. * aa * b1 };
+		double const ab2{ 2. * aa * b2 };
+		double const ab3{ 2. * aa * b3 };
+		return std::array<double, 9u>
+			{ a2 + b11 - b22 - b33, b12 + ab3, b13 - ab2
+			, b12 - ab3, a2 - b11 + b22 - b33, b23 + ab1
+			, b13 + ab2, b23 - ab1, a2 - b11 - b22 + b33
+			};
+	}
+
+} // [priv]
+
+	/*! \brief Rotation matrix equivalent to sandwich with (normalized) spin.
+	 *
+	 * A null matrix is returned if spin is too small to normalize.
+	 */
+	inline
+	RotMatrix
+	matrixFrom
+		( Spinor const & spin
+		)
+	{
+		RotMatrix mat{ priv::sandwichMatrix(spin) };
+		double const scale{ priv::invOrNaN(magSq(spin)) };
+		for (double & elem : mat)
+		{
+			elem *= scale;
+		}
+		return mat;
+	}
+
+	/*! \brief Unitary spinor (with scalar >= 0) for rotation matrix.
+	 *
+	 * The matrix is expected to be (nearly) orthonormal with determinant
+	 * of +1. Small departures from orthonormality are absorbed by the
+	 * normalization of the result.
+	 */
+	inline
+	Spinor
+	spinorFrom
+		( RotMatrix const & mat
+		)
+	{
+		double const & m00 = mat[0];
+		double const & m01 = mat[1];
+		double const & m02 = mat[2];
+		double const & m10 = mat[3];
+		double const & m11 = mat[4];
+		double const & m12 = mat[5];
+		double const & m20 = mat[6];
+		double const & m21 = mat[7];
+		double const & m22 = mat[8];
+
+		// Shepperd: diagonal combinations (each is 4 times a squared
+		// component: scalar, and negatives of each bivector component)
+		double const trc{ m00 + m11 + m22 };
+		double const dd0{ 1. + trc };
+		double const dd1{ 1. + m00 - m11 - m22 };
+		double const dd2{ 1. - m00 + m11 - m22 };
+		double const dd3{ 1. - m00 - m11 + m22 };
+
+		// quaternion-like components (w, x, y, z) with bivector = -(x,y,z)
+		std::array<double, 4u> qq;
+		if ((dd1 <= dd0) && (dd2 <= dd0) && (dd3 <= dd0))
+		{
+			double const ww{ .5 * std::sqrt(dd0) };
+			double const den{ .25 / ww };
+			qq = { ww, den*(m21 - m12), den*(m02 - m20), den*(m10 - m01) };
+		}
+		else
+		if ((dd2 <= dd1) && (dd3 <= dd1))
+		{
+			double const xx{ .5 * std::sqrt(dd1) };
+			double const den{ .25 / xx };
+			qq = { den*(m21 - m12), xx, den*(m01 + m10), den*(m02 + m20) };
+		}
+		else
+		if (dd3 <= dd2)
+		{
+			double const yy{ .5 * std::sqrt(dd2) };
+			double const den{ .25 / yy };
+			qq = { den*(m02 - m20), den*(m01 + m10), yy, den*(m12 + m21) };
+		}
+		else
+		{
+			double const zz{ .5 * std::sqrt(dd3) };
+			double const den{ .25 / zz };
+			qq = { den*(m10 - m01), den*(m02 + m20), den*(m12 + m21), zz };
+		}
+
+		// normalize (with scalar grade non-negative)
+		double const mag
+			{ std::sqrt
+				(qq[0]*qq[0] + qq[1]*qq[1] + qq[2]*qq[2] + qq[3]*qq[3])
+			};
+		double scale{ priv::invMagOrNaN(mag) };
+		if (qq[0] < 0.)
+		{
+			scale = -scale;
+		}
+		return Spinor
+			{ scale * qq[0]
+			, BiVector{ -scale * qq[1], -scale * qq[2], -scale * qq[3] }
+			};
+	}
+
+	/*! \brief Largest absolute element of (mat * transpose(mat) - identity).
+	 *
+	 * Is zero for an exactly orthonormal matrix.
+	 */
+	inline
+	double
+	orthogonalityError
+		( RotMatrix const & mat
+		)
+	{
+		double maxErr{ 0. };
+		for (std::size_t row{0u} ; row < 3u ; ++row)
+		{
+			for (std::size_t col{0u} ; col < 3u ; ++col)
+			{
+				double dot{ (row == col) ? -1. : 0. };
+				for (std::size_t kk{0u} ; kk < 3u ; ++kk)
+				{
+					dot += mat[3u*row + kk] * mat[3u*col + kk];
+				}
+				maxErr = std::max(maxErr, std::abs(dot));
+			}
+		}
+		if (! isValid(mat))
+		{
+			maxErr = null<double>();
+		}
+		return maxErr;
+	}
+
+
+namespace batch
+{
+	//! Rotation matrix (ref g3::matrixFrom()) for each spinor in range.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	matrixFrom
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (Spinor const & spin) { return g3::matrixFrom(spin); }
+			);
+	}
+
+	//! Unitary spinor (ref g3::spinorFrom()) for each matrix in range.
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	spinorFrom
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		)
+	{
+		return std::transform
+			( itBeg, itEnd, itOut
+			, [] (RotMatrix const & mat) { return g3::spinorFrom(mat); }
+			);
+	}
+
+	//! Concurrent batch::matrixFrom() (random access ranges).
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	matrixFrom
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		, std::size_t const & numThreads
+		)
+	{
+		return priv::parallelTransform
+			( itBeg, itEnd, itOut
+			, [] (Spinor const & spin) { return g3::matrixFrom(spin); }
+			, numThreads
+			);
+	}
+
+	//! Concurrent batch::spinorFrom() (random access ranges).
+	template <typename InIter, typename OutIter>
+	inline
+	OutIter
+	spinorFrom
+		( InIter const & itBeg
+		, InIter const & itEnd
+		, OutIter itOut
+		, std::size_t const & numThreads
+		)
+	{
+		return priv::parallelTransform
+			( itBeg, itEnd, itOut
+			, [] (RotMatrix const & mat) { return g3::spinorFrom(mat); }
+			, numThreads
+			);
+	}
+
+} // [batch]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3rotmat_INCL_
@@ -0,0 +1,555 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3rotsync_INCL_
+#define engabra_g3rotsync_INCL_
+
+/*! \file
+\brief Rotation synchronization: absolute attitudes from relative ones.
+
+\b Overview
+
+Given a graph of numNodes frames with edges providing (noisy) relative
+rotations, RelSpin, the function rotSync() estimates an absolute
+attitude spinor for each node such that, for each edge,
+
+	\f$ S_{into} \approx R_{edge} S_{from} \f$
+
+The (gauge) freedom of an overall rotation is removed by holding the
+attitude of an anchor node at identity.
+
+The solution is computed in two stages:
+\arg Initialization - attitudes are propagated outward from the anchor
+along a breadth first spanning tree.
+\arg Refinement - each (Gauss-Newton) iteration linearizes the edge
+residuals in terms of bivector corrections, x_n, to each attitude (as
+S_n*exp(x_n)). The edge residual logarithms, e, relate corrections by
+x_into - x_from = e, such that the least squares corrections satisfy a
+sparse (weighted graph Laplacian) linear system. This is solved by a
+preconditioned conjugate gradient iteration in which the sparse matrix
+products, vector updates and inner products are evaluated in two fused
+concurrent passes over nodes per iteration (ref g3_parallel.hpp) with
+results that are repeatable for a given number of threads. Refinement
+stops early once the largest correction angle is below tolerance.
+
+Nodes that are not connected (through valid edges) to the anchor have
+null attitudes in the result. Edges with out-of-range node indices,
+null spinors or non-positive weights are ignored.
+
+Example:
+\snippet test_g3rotsync_all.cpp DoxyExample01
+
+*/
+
+
+#include "g3_parallel.hpp"
+#include "g3_private.hpp"
+#include "g3const.hpp"
+#include "g3func.hpp"
+#include "g3ops.hpp"
+#include "g3rotavg.hpp"
+#include "g3type.hpp"
+#include "g3validity.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+	//! Relative rotation between two nodes: S_into = theSpin * S_from
+	struct RelSpin
+	{
+		std::size_t theNdxFrom; //!< Index of node with attitude S_from
+		std::size_t theNdxInto; //!< Index of node with attitude S_into
+		Spinor theSpin; //!< Unitary relative rotation
+		double theWgt{ 1. }; //!< Relative weight (must be positive)
+	};
+
+	//! Control parameters for rotSync()
+	struct SyncControl
+	{
+		//! Node with attitude held at identity.
+		std::size_t theNdxAnchor{ 0u };
+
+		//! Number of threads (zero for hardware concurrency).
+		std::size_t theNumThreads{ 0u };
+
+		//! Maximum number of (outer) refinement iterations.
+		std::size_t theMaxIter{ 16u };
+
+		//! Maximum number of conjugate gradient iterations (per refinement).
+		std::size_t theMaxIterCG{ 1000u };
+
+		//! Conjugate gradient stop: residual norm relative to initial.
+		double theTolCG{ 1.e-8 };
+
+		//! Convergence tolerance on largest correction angle [rad].
+		double theTol{ 1.e-12 };
+	};
+
+	//! Result of rotSync()
+	struct SyncResult
+	{
+		//! Absolute attitude for each node (null for unconnected nodes).
+		std::vector<Spinor> theSpins;
+
+		//! Weighted RMS of (full) rotation angle residuals over edges.
+		double theRmsAngle;
+
+		//! Number of refinement iterations performed.
+		std::size_t theNumIter;
+
+		//! True if attitude corrections fell below tolerance.
+		bool theConverged;
+	};
+
+namespace priv
+{
+	//! Minimum number of nodes per thread for concurrent node processing
+	constexpr std::size_t sSyncMinPerThread{ 1024u };
+
+	//! Adjacency entry: attitude estimate at node is theSpin * S_other
+	struct SyncLink
+	{
+		std::size_t theNdxOther; //!< Neighbor node index
+		Spinor theSpin; //!< Rotation from neighbor to this node
+		double theWgt; //!< Edge weight
+	};
+
+	//! Compressed (sparse row) adjacency for all nodes.
+	struct SyncGraph
+	{
+		//! Links for node nn are in [theOffsets[nn], theOffsets[nn+1])
+		std::vector<std::size_t> theOffsets;
+
+		//! Links for all nodes
+		std::vector<SyncLink> theLinks;
+
+		//! Construct from edges (ignoring invalid ones)
+		inline
+		static
+		SyncGraph
+		from
+			( std::size_t const & numNodes
+			, std::vector<RelSpin> const & edges
+			)
+		{
+			auto const useEdge
+				{ [&numNodes] (RelSpin const & edge) -> bool
+					{
+						return
+							{  (edge.theNdxFrom < numNodes)
+							&& (edge.theNdxInto < numNodes)
+							&& (edge.theNdxFrom != edge.theNdxInto)
+							&& isValid(edge.theSpin)
+							&& (0. < edge.theWgt)
+							};
+					}
+				};
+
+			SyncGraph graph;
+			graph.theOffsets.assign(numNodes + 1u, 0u);
+			for (RelSpin const & edge : edges)
+			{
+				if (useEdge(edge))
+				{
+					++graph.theOffsets[edge.theNdxFrom + 1u];
+					++graph.theOffsets[edge.theNdxInto + 1u];
+				}
+			}
+			for (std::size_t nn{0u} ; nn < numNodes ; ++nn)
+			{
+				graph.theOffsets[nn + 1u] += graph.theOffsets[nn];
+			}
+
+			graph.theLinks.resize(graph.theOffsets.back());
+			std::vector<std::size_t> fills
+				(graph.theOffsets.cbegin(), graph.theOffsets.cend() - 1);
+			for (RelSpin const & edge : edges)
+			{
+				if (useEdge(edge))
+				{
+					Spinor const spin{ direction(edge.theSpin) };
+					graph.theLinks[fills[edge.theNdxInto]++] = SyncLink
+						{ edge.theNdxFrom, spin, edge.theWgt };
+					graph.theLinks[fills[edge.theNdxFrom]++] = SyncLink
+						{ edge.theNdxInto, reverse(spin), edge.theWgt };
+				}
+			}
+			return graph;
+		}
+	};
+
+	//! Spinor aligned to same hemisphere as spinRef
+	inline
+	Spinor
+	alignedTo
+		( Spinor const & spin
+		, Spinor const & spinRef
+		)
+	{
+		double const dot
+			{ spin.theSca.theData[0] * spinRef.theSca.theData[0]
+			+ spin.theBiv.theData[0] * spinRef.theBiv.theData[0]
+			+ spin.theBiv.theData[1] * spinRef.theBiv.theData[1]
+			+ spin.theBiv.theData[2] * spinRef.theBiv.theData[2]
+			};
+		return (dot < 0.) ? -spin : spin;
+	}
+
+	//! Attitudes propagated from anchor along breadth first spanning tree.
+	inline
+	std::vector<Spinor>
+	syncSpanningTree
+		( SyncGraph const & graph
+		, std::size_t const & ndxAnchor
+		)
+	{
+		std::size_t const numNodes{ graph.theOffsets.size() - 1u };
+		std::vector<Spinor> spins(numNodes, null<Spinor>());
+		if (ndxAnchor < numNodes)
+		{
+			std::vector<std::size_t> queue;
+			queue.reserve(numNodes);
+			spins[ndxAnchor] = one<Spinor>();
+			queue.emplace_back(ndxAnchor);
+			for (std::size_t qq{0u} ; qq < queue.size() ; ++qq)
+			{
+				std::size_t const ndxNode{ queue[qq] };
+				for (std::size_t ll{graph.theOffsets[ndxNode]}
+					; ll < graph.theOffsets[ndxNode + 1u] ; ++ll)
+				{
+					// link at node gives node from other; need other from node
+					SyncLink const & link = graph.theLinks[ll];
+					if (! isValid(spins[link.theNdxOther]))
+					{
+						spins[link.theNdxOther]
+							= reverse(link.theSpin) * spins[ndxNode];
+						queue.emplace_back(link.theNdxOther);
+					}
+				}
+			}
+		}
+		return spins;
+	}
+
+	//! True if node nn attitude is subject to correction
+	inline
+	bool
+	syncIsFree
+		( std::vector<Spinor> const & spins
+		, SyncControl const & ctl
+		, std::size_t const & nn
+		)
+	{
+		return ((ctl.theNdxAnchor != nn) && isValid(spins[nn]));
+	}
+
+	//! Partial sums accumulated over nodes by the CG update pass.
+	struct SyncSums
+	{
+		double theRZ{ 0. }; //!< Sum of residual/preconditioned products
+		double theRR{ 0. }; //!< Sum of squared residuals
+	};
+
+	//! Sum partial results from chunks (in chunk order for repeatability)
+	inline
+	SyncSums
+	syncSumOf
+		( std::vector<SyncSums> const & parts
+		)
+	{
+		SyncSums sum{};
+		for (SyncSums const & part : parts)
+		{
+			sum.theRZ += part.theRZ;
+			sum.theRR += part.theRR;
+		}
+		return sum;
+	}
+
+	/*! \brief Next CG search direction and its Laplacian product.
+	 *
+	 * Updates (in one concurrent pass over nodes) the direction,
+	 * pp = zz + beta*pp, and its product with the weighted graph
+	 * Laplacian (zero rows for fixed nodes), app, and returns the
+	 * scalar product of pp with app. The product is updated as
+	 * app = L*zz + beta*app so that each node reads only the zz values
+	 * (not written in this pass) of its neighbors.
+	 */
+	inline
+	double
+	syncDirectionPass
+		( SyncGraph const & graph
+		, std::vector<Spinor> const & spins
+		, SyncControl const & ctl
+		, std::vector<BiVector> const & zz
+		, double const & beta
+		, std::vector<BiVector> & pp
+		, std::vector<BiVector> & app
+		)
+	{
+		std::vector<double> const parts
+			{ parallelPartials<double>
+				( zz.size()
+				, [&graph, &spins, &ctl, &zz, &beta, &pp, &app]
+					(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+					{
+						double pap{ 0. };
+						for (std::size_t nn{ndxBeg} ; nn < ndxEnd ; ++nn)
+						{
+							BiVector sum{ zero<BiVector>() };
+							if (syncIsFree(spins, ctl, nn))
+							{
+								for (std::size_t ll{graph.theOffsets[nn]}
+									; ll < graph.theOffsets[nn + 1u] ; ++ll)
+								{
+									SyncLink const & link = graph.theLinks[ll];
+									BiVector const dif
+										{ zz[nn] - zz[link.theNdxOther] };
+									sum = sum + link.theWgt * dif;
+								}
+							}
+							pp[nn] = zz[nn] + beta * pp[nn];
+							app[nn] = sum + beta * app[nn];
+							pap += prodComm(pp[nn].theData, app[nn].theData);
+						}
+						return pap;
+					}
+				, ctl.theNumThreads
+				, sSyncMinPerThread
+				)
+			};
+		return std::accumulate(parts.cbegin(), parts.cend(), 0.);
+	}
+
+	/*! \brief Bivector corrections for attitudes (ref rotSync()).
+	 *
+	 * Solves the weighted graph Laplacian system (with corrections held
+	 * at zero for the anchor and for inactive nodes) by conjugate
+	 * gradient iteration with diagonal (Jacobi) preconditioning. Each
+	 * iteration makes two concurrent passes over the nodes: one for the
+	 * search direction and its Laplacian product (ref
+	 * syncDirectionPass()) and one for the solution, residual and
+	 * preconditioned residual updates (with their scalar products).
+	 * Iteration stops once the residual norm is reduced by the factor
+	 * SyncControl::theTolCG.
+	 */
+	inline
+	std::vector<BiVector>
+	syncCorrections
+		( SyncGraph const & graph
+		, std::vector<Spinor> const & spins
+		, SyncControl const & ctl
+		)
+	{
+		std::size_t const numNodes{ spins.size() };
+		std::size_t const & numThreads = ctl.theNumThreads;
+		// initial residual (weighted edge residual logs) and diagonal
+		std::vector<BiVector> rr(numNodes, zero<BiVector>());
+		std::vector<BiVector> zz(numNodes, zero<BiVector>());
+		std::vector<double> invDiag(numNodes, 0.);
+		SyncSums sums{ syncSumOf
+			( parallelPartials<SyncSums>
+				( numNodes
+				, [&graph, &spins, &ctl, &rr, &zz, &invDiag]
+					(std::size_t const & ndxBeg, std::size_t const & ndxEnd)
+					{
+						SyncSums part{};
+						for (std::size_t nn{ndxBeg} ; nn < ndxEnd ; ++nn)
+						{
+							if (! syncIsFree(spins, ctl, nn))
+							{
+								continue;
+							}
+							Spinor const spinRev{ reverse(spins[nn]) };
+							BiVector sum{ zero<BiVector>() };
+							double diag{ 0. };
+							for (std::size_t ll{graph.theOffsets[nn]}
+								; ll < graph.theOffsets[nn + 1u] ; ++ll)
+							{
+								SyncLink const & link = graph.theLinks[ll];
+								Spinor const & spinOther
+									= spins[link.theNdxOther];
+								Spinor const err
+									{ spinRev * link.theSpin * spinOther };
+								Spinor const errAligned
+									{ alignedTo(err, one<Spinor>()) };
+								sum = sum
+									+ link.theWgt * logBivOfUnit(errAligned);
+								diag += link.theWgt;
+							}
+							rr[nn] = sum;
+							invDiag[nn] = 1. / diag;
+							zz[nn] = invDiag[nn] * sum;
+							part.theRZ += prodComm(sum.theData, zz[nn].theData);
+							part.theRR += prodComm(sum.theData, sum.theData);
+						}
+						return part;
+					}
+				, numThreads
+				, sSyncMinPerThread
+				)
+			) };
+
+		// preconditioned conjugate gradient (starting from zero)
+		std::vector<BiVector> xx(numNodes, zero<BiVector>());
+		std::vector<BiVector> pp(numNodes, zero<BiVector>());
+		std::vector<BiVector> app(numNodes, zero<BiVector>());
+		double const rrTol{ ctl.theTolCG * ctl.theTolCG * sums.theRR };
+		double beta{ 0. };
+		for (std::size_t iter{0u} ; iter < ctl.theMaxIterCG ; ++iter)
+		{
+			if (! (rrTol < sums.theRR))
+			{
+				break;
+			}
+			double const pap
+				{ syncDirectionPass(graph, spins, ctl, zz, beta, pp, app) };
+			if (! (0. < pap))
+			{
+				break;
+			}
+			double const alpha{ sums.theRZ / pap };
+			SyncSums const sumsNext{ syncSumOf
+				( parallelPartials<SyncSums>
+					( numNodes
+					, [&alpha, &invDiag, &pp, &app, &xx, &rr, &zz]
+						( std::size_t const & ndxBeg
+						, std::size_t const & ndxEnd
+						)
+						{
+							SyncSums part{};
+							for (std::size_t nn{ndxBeg} ; nn < ndxEnd ; ++nn)
+							{
+								xx[nn] = xx[nn] + alpha * pp[nn];
+								rr[nn] = rr[nn] - alpha * app[nn];
+								zz[nn] = invDiag[nn] * rr[nn];
+								part.theRZ += prodComm
+									(rr[nn].theData, zz[nn].theData);
+								part.theRR += prodComm
+									(rr[nn].theData, rr[nn].theData);
+							}
+							return part;
+						}
+					, numThreads
+					, sSyncMinPerThread
+					)
+				) };
+			beta = sumsNext.theRZ / sums.theRZ;
+			sums = sumsNext;
+		}
+		return xx;
+	}
+
+} // [priv]
+
+	/*! \brief Absolute attitudes consistent with relative rotation edges.
+	 *
+	 * Ref file description for algorithm. Edge spinors are normalized
+	 * before use and their signs do not matter.
+	 */
+	inline
+	SyncResult
+	rotSync
+		( std::size_t const & numNodes
+		, std::vector<RelSpin> const & edges
+		, SyncControl const & ctl = {}
+		)
+	{
+		SyncResult result{ {}, null<double>(), 0u, false };
+		priv::SyncGraph const graph{ priv::SyncGraph::from(numNodes, edges) };
+		std::vector<Spinor> spins
+			{ priv::syncSpanningTree(graph, ctl.theNdxAnchor) };
+
+		while (result.theNumIter < ctl.theMaxIter)
+		{
+			std::vector<BiVector> const corrs
+				{ priv::syncCorrections(graph, spins, ctl) };
+			double maxCorrSq{ 0. };
+			for (std::size_t nn{0u} ; nn < numNodes ; ++nn)
+			{
+				if (isValid(spins[nn]))
+				{
+					spins[nn] = direction(spins[nn] * exp(corrs[nn]));
+					maxCorrSq = std::max(maxCorrSq, magSq(corrs[nn]));
+				}
+			}
+			++result.theNumIter;
+
+			// bivector log magnitude is half of rotation angle
+			if (! (ctl.theTol < (2. * std::sqrt(maxCorrSq))))
+			{
+				result.theConverged = true;
+				break;
+			}
+		}
+
+		// residuals over edges
+		double sumSq{ 0. };
+		double sumWgt{ 0. };
+		for (std::size_t nn{0u} ; nn < numNodes ; ++nn)
+		{
+			for (std::size_t ll{graph.theOffsets[nn]}
+				; ll < graph.theOffsets[nn + 1u] ; ++ll)
+			{
+				priv::SyncLink const & link = graph.theLinks[ll];
+				Spinor const est{ link.theSpin * spins[link.theNdxOther] };
+				if (isValid(est) && isValid(spins[nn]))
+				{
+					Spinor const relRaw{ reverse(spins[nn]) * est };
+					Spinor const rel{ priv::alignedTo(relRaw, one<Spinor>()) };
+					BiVector const logBiv{ priv::logBivOfUnit(rel) };
+					double const angle{ 2. * magnitude(logBiv) };
+					sumSq += link.theWgt * angle * angle;
+					sumWgt += link.theWgt;
+				}
+			}
+		}
+		if (0. < sumWgt)
+		{
+			result.theRmsAngle = std::sqrt(sumSq / sumWgt);
+		}
+
+		result.theSpins = std::move(spins);
+		return result;
+	}
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3rotsync_INCL_
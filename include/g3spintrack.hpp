@@ -0,0 +1,443 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#ifndef engabra_g3spintrack_INCL_
+#define engabra_g3spintrack_INCL_
+
+/*! \file
+\brief Compressed storage of spinor time series (attitude trajectories).
+
+\b Overview
+
+Successive attitudes of a (densely sampled) trajectory differ by small
+rotations. The codec::SpinTrack structure stores a spinor sequence as
+a byte stream in which each sample is (usually) the quantized logarithm
+of the relative rotation from the previous (reconstructed) sample:
+
+\arg Delta records - the three bivector components of the log of the
+relative rotation, each quantized with a fixed step and stored as a
+variable length (zig-zag, LEB128) integer. Small rotations require only
+one or two bytes per component.
+
+\arg Key records - the full spinor (four doubles, exact). Keys are
+stored every TrackParms::theKeyInterval samples (providing random
+access via SpinTrack::operator[]()) and also whenever a sample (or its
+predecessor) is null or has a zero or non-finite magnitude.
+
+The encoder forms each relative rotation with respect to the decoded
+(not original) previous sample, so that quantization errors do not
+accumulate. Every decoded sample is within TrackParms::theMaxAngleErr
+(rotation angle, radians) of the original. Decoded spinors also retain
+the sign of the original samples. Samples decoded from delta records
+are unitary (key records reproduce the original values exactly).
+
+Example:
+\snippet test_g3spintrack_all.cpp DoxyExample01
+
+*/
+
+
+#include "g3const.hpp"
+#include "g3func.hpp"
+#include "g3ops.hpp"
+#include "g3type.hpp"
+#include "g3validity.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+namespace engabra
+{
+
+namespace g3
+{
+
+namespace codec
+{
+	//! Parameters controlling SpinTrack encoding
+	struct TrackParms
+	{
+		//! Maximum rotation angle error (radians) of decoded samples
+		double theMaxAngleErr{ 1.e-6 };
+
+		//! Number of samples between (scheduled) key records
+		std::size_t theKeyInterval{ 256u };
+
+		/*! \brief Quantization step for log bivector components.
+		 *
+		 * With per component errors at most half a step, the rotation
+		 * angle error is at most 2*sqrt(3)*(step/2) = sqrt(3)*step.
+		 */
+		inline
+		double
+		quantStep
+			() const
+		{
+			return theMaxAngleErr / 1.7320508075688772935;
+		}
+	};
+
+namespace priv
+{
+	//! Append variable length (LEB128) encoding of value
+	inline
+	void
+	putVarint
+		( std::vector<std::uint8_t> & bytes
+		, std::uint64_t value
+		)
+	{
+		while (0x80u <= value)
+		{
+			bytes.emplace_back(static_cast<std::uint8_t>(value | 0x80u));
+			value >>= 7u;
+		}
+		bytes.emplace_back(static_cast<std::uint8_t>(value));
+	}
+
+	//! Value decoded from LEB128 bytes (and offset advanced past them)
+	inline
+	std::uint64_t
+	getVarint
+		( std::vector<std::uint8_t> const & bytes
+		, std::size_t & offset
+		)
+	{
+		std::uint64_t value{ 0u };
+		std::size_t shift{ 0u };
+		std::uint8_t byte{ 0x80u };
+		while ((0x80u & byte) && (offset < bytes.size()) && (shift < 64u))
+		{
+			byte = bytes[offset++];
+			value |= (static_cast<std::uint64_t>(byte & 0x7Fu) << shift);
+			shift += 7u;
+		}
+		return value;
+	}
+
+	//! Zig-zag mapping of signed values to unsigned (small magnitudes)
+	inline
+	std::uint64_t
+	zigzag
+		( std::int64_t const & value
+		)
+	{
+		return (static_cast<std::uint64_t>(value) << 1u)
+			^ static_cast<std::uint64_t>(value >> 63);
+	}
+
+	//! Inverse of zigzag()
+	inline
+	std::int64_t
+	unzigzag
+		( std::uint64_t const & value
+		)
+	{
+		return static_cast<std::int64_t>(value >> 1u)
+			^ (-static_cast<std::int64_t>(value & 1u));
+	}
+
+	//! Append spinor components (exactly, little endian) to bytes
+	inline
+	void
+	putSpinor
+		( std::vector<std::uint8_t> & bytes
+		, Spinor const & spin
+		)
+	{
+		for (std::size_t nn{0u} ; nn < 4u ; ++nn)
+		{
+			std::uint64_t bits;
+			std::memcpy(&bits, &(spin[nn]), sizeof(bits));
+			for (std::size_t kk{0u} ; kk < 8u ; ++kk)
+			{
+				bytes.emplace_back
+					(static_cast<std::uint8_t>((bits >> (8u * kk)) & 0xFFu));
+			}
+		}
+	}
+
+	//! Spinor from putSpinor() bytes (and offset advanced past them)
+	inline
+	Spinor
+	getSpinor
+		( std::vector<std::uint8_t> const & bytes
+		, std::size_t & offset
+		)
+	{
+		std::array<double, 4u> comps{ g3::nan, g3::nan, g3::nan, g3::nan };
+		if ((offset + 32u) <= bytes.size())
+		{
+			for (std::size_t nn{0u} ; nn < 4u ; ++nn)
+			{
+				std::uint64_t bits{ 0u };
+				for (std::size_t kk{0u} ; kk < 8u ; ++kk)
+				{
+					std::uint64_t const byte{ bytes[offset++] };
+					bits |= (byte << (8u * kk));
+				}
+				std::memcpy(&(comps[nn]), &bits, sizeof(bits));
+			}
+		}
+		return Spinor{ comps[0], comps[1], comps[2], comps[3] };
+	}
+
+	/*! \brief Sample reconstructed from previous and quantized delta.
+	 *
+	 * Used identically by encoder and decoder (such that the encoder
+	 * tracks the decoded values exactly).
+	 */
+	inline
+	Spinor
+	appliedDelta
+		( Spinor const & prev
+		, std::array<std::int64_t, 3u> const & qnts
+		, bool const & isFlip
+		, double const & step
+		)
+	{
+		BiVector const logBiv
+			{ step * static_cast<double>(qnts[0])
+			, step * static_cast<double>(qnts[1])
+			, step * static_cast<double>(qnts[2])
+			};
+		Spinor next{ exp(logBiv) * prev };
+		next = (1. / magnitude(next)) * next;
+		if (isFlip)
+		{
+			next = -next;
+		}
+		return next;
+	}
+
+	//! True if spin has a finite, non-zero and invertible magnitude
+	inline
+	bool
+	hasDirection
+		( Spinor const & spin
+		)
+	{
+		double const mag{ magnitude(spin) };
+		return isValid(spin)
+			&& std::isfinite(mag)
+			&& (0. < mag)
+			&& std::isfinite(1. / mag);
+	}
+
+	/*! \brief Decode the record at offset following sample prev.
+	 *
+	 * The offset is advanced past the record.
+	 */
+	inline
+	Spinor
+	decodedRecord
+		( std::vector<std::uint8_t> const & bytes
+		, std::size_t & offset
+		, Spinor const & prev
+		, double const & step
+		)
+	{
+		Spinor next;
+		std::uint64_t const head{ getVarint(bytes, offset) };
+		if (head & 1u) // key record
+		{
+			next = getSpinor(bytes, offset);
+		}
+		else
+		{
+			bool const isFlip{ 0u != (head & 2u) };
+			std::array<std::int64_t, 3u> const qnts
+				{ unzigzag(head >> 2u)
+				, unzigzag(getVarint(bytes, offset))
+				, unzigzag(getVarint(bytes, offset))
+				};
+			next = appliedDelta(prev, qnts, isFlip, step);
+		}
+		return next;
+	}
+
+} // [priv]
+
+	/*! \brief Compressed spinor sequence (ref file overview).
+	 *
+	 * Samples are appended with add() and decoded with operator[]()
+	 * (random access) or decodeAll() (sequential).
+	 */
+	struct SpinTrack
+	{
+		//! Encoding parameters (should not change after first add())
+		TrackParms theParms{};
+
+		//! Encoded records
+		std::vector<std::uint8_t> theBytes{};
+
+		//! Offset into theBytes of each scheduled key record
+		std::vector<std::size_t> theKeyOffsets{};
+
+		//! Number of samples encoded
+		std::size_t theNumSpins{ 0u };
+
+		//! Decoded value of the most recently added sample
+		Spinor theLast{ null<Spinor>() };
+
+		//! Number of encoded samples
+		inline
+		std::size_t
+		size
+			() const
+		{
+			return theNumSpins;
+		}
+
+		//! Append sample to track
+		inline
+		void
+		add
+			( Spinor const & spin
+			)
+		{
+			std::size_t const keyInterval
+				{ std::max(theParms.theKeyInterval, std::size_t{ 1u }) };
+			bool const isScheduled{ 0u == (theNumSpins % keyInterval) };
+			if (isScheduled)
+			{
+				theKeyOffsets.emplace_back(theBytes.size());
+			}
+			if ( isScheduled
+			  || (! priv::hasDirection(theLast))
+			  || (! priv::hasDirection(spin))
+			   )
+			{
+				priv::putVarint(theBytes, 1u);
+				priv::putSpinor(theBytes, spin);
+				theLast = spin;
+			}
+			else
+			{
+				// relative rotation (along shorter arc) from decoded value
+				// (which need not be unitary if from a key record)
+				Spinor const unit{ (1. / magnitude(spin)) * spin };
+				Spinor const lastUnit{ (1. / magnitude(theLast)) * theLast };
+				Spinor rel{ unit * reverse(lastUnit) };
+				bool const isFlip{ rel.theSca.theData[0] < 0. };
+				if (isFlip)
+				{
+					rel = -rel;
+				}
+				BiVector const logBiv{ g3::priv::logBivOfUnit(rel) };
+				double const step{ theParms.quantStep() };
+				std::array<std::int64_t, 3u> const qnts
+					{ std::llround(logBiv.theData[0] / step)
+					, std::llround(logBiv.theData[1] / step)
+					, std::llround(logBiv.theData[2] / step)
+					};
+				std::uint64_t const flip{ isFlip ? 2u : 0u };
+				priv::putVarint(theBytes, (priv::zigzag(qnts[0]) << 2u) | flip);
+				priv::putVarint(theBytes, priv::zigzag(qnts[1]));
+				priv::putVarint(theBytes, priv::zigzag(qnts[2]));
+				theLast = priv::appliedDelta(theLast, qnts, isFlip, step);
+			}
+			++theNumSpins;
+		}
+
+		//! Append all samples in range to track
+		template <typename InIter>
+		inline
+		void
+		add
+			( InIter const & itBeg
+			, InIter const & itEnd
+			)
+		{
+			for (InIter iter{ itBeg } ; itEnd != iter ; ++iter)
+			{
+				add(*iter);
+			}
+		}
+
+		/*! \brief Decode all samples (in order) into itOut.
+		 *
+		 * Returns itOut advanced past last sample.
+		 */
+		template <typename OutIter>
+		inline
+		OutIter
+		decodeAll
+			( OutIter itOut
+			) const
+		{
+			double const step{ theParms.quantStep() };
+			std::size_t offset{ 0u };
+			Spinor prev{ null<Spinor>() };
+			for (std::size_t nn{0u} ; nn < theNumSpins ; ++nn)
+			{
+				prev = priv::decodedRecord(theBytes, offset, prev, step);
+				*itOut++ = prev;
+			}
+			return itOut;
+		}
+
+		/*! \brief Decoded sample ndx (or null if out of range).
+		 *
+		 * Decoding starts from the preceding scheduled key record such
+		 * that at most theKeyInterval records are decoded.
+		 */
+		inline
+		Spinor
+		operator[]
+			( std::size_t const & ndx
+			) const
+		{
+			Spinor spin{ null<Spinor>() };
+			if (ndx < theNumSpins)
+			{
+				std::size_t const keyInterval
+					{ std::max(theParms.theKeyInterval, std::size_t{ 1u }) };
+				std::size_t const ndxKey{ ndx / keyInterval };
+				std::size_t offset{ theKeyOffsets[ndxKey] };
+				double const step{ theParms.quantStep() };
+				for (std::size_t nn{ ndxKey * keyInterval } ; nn <= ndx ; ++nn)
+				{
+					spin = priv::decodedRecord(theBytes, offset, spin, step);
+				}
+			}
+			return spin;
+		}
+	};
+
+} // [codec]
+
+} // [g3]
+
+} // [engabra]
+
+
+#endif // engabra_g3spintrack_INCL_
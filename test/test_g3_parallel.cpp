@@ -0,0 +1,155 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+/*! \file
+\brief Unit tests code for engabra::g3::priv threading helpers
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3_parallel.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+
+	//! Check that chunks cover each index exactly once
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		constexpr std::size_t numItems{ 1003u };
+		for (std::size_t const numChunks : { 0u, 1u, 4u, 7u })
+		{
+			std::vector<int> visits(numItems, 0);
+			g3::priv::forEachChunk
+				( numItems
+				, numChunks
+				, [&visits]
+					( std::size_t const & // chunkNdx
+					, std::size_t const & ndxBeg
+					, std::size_t const & ndxEnd
+					)
+					{
+						for (std::size_t nn{ ndxBeg } ; nn < ndxEnd ; ++nn)
+						{
+							++visits[nn];
+						}
+					}
+				);
+			if (! (std::vector<int>(numItems, 1) == visits))
+			{
+				oss << "Failure of forEachChunk() coverage test\n";
+				oss << "numChunks: " << numChunks << '\n';
+			}
+		}
+
+		return oss.str();
+	}
+
+	//! Check that a throwing chunk function joins started threads
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		constexpr std::size_t numItems{ 1000u };
+		constexpr std::size_t numChunks{ 4u };
+		std::atomic<std::size_t> numDone{ 0u };
+		bool caught{ false };
+		try
+		{
+			g3::priv::forEachChunk
+				( numItems
+				, numChunks
+				, [&numDone]
+					( std::size_t const & chunkNdx
+					, std::size_t const & ndxBeg
+					, std::size_t const & ndxEnd
+					)
+					{
+						if ((numChunks - 1u) == chunkNdx) // calling thread
+						{
+							throw std::runtime_error("test throw");
+						}
+						numDone += (ndxEnd - ndxBeg);
+					}
+				);
+		}
+		catch (std::runtime_error const &)
+		{
+			caught = true;
+		}
+
+		// all other chunks completed (their threads were joined)
+		std::size_t const expDone{ numItems - (numItems / numChunks) };
+		if (! (caught && (expDone == numDone)))
+		{
+			oss << "Failure of forEachChunk() exception test\n";
+			oss << "caught: " << caught << '\n';
+			oss << "expDone: " << expDone << '\n';
+			oss << "gotDone: " << numDone << '\n';
+		}
+
+		return oss.str();
+	}
+
+}
+
+//! Check behavior of threading helpers
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
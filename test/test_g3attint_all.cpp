@@ -0,0 +1,308 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3 attitude integration
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3attint.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 64. * std::numeric_limits<double>::epsilon() };
+
+	//! An angular rate history (linear segments) with varying axis
+	g3::BiVector
+	rateAt
+		( double const & time
+		)
+	{
+		return g3::BiVector
+			{ .7 * std::sin(1.3 * time)
+			, .4 + .5 * std::cos(.9 * time)
+			, 1.1 * std::sin(.5 * time + .2)
+			};
+	}
+
+	/*! \brief Attitude after numSteps over [0, 1] with rates from rateAt()
+	 *
+	 * The rate is sampled at (coarse) step ends and interpolated
+	 * linearly within each step, and each coarse step is (optionally)
+	 * subdivided into numSubs integration steps.
+	 */
+	g3::Spinor
+	integrated
+		( std::size_t const & numSteps
+		, g3::IntegControl const & ctl
+		, std::size_t const & numSubs = 1u
+		)
+	{
+		using namespace engabra::g3;
+		double const dt{ 1. / static_cast<double>(numSteps) };
+		double const dtSub{ dt / static_cast<double>(numSubs) };
+		Spinor spin{ exp(BiVector{ .1, -.2, .3 }) };
+		for (std::size_t nn{0u} ; nn < numSteps ; ++nn)
+		{
+			double const tBeg{ dt * static_cast<double>(nn) };
+			BiVector const rateBeg{ rateAt(tBeg) };
+			BiVector const rateEnd{ rateAt(tBeg + dt) };
+			for (std::size_t kk{0u} ; kk < numSubs ; ++kk)
+			{
+				double const fracBeg
+					{ static_cast<double>(kk) / static_cast<double>(numSubs) };
+				double const fracEnd
+					{ static_cast<double>(kk + 1u)
+					/ static_cast<double>(numSubs)
+					};
+				spin = advanced
+					( spin
+					, (1. - fracBeg) * rateBeg + fracBeg * rateEnd
+					, (1. - fracEnd) * rateBeg + fracEnd * rateEnd
+					, dtSub
+					, ctl
+					);
+			}
+		}
+		return spin;
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// rotate at 2 rad/sec in e12 plane (turning e1 toward e2)
+		BiVector const rate{ 0., 0., 2. };
+		double const dt{ .25 };
+		Spinor spin{ one<Spinor>() };
+		for (std::size_t nn{0u} ; nn < 4u ; ++nn) // 1 sec total
+		{
+			spin = advanced(spin, rate, rate, dt); // constant rate
+		}
+		Vector const gotDir{ (spin * e1 * reverse(spin)).theVec };
+		// gotDir == cos(2.)*e1 + sin(2.)*e2
+		// [DoxyExample01]
+
+		Vector const expDir{ std::cos(2.) * e1 + std::sin(2.) * e2 };
+		if (! nearlyEquals(gotDir, expDir, sTol))
+		{
+			oss << "Failure of constant rate example test\n";
+			oss << "exp: " << expDir << '\n';
+			oss << "got: " << gotDir << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check accuracy and convergence of schemes
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		for (RateFrame const & frame : { RateFrame::World, RateFrame::Body })
+		{
+			auto const errFor
+				{ [&frame]
+					(IntegScheme const & scheme, std::size_t const & numSteps)
+					{
+						// reference with same (linear) rate model
+						IntegControl const ctlRef{ IntegScheme::RK4, frame };
+						Spinor const spinRef
+							{ integrated(numSteps, ctlRef, 256u) };
+						IntegControl const ctl{ scheme, frame };
+						return magnitude(integrated(numSteps, ctl) - spinRef);
+					}
+				};
+			double const errMid{ errFor(IntegScheme::ExpMid, 16u) };
+			double const errMag16{ errFor(IntegScheme::Magnus4, 16u) };
+			double const errMag32{ errFor(IntegScheme::Magnus4, 32u) };
+			double const errRK4{ errFor(IntegScheme::RK4, 32u) };
+
+			// Magnus (with the linear rate model) is fourth order
+			double const ratioMag{ errMag16 / errMag32 };
+			if ( (! (errMag16 < .1 * errMid))
+			  || (! (12. < ratioMag))
+			  || (! (errRK4 < 1.e-7))
+			   )
+			{
+				oss << "Failure of scheme accuracy test\n";
+				oss << "frame: " << static_cast<int>(frame) << '\n';
+				oss << "errMid: " << errMid << '\n';
+				oss << "errMag16: " << errMag16 << '\n';
+				oss << "errMag32: " << errMag32 << '\n';
+				oss << "ratioMag: " << ratioMag << '\n';
+				oss << "errRK4: " << errRK4 << '\n';
+			}
+
+			// exponential schemes stay unitary
+			IntegControl const ctlMag{ IntegScheme::Magnus4, frame };
+			Spinor const spinMag{ integrated(1000u, ctlMag) };
+			if (! (std::abs(magnitude(spinMag) - 1.) < 1.e-12))
+			{
+				oss << "Failure of Magnus4 unitary test\n";
+				oss << "magnitude: " << magnitude(spinMag) << '\n';
+			}
+		}
+
+		return oss.str();;
+	}
+
+	//! Check batch SoA propagation and stepper renormalization
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		constexpr std::size_t numBodies{ 5000u };
+		std::array<std::vector<double>, 4u> spinData;
+		std::array<std::vector<double>, 3u> begData;
+		std::array<std::vector<double>, 3u> endData;
+		std::vector<Spinor> spinExps;
+		std::vector<BiVector> rateBegs;
+		std::vector<BiVector> rateEnds;
+		for (std::size_t nn{0u} ; nn < numBodies ; ++nn)
+		{
+			double const tt{ static_cast<double>(nn) / 101. };
+			Spinor const spin{ exp(BiVector{ .1 * tt, -.3, .02 * tt }) };
+			BiVector const rateBeg{ rateAt(tt) };
+			BiVector const rateEnd{ rateAt(tt + .3) };
+			for (std::size_t kk{0u} ; kk < 4u ; ++kk)
+			{
+				spinData[kk].emplace_back(spin[kk]);
+			}
+			for (std::size_t kk{0u} ; kk < 3u ; ++kk)
+			{
+				begData[kk].emplace_back(rateBeg[kk]);
+				endData[kk].emplace_back(rateEnd[kk]);
+			}
+			spinExps.emplace_back(spin);
+			rateBegs.emplace_back(rateBeg);
+			rateEnds.emplace_back(rateEnd);
+		}
+		std::array<double *, 4u> const spinComps
+			{ spinData[0].data(), spinData[1].data()
+			, spinData[2].data(), spinData[3].data()
+			};
+		std::array<double const *, 3u> const begComps
+			{ begData[0].data(), begData[1].data(), begData[2].data() };
+		std::array<double const *, 3u> const endComps
+			{ endData[0].data(), endData[1].data(), endData[2].data() };
+
+		// RK4 (non-unitary) steps with periodic renormalization
+		constexpr double dt{ .05 };
+		constexpr std::size_t numSteps{ 20u };
+		AttitudeStepper stepper
+			{ IntegControl{ IntegScheme::RK4, RateFrame::World }, 10u };
+		for (std::size_t step{0u} ; step < numSteps ; ++step)
+		{
+			stepper.step(numBodies, spinComps, begComps, endComps, dt, 4u);
+			for (std::size_t nn{0u} ; nn < numBodies ; ++nn)
+			{
+				spinExps[nn] = advanced
+					( spinExps[nn], rateBegs[nn], rateEnds[nn]
+					, dt, stepper.theCtl
+					);
+			}
+		}
+
+		std::size_t errCount{ 0u };
+		for (std::size_t nn{0u} ; nn < numBodies ; ++nn)
+		{
+			Spinor const got
+				{ spinData[0][nn], spinData[1][nn]
+				, spinData[2][nn], spinData[3][nn]
+				};
+			// renormalized just after final step
+			Spinor const exp{ (1. / magnitude(spinExps[nn])) * spinExps[nn] };
+			if ( (! (magnitude(got - exp) < sTol))
+			  || (! (std::abs(magnitude(got) - 1.) < sTol))
+			   )
+			{
+				++errCount;
+			}
+		}
+		if ((0u < errCount) || (! (numSteps == stepper.theNumSteps)))
+		{
+			oss << "Failure of batch/stepper test\n";
+			oss << "errCount: " << errCount << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of attitude integration functions
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,305 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::Camera projection
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3camera.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 64. * std::numeric_limits<double>::epsilon() };
+
+	//! Image coordinates via explicit sandwich product (for comparison)
+	g3::ImgPnt
+	expProject
+		( g3::Camera const & camera
+		, g3::Vector const & pnt
+		)
+	{
+		g3::Spinor const & spin = camera.theAtt;
+		g3::Vector const rel{ pnt - camera.theLoc };
+		g3::Vector const pp{ (spin * rel * g3::reverse(spin)).theVec };
+		double const scl{ -camera.thePD / pp[2] };
+		return g3::ImgPnt{ scl * pp[0], scl * pp[1] };
+	}
+
+	//! A camera looking (roughly) toward the origin from above
+	g3::Camera
+	someCamera
+		()
+	{
+		return g3::Camera
+			{ g3::exp(g3::BiVector{ .05, -.03, .4 })
+			, g3::Vector{ 1.5, -2., 100. }
+			, .150
+			};
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// vertical camera 100 units above origin (looking down -e3)
+		Camera const camera{ one<Spinor>(), Vector{ 0., 0., 100. }, .150 };
+		Vector const pnt{ 10., 20., 0. };
+		ImgPnt const img{ project(camera, pnt) }; // == { .015, .030 }
+		// [DoxyExample01]
+
+		ImgPnt const expImg{ .015, .030 };
+		if (! nearlyEquals(img, expImg, sTol))
+		{
+			oss << "Failure of project() example test\n";
+			oss << "expImg: " << expImg[0] << ' ' << expImg[1] << '\n';
+			oss << "gotImg: " << img[0] << ' ' << img[1] << '\n';
+		}
+
+		// point behind camera
+		if (isValid(project(camera, Vector{ 0., 0., 200. })))
+		{
+			oss << "Failure of behind camera null test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check projection and Jacobians against finite differences
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		Camera const camera{ someCamera() };
+		Vector const pnt{ 7., -11., 3. };
+
+		ImgPnt const expImg{ expProject(camera, pnt) };
+		ImgJac const gotJac{ projectJac(camera, pnt) };
+		if ( (! nearlyEquals(project(camera, pnt), expImg, sTol))
+		  || (! nearlyEquals(gotJac.theImg, expImg, sTol))
+		   )
+		{
+			oss << "Failure of projection test\n";
+		}
+
+		// central differences
+		constexpr double del{ 1.e-6 };
+		std::array<BiVector, 3u> const bivs{ e23, e31, e12 };
+		std::array<Vector, 3u> const vecs{ e1, e2, e3 };
+		std::array<double, 6u> difAtt;
+		std::array<double, 6u> difLoc;
+		for (std::size_t col{0u} ; col < 3u ; ++col)
+		{
+			Camera camPosA{ camera };
+			Camera camNegA{ camera };
+			camPosA.theAtt = exp( del * bivs[col]) * camera.theAtt;
+			camNegA.theAtt = exp(-del * bivs[col]) * camera.theAtt;
+			ImgPnt const imgPosA{ project(camPosA, pnt) };
+			ImgPnt const imgNegA{ project(camNegA, pnt) };
+
+			Camera camPosL{ camera };
+			Camera camNegL{ camera };
+			camPosL.theLoc = camera.theLoc + del * vecs[col];
+			camNegL.theLoc = camera.theLoc - del * vecs[col];
+			ImgPnt const imgPosL{ project(camPosL, pnt) };
+			ImgPnt const imgNegL{ project(camNegL, pnt) };
+
+			for (std::size_t row{0u} ; row < 2u ; ++row)
+			{
+				difAtt[3u*row + col] = (imgPosA[row] - imgNegA[row]) / (2.*del);
+				difLoc[3u*row + col] = (imgPosL[row] - imgNegL[row]) / (2.*del);
+			}
+		}
+
+		constexpr double tolDif{ 1.e-7 };
+		if (! nearlyEquals(gotJac.theJacAtt, difAtt, tolDif))
+		{
+			oss << "Failure of attitude Jacobian test\n";
+			for (std::size_t nn{0u} ; nn < 6u ; ++nn)
+			{
+				oss << "exp,got: " << difAtt[nn]
+					<< ' ' << gotJac.theJacAtt[nn] << '\n';
+			}
+		}
+		if (! nearlyEquals(gotJac.theJacLoc, difLoc, tolDif))
+		{
+			oss << "Failure of location Jacobian test\n";
+			for (std::size_t nn{0u} ; nn < 6u ; ++nn)
+			{
+				oss << "exp,got: " << difLoc[nn]
+					<< ' ' << gotJac.theJacLoc[nn] << '\n';
+			}
+		}
+
+		return oss.str();;
+	}
+
+	//! Check batch projections
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		std::size_t const numPnts{ 3u * priv::sMinItemsPerThread + 11u };
+		std::vector<double> xs(numPnts);
+		std::vector<double> ys(numPnts);
+		std::vector<double> zs(numPnts);
+		for (std::size_t nn{0u} ; nn < numPnts ; ++nn)
+		{
+			double const dd{ static_cast<double>(nn) };
+			xs[nn] = 20. * std::sin(.1 * dd);
+			ys[nn] = 20. * std::cos(.3 * dd);
+			zs[nn] = std::sin(.7 * dd);
+		}
+		Camera const camera{ someCamera() };
+
+		// [DoxyExampleBatch]
+		std::vector<double> imgXs(numPnts);
+		std::vector<double> imgYs(numPnts);
+		batch::project
+			( camera
+			, numPnts
+			, { xs.data(), ys.data(), zs.data() }
+			, { imgXs.data(), imgYs.data() }
+			, 3u // numThreads
+			);
+		// [DoxyExampleBatch]
+
+		// observations: alternate between two cameras
+		Camera camB{ camera };
+		camB.theLoc = Vector{ -5., 3., 80. };
+		std::vector<Camera> const cameras{ camera, camB };
+		std::size_t const numObs{ numPnts };
+		std::vector<std::size_t> ndxCams(numObs);
+		std::vector<std::size_t> ndxPnts(numObs);
+		for (std::size_t nn{0u} ; nn < numObs ; ++nn)
+		{
+			ndxCams[nn] = nn % 2u;
+			ndxPnts[nn] = numPnts - 1u - nn;
+		}
+		std::vector<double> obsXs(numObs);
+		std::vector<double> obsYs(numObs);
+		std::vector<double> obsJacs(12u * numObs);
+		batch::project
+			( cameras
+			, { xs.data(), ys.data(), zs.data() }
+			, numObs
+			, ndxCams.data()
+			, ndxPnts.data()
+			, { obsXs.data(), obsYs.data() }
+			, obsJacs.data()
+			, 4u
+			);
+
+		std::size_t errCount{ 0u };
+		for (std::size_t nn{0u} ; nn < numPnts ; ++nn)
+		{
+			Vector const pnt{ xs[nn], ys[nn], zs[nn] };
+			ImgPnt const expImg{ project(camera, pnt) };
+			ImgPnt const gotImg{ imgXs[nn], imgYs[nn] };
+			if (! nearlyEquals(gotImg, expImg))
+			{
+				++errCount;
+			}
+
+			std::size_t const & np = ndxPnts[nn];
+			Vector const obsPnt{ xs[np], ys[np], zs[np] };
+			ImgJac const expJac{ projectJac(cameras[ndxCams[nn]], obsPnt) };
+			ImgPnt const gotObs{ obsXs[nn], obsYs[nn] };
+			std::array<double, 6u> gotAtt;
+			std::copy_n(obsJacs.cbegin() + 12u*nn, 6u, gotAtt.begin());
+			if ( (! nearlyEquals(gotObs, expJac.theImg))
+			  || (! nearlyEquals(gotAtt, expJac.theJacAtt))
+			  || (! (obsJacs[12u*nn + 11u] == expJac.theJacLoc[5]))
+			   )
+			{
+				++errCount;
+			}
+		}
+		if (0u < errCount)
+		{
+			oss << "Failure of batch::project() test\n";
+			oss << "errCount: " << errCount << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of camera projection functions
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
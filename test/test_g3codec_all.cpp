@@ -0,0 +1,376 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::codec functions
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3codec.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	//! Rotation angle between attitudes (independent of spinor signs)
+	double
+	angleBetween
+		( g3::Spinor const & spinA
+		, g3::Spinor const & spinB
+		)
+	{
+		g3::Spinor const rel{ spinB * g3::reverse(spinA) };
+		double const sca{ std::abs(rel.theSca[0]) };
+		double const biv{ g3::magnitude(rel.theBiv) };
+		return 2. * std::atan2(biv, sca);
+	}
+
+	//! Collection of (pseudo)random unitary spinors
+	std::vector<g3::Spinor>
+	someSpins
+		( std::size_t const & numSpins
+		)
+	{
+		std::mt19937_64 gen(47u);
+		std::normal_distribution<double> distro(0., 1.);
+		std::vector<g3::Spinor> spins;
+		spins.reserve(numSpins);
+		for (std::size_t nn{0u} ; nn < numSpins ; ++nn)
+		{
+			g3::Spinor const spin
+				{ distro(gen), distro(gen), distro(gen), distro(gen) };
+			spins.emplace_back((1. / g3::magnitude(spin)) * spin);
+		}
+		return spins;
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		Spinor const spin{ exp(BiVector{ .3, -.2, .7 }) };
+
+		// 48-bit (6 byte) code and decoded attitude
+		codec::Code const code{ codec::encodedSpin<48u>(spin) };
+		Spinor const got{ codec::decodedSpin<48u>(code) };
+		// rotation angle error of got is less than:
+		constexpr double maxErr{ codec::maxSpinAngleError<48u>() };
+		// [DoxyExample01]
+
+		double const gotErr{ angleBetween(got, spin) };
+		if (! (gotErr < maxErr))
+		{
+			oss << "Failure of 48-bit example test\n";
+			oss << "gotErr: " << gotErr << '\n';
+			oss << "maxErr: " << maxErr << '\n';
+		}
+
+		// null handling
+		if ( (codec::nullCode<48u>() != codec::encodedSpin<48u>(Spinor{}))
+		  || (codec::nullCode<64u>() != codec::encodedSpin<64u>(zero<Spinor>()))
+		  || isValid(codec::decodedSpin<48u>(codec::nullCode<48u>()))
+		  || isValid(codec::decodedSpin<64u>(codec::nullCode<64u>()))
+		   )
+		{
+			oss << "Failure of null code test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check error bounds for many random attitudes
+	template <std::size_t NumBits>
+	std::string
+	testBound
+		( std::vector<g3::Spinor> const & spins
+		)
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		double maxGot{ 0. };
+		bool allInBits{ true };
+		for (Spinor const & spin : spins)
+		{
+			codec::Code const code{ codec::encodedSpin<NumBits>(spin) };
+			allInBits &= (code < codec::nullCode<NumBits>());
+			// encoding is independent of sign and scale
+			allInBits &= (code == codec::encodedSpin<NumBits>(-2.5 * spin));
+			Spinor const got{ codec::decodedSpin<NumBits>(code) };
+			maxGot = std::max(maxGot, angleBetween(got, spin));
+		}
+		constexpr double maxErr{ codec::maxSpinAngleError<NumBits>() };
+		// bound should be respected and not be grossly pessimistic
+		if ( (! allInBits)
+		  || (! (maxGot < maxErr))
+		  || (! (.1 * maxErr < maxGot))
+		   )
+		{
+			oss << "Failure of error bound test\n";
+			oss << "NumBits: " << NumBits << '\n';
+			oss << "allInBits: " << allInBits << '\n';
+			oss << "maxGot: " << maxGot << '\n';
+			oss << "maxErr: " << maxErr << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check batch and io functions
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		std::vector<Spinor> spins{ someSpins(5000u) };
+		spins[17] = null<Spinor>();
+
+		std::vector<codec::Code> codes(spins.size());
+		codec::batch::encodeSpins<48u>
+			(spins.cbegin(), spins.cend(), codes.begin());
+		std::vector<codec::Code> codesMT(spins.size());
+		codec::batch::encodeSpins<48u>
+			(spins.cbegin(), spins.cend(), codesMT.begin(), 4u);
+		std::vector<Spinor> gots(spins.size());
+		codec::batch::decodeSpins<48u>
+			(codesMT.cbegin(), codesMT.cend(), gots.begin(), 4u);
+
+		// binary round trip
+		std::stringstream bstrm;
+		bool const okPut
+			{ io::putCodes<48u>(bstrm, codes.cbegin(), codes.cend()) };
+		std::string const bytes{ bstrm.str() };
+		std::vector<codec::Code> codesGet(codes.size() + 1u);
+		std::size_t const numGet
+			{ io::getCodes<48u>(bstrm, codesGet.size(), codesGet.begin()) };
+		codesGet.resize(numGet);
+
+		std::size_t errCount{ 0u };
+		for (std::size_t nn{0u} ; nn < spins.size() ; ++nn)
+		{
+			Spinor const expSpin{ codec::decodedSpin<48u>(codes[nn]) };
+			bool const sameNull{ isValid(expSpin) == isValid(spins[nn]) };
+			if ( (! sameNull)
+			  || (! (codes[nn] == codesMT[nn]))
+			  || (isValid(expSpin) && (! nearlyEquals(gots[nn], expSpin)))
+			   )
+			{
+				++errCount;
+			}
+		}
+		if ( (0u < errCount)
+		  || (! okPut)
+		  || (! ((6u * codes.size()) == bytes.size()))
+		  || (! (codesGet == codes))
+		   )
+		{
+			oss << "Failure of batch/binary io test\n";
+			oss << "errCount: " << errCount << '\n';
+			oss << "bytes.size: " << bytes.size() << '\n';
+			oss << "numGet: " << numGet << '\n';
+		}
+
+		// text round trip
+		codec::Code const code{ codes[3] };
+		std::string const text{ io::hexFrom<48u>(code) };
+		if ( (! (12u == text.size()))
+		  || (! (code == io::codeFromHex<48u>(text)))
+		  || (! (codec::nullCode<48u>() == io::codeFromHex<48u>("12x4")))
+		   )
+		{
+			oss << "Failure of hex text test\n";
+			oss << "text: " << text << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Examples for documentation and checks of direction codes
+	std::string
+	test3
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample02]
+		using namespace engabra::g3;
+
+		Vector const dir{ direction(Vector{ 3., -4., 12. }) };
+
+		// 32-bit code and decoded unit vector
+		codec::Code const code{ codec::encodedDir<32u>(dir) };
+		Vector const got{ codec::decodedDir<32u, Vector>(code) };
+		// angle between got and dir is less than:
+		constexpr double maxErr{ codec::maxDirAngleError<32u>() };
+		// [DoxyExample02]
+
+		double const gotErr{ std::acos(std::min(1., (got * dir).theSca[0])) };
+		if (! (gotErr < maxErr))
+		{
+			oss << "Failure of 32-bit direction example test\n";
+			oss << "gotErr: " << gotErr << '\n';
+			oss << "maxErr: " << maxErr << '\n';
+		}
+
+		// special directions (-e3 is at the reserved corner)
+		std::vector<Vector> const specials
+			{ e1, -e1, e2, -e2, e3, -e3, direction(Vector{ 1., 1., -1.e-20 }) };
+		for (Vector const & special : specials)
+		{
+			codec::Code const spCode{ codec::encodedDir<32u>(special) };
+			Vector const spGot{ codec::decodedDir<32u, Vector>(spCode) };
+			if ( (codec::nullCode<32u>() == spCode)
+			  || (! (magnitude(spGot - special) < maxErr))
+			   )
+			{
+				oss << "Failure of special direction test\n";
+				oss << "special: " << special << '\n';
+				oss << "spGot: " << spGot << '\n';
+			}
+		}
+
+		// BiVector directions and null values
+		BiVector const biv{ .2, .3, -.9 };
+		BiVector const gotBiv
+			{ codec::decodedDir<48u, BiVector>(codec::encodedDir<48u>(biv)) };
+		if ( (! (magnitude(gotBiv - direction(biv))
+				< codec::maxDirAngleError<48u>()))
+		  || (codec::nullCode<48u>() != codec::encodedDir<48u>(null<Vector>()))
+		  || isValid(codec::decodedDir<48u, Vector>(codec::nullCode<48u>()))
+		   )
+		{
+			oss << "Failure of BiVector/null direction test\n";
+			oss << "gotBiv: " << gotBiv << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check direction error bounds for many random directions
+	template <std::size_t NumBits>
+	std::string
+	testDirBound
+		( std::vector<g3::Spinor> const & spins
+		)
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		std::vector<Vector> dirs;
+		dirs.reserve(spins.size());
+		for (Spinor const & spin : spins)
+		{
+			dirs.emplace_back
+				(direction(Vector{ spin[0], spin[1], spin[2] - .5*spin[3] }));
+		}
+		std::vector<codec::Code> codes(dirs.size());
+		codec::batch::encodeDirs<NumBits>
+			(dirs.cbegin(), dirs.cend(), codes.begin(), 4u);
+		std::vector<Vector> gots(dirs.size());
+		codec::batch::decodeDirs<NumBits, Vector>
+			(codes.cbegin(), codes.cend(), gots.begin());
+
+		double maxGot{ 0. };
+		bool allInBits{ true };
+		for (std::size_t nn{0u} ; nn < dirs.size() ; ++nn)
+		{
+			allInBits &= (codes[nn] < codec::nullCode<NumBits>());
+			allInBits &= (codes[nn] == codec::encodedDir<NumBits>(dirs[nn]));
+			// angle from chord length
+			double const chord{ magnitude(gots[nn] - dirs[nn]) };
+			maxGot = std::max(maxGot, 2. * std::asin(.5 * chord));
+		}
+		constexpr double maxErr{ codec::maxDirAngleError<NumBits>() };
+		if ( (! allInBits)
+		  || (! (maxGot < maxErr))
+		  || (! (.1 * maxErr < maxGot))
+		   )
+		{
+			oss << "Failure of direction error bound test\n";
+			oss << "NumBits: " << NumBits << '\n';
+			oss << "allInBits: " << allInBits << '\n';
+			oss << "maxGot: " << maxGot << '\n';
+			oss << "maxErr: " << maxErr << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of codec functions
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	std::vector<g3::Spinor> const spins{ someSpins(100000u) };
+	oss << testBound<48u>(spins);
+	oss << testBound<64u>(spins);
+	oss << test2();
+	oss << test3();
+	oss << testDirBound<32u>(spins);
+	oss << testDirBound<48u>(spins);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,526 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::ad forward mode AD
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3dual.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 64. * std::numeric_limits<double>::epsilon() };
+
+	//! Max absolute difference between two same size arrays
+	template <std::size_t Size>
+	double
+	maxDiff
+		( std::array<double, Size> const & arrA
+		, std::array<double, Size> const & arrB
+		)
+	{
+		double max{ 0. };
+		for (std::size_t nn{0u} ; nn < Size ; ++nn)
+		{
+			double const dif{ std::abs(arrA[nn] - arrB[nn]) };
+			if (! (dif <= max)) // propagate NaN
+			{
+				max = dif;
+			}
+		}
+		return max;
+	}
+
+	//! Spinor part of MultiVector
+	g3::Spinor
+	spinOf
+		( g3::MultiVector const & mv
+		)
+	{
+		return g3::Spinor{ mv.theSca.theData[0], mv.theBiv };
+	}
+
+	//! Spinor part of MultiVector jet
+	template <std::size_t N>
+	g3::ad::Jet<g3::Spinor, N>
+	spinOf
+		( g3::ad::Jet<g3::MultiVector, N> const & jet
+		)
+	{
+		return g3::ad::linearOf
+			(jet, [] (g3::MultiVector const & mv) { return spinOf(mv); });
+	}
+
+	//! ComPlex part of MultiVector
+	g3::ComPlex
+	cplxOf
+		( g3::MultiVector const & mv
+		)
+	{
+		return g3::ComPlex{ mv.theSca, mv.theTri };
+	}
+
+	//! ComPlex part of MultiVector jet
+	template <std::size_t N>
+	g3::ad::Jet<g3::ComPlex, N>
+	cplxOf
+		( g3::ad::Jet<g3::MultiVector, N> const & jet
+		)
+	{
+		return g3::ad::linearOf
+			(jet, [] (g3::MultiVector const & mv) { return cplxOf(mv); });
+	}
+
+	//! DirPlex part of MultiVector
+	g3::DirPlex
+	dplxOf
+		( g3::MultiVector const & mv
+		)
+	{
+		return g3::DirPlex{ mv.theVec, mv.theBiv };
+	}
+
+	//! DirPlex part of MultiVector jet
+	template <std::size_t N>
+	g3::ad::Jet<g3::DirPlex, N>
+	dplxOf
+		( g3::ad::Jet<g3::MultiVector, N> const & jet
+		)
+	{
+		return g3::ad::linearOf
+			(jet, [] (g3::MultiVector const & mv) { return dplxOf(mv); });
+	}
+
+	//! BiVector part of MultiVector
+	g3::BiVector
+	bivOf
+		( g3::MultiVector const & mv
+		)
+	{
+		return mv.theBiv;
+	}
+
+	//! BiVector part of MultiVector jet
+	template <std::size_t N>
+	g3::ad::Jet<g3::BiVector, N>
+	bivOf
+		( g3::ad::Jet<g3::MultiVector, N> const & jet
+		)
+	{
+		return g3::ad::linearOf
+			(jet, [] (g3::MultiVector const & mv) { return bivOf(mv); });
+	}
+
+	//! Inverse of g3 type (with explicit type as needed by g3::inverse())
+	template <typename Type>
+	Type
+	invOf
+		( Type const & item
+		)
+	{
+		return g3::inverse<Type>(item);
+	}
+
+	//! Inverse of jet
+	template <typename Type, std::size_t N>
+	g3::ad::Jet<Type, N>
+	invOf
+		( g3::ad::Jet<Type, N> const & jet
+		)
+	{
+		return g3::ad::inverse(jet);
+	}
+
+	/*! \brief Max error of jet Jacobian of func() at mv (or NaN).
+	 *
+	 * The func() is evaluated for MultiVector and for MultiVector jet
+	 * arguments. Errors are relative to central finite differences (for
+	 * magnitudes above one) and include the difference in values.
+	 */
+	template <typename Func>
+	double
+	jetError
+		( Func const & func
+		, g3::MultiVector const & mv
+		)
+	{
+		auto const jet{ func(g3::ad::variable<8u>(mv)) };
+		auto const expVal{ func(mv) };
+		using OutType = std::decay_t<decltype(expVal)>;
+		constexpr std::size_t numOut{ sizeof(OutType) / sizeof(double) };
+		std::array<double, numOut * 8u> const gotJac
+			{ g3::ad::jacobianOf(jet) };
+
+		double maxErr{ 0. };
+		for (std::size_t row{0u} ; row < numOut ; ++row)
+		{
+			double const err{ std::abs(jet.theVal[row] - expVal[row]) };
+			if (! (err <= maxErr)) // propagate NaN
+			{
+				maxErr = err;
+			}
+		}
+		constexpr double delta{ 1.e-6 };
+		for (std::size_t col{0u} ; col < 8u ; ++col)
+		{
+			g3::MultiVector argPos{ mv };
+			g3::MultiVector argNeg{ mv };
+			argPos[col] += delta;
+			argNeg[col] -= delta;
+			OutType const valPos{ func(argPos) };
+			OutType const valNeg{ func(argNeg) };
+			for (std::size_t row{0u} ; row < numOut ; ++row)
+			{
+				double const expDer
+					{ (valPos[row] - valNeg[row]) / (2. * delta) };
+				double const gotDer{ gotJac[8u*row + col] };
+				double const err
+					{ std::abs(gotDer - expDer)
+					/ std::max(1., std::abs(expDer))
+					};
+				if (! (err <= maxErr)) // propagate NaN
+				{
+					maxErr = err;
+				}
+			}
+		}
+		return maxErr;
+	}
+
+	//! A nonlinear spinor expression of a vector and a bivector
+	template <typename VecType, typename BivType>
+	auto
+	someFunc
+		( VecType const & vec
+		, BivType const & biv
+		)
+	{
+		using namespace engabra::g3;
+		auto const spin{ exp(biv) };
+		auto const rot{ spin * vec * reverse(spin) };
+		auto const prod{ vec * rot + Scalar{ 2.5 } };
+		auto const den{ prod + .5 * e12 };
+		auto const invDen{ reverse(den) * (1. / magSq(den)) };
+		return logG2(inverse(vec) * direction(prod) * invDen * vec);
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// parameters: bivector rotation angles (3 of them)
+		BiVector const biv{ .2, -.3, .5 };
+		Vector const vec{ 1., 2., 3. };
+		ad::Jet<BiVector, 3u> const bivJet{ ad::variable<3u>(biv) };
+
+		// evaluate expression once with exact derivatives
+		ad::Jet<Spinor, 3u> const spinJet{ exp(bivJet) };
+		ad::Jet<ImSpin, 3u> const rotJet{ spinJet * vec * reverse(spinJet) };
+
+		// value and Jacobian (with respect to biv)
+		Spinor const & spin = spinJet.theVal; // == exp(biv)
+		std::array<double, 4u*3u> const jac{ ad::jacobianOf(rotJet) };
+		// [DoxyExample01]
+
+		if (! nearlyEquals(spin, exp(biv), sTol))
+		{
+			oss << "Failure of Jet exp() value test\n";
+		}
+		// vector rows of the (ImSpin) jacobian should match rotateJac()
+		Jac3x3 const expJac{ rotateJac(biv, vec).second };
+		Jac3x3 gotJac;
+		std::copy(jac.cbegin(), jac.cbegin() + 9u, gotJac.begin());
+		if (! (maxDiff(gotJac, expJac) < sTol))
+		{
+			oss << "Failure of Jet rotation Jacobian test\n";
+			oss << "maxDiff: " << maxDiff(gotJac, expJac) << '\n';
+		}
+		std::array<double, 3u> const zeros{ 0., 0., 0. };
+		std::array<double, 3u> const triRow{ jac[9u], jac[10u], jac[11u] };
+		if (! (maxDiff(triRow, zeros) < sTol)) // trivector part is zero
+		{
+			oss << "Failure of Jet rotation trivector test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check Dual scalar functions against analytic derivatives
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		ad::Dual<2u> const xx{ ad::variable<2u>(.7, 0u) };
+		ad::Dual<2u> const yy{ ad::variable<2u>(-1.3, 1u) };
+		static_assert
+			( std::is_same<decltype(ad::constant<2u>(2.)), ad::Dual<2u> >
+				::value
+			, "constant<N>(double) should be a Dual"
+			);
+
+		// f = sin(x)*exp(y) + sqrt(x)/y - log(x) + atan2(y, x)
+		ad::Dual<2u> const ff
+			{ sin(xx) * exp(yy) + sqrt(xx) / yy - log(xx) + atan2(yy, xx)
+			+ 3. * cos(xx * yy) - 1.
+			};
+		double const xv{ xx.theVal };
+		double const yv{ yy.theVal };
+		double const rSq{ xv*xv + yv*yv };
+		double const expVal
+			{ std::sin(xv) * std::exp(yv) + std::sqrt(xv) / yv
+			- std::log(xv) + std::atan2(yv, xv)
+			+ 3. * std::cos(xv * yv) - 1.
+			};
+		std::array<double, 2u> const expDer
+			{ std::cos(xv) * std::exp(yv) + .5 / (std::sqrt(xv) * yv)
+			- 1. / xv - yv / rSq - 3. * std::sin(xv * yv) * yv
+			, std::sin(xv) * std::exp(yv) - std::sqrt(xv) / (yv * yv)
+			+ xv / rSq - 3. * std::sin(xv * yv) * xv
+			};
+		if ( (! nearlyEquals(ff.theVal, expVal, sTol))
+		  || (! (maxDiff(ad::jacobianOf(ff), expDer) < sTol))
+		   )
+		{
+			oss << "Failure of Dual function test\n";
+			oss << "expVal: " << expVal << '\n';
+			oss << "gotVal: " << ff.theVal << '\n';
+			oss << "expDer: " << expDer[0] << ' ' << expDer[1] << '\n';
+			oss << "gotDer: " << ff.theDer[0] << ' ' << ff.theDer[1] << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check Jet expression Jacobian against finite differences
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		Vector const vec{ .3, -1.1, .8 };
+		BiVector const biv{ .4, .1, -.6 };
+
+		// exact jacobian w.r.t. all six parameters (vec, then biv)
+		ad::Jet<Vector, 6u> const vecJet{ ad::variable<6u>(vec, 0u) };
+		ad::Jet<BiVector, 6u> const bivJet{ ad::variable<6u>(biv, 3u) };
+		ad::Jet<Spinor, 6u> const gotJet{ someFunc(vecJet, bivJet) };
+		std::array<double, 4u*6u> const gotJac{ ad::jacobianOf(gotJet) };
+
+		Spinor const expVal{ someFunc(vec, biv) };
+		if (! nearlyEquals(gotJet.theVal, expVal, sTol))
+		{
+			oss << "Failure of Jet expression value test\n";
+			oss << "exp: " << expVal << '\n';
+			oss << "got: " << gotJet.theVal << '\n';
+		}
+
+		// central differences
+		constexpr double delta{ 1.e-6 };
+		std::array<double, 4u*6u> expJac;
+		for (std::size_t col{0u} ; col < 6u ; ++col)
+		{
+			std::array<double, 6u> parPos{ vec[0], vec[1], vec[2] };
+			parPos[3] = biv[0];
+			parPos[4] = biv[1];
+			parPos[5] = biv[2];
+			std::array<double, 6u> parNeg{ parPos };
+			parPos[col] += delta;
+			parNeg[col] -= delta;
+			Spinor const valPos
+				{ someFunc
+					( Vector{ parPos[0], parPos[1], parPos[2] }
+					, BiVector{ parPos[3], parPos[4], parPos[5] }
+					)
+				};
+			Spinor const valNeg
+				{ someFunc
+					( Vector{ parNeg[0], parNeg[1], parNeg[2] }
+					, BiVector{ parNeg[3], parNeg[4], parNeg[5] }
+					)
+				};
+			for (std::size_t row{0u} ; row < 4u ; ++row)
+			{
+				expJac[6u*row + col]
+					= (valPos[row] - valNeg[row]) / (2. * delta);
+			}
+		}
+		if (! (maxDiff(gotJac, expJac) < 1.e-8))
+		{
+			oss << "Failure of Jet expression Jacobian test\n";
+			oss << "maxDiff: " << maxDiff(gotJac, expJac) << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check MultiVector function chain rules against finite differences
+	std::string
+	test3
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		// general argument and one with small DirPlex part (series)
+		std::array<MultiVector, 2u> const mvs
+			{ MultiVector{ .3, .1, -.2, .4, .5, -.1, .2, .7 }
+			, MultiVector{ .3, 1.e-5, 2.e-5, -1.e-5, 3.e-6, -2.e-6, 1.e-6, .2 }
+			};
+		constexpr double tol{ 1.e-7 };
+		for (MultiVector const & mv : mvs)
+		{
+			std::array<double, 11u> const errs
+				{ jetError([] (auto const & xx) { return exp(xx); }, mv)
+				, jetError([] (auto const & xx) { return log(xx); }, mv)
+				, jetError([] (auto const & xx) { return sqrt(xx); }, mv)
+				, jetError([] (auto const & xx) { return sin(xx); }, mv)
+				, jetError([] (auto const & xx) { return cos(xx); }, mv)
+				, jetError([] (auto const & xx) { return sinh(xx); }, mv)
+				, jetError([] (auto const & xx) { return cosh(xx); }, mv)
+				, jetError([] (auto const & xx) { return invOf(xx); }, mv)
+				, jetError([] (auto const & xx) { return pow(xx, 5); }, mv)
+				, jetError([] (auto const & xx) { return pow(xx, -3); }, mv)
+				, jetError
+					([] (auto const & xx) { return sincos(xx).second; }, mv)
+				};
+			for (std::size_t nn{0u} ; nn < errs.size() ; ++nn)
+			{
+				if (! (errs[nn] < tol))
+				{
+					oss << "Failure of MultiVector Jet chain rule test\n";
+					oss << "   mv: " << mv << '\n';
+					oss << " func: " << nn << '\n';
+					oss << "  err: " << errs[nn] << '\n';
+				}
+			}
+		}
+
+		return oss.str();;
+	}
+
+	//! Check other g3 type chain rules against finite differences
+	std::string
+	test4
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		MultiVector const mv{ .8, .4, -.3, .2, .1, .2, -.3, .6 };
+		constexpr double tol{ 1.e-7 };
+		std::array<double, 11u> const errs
+			{ jetError([] (auto const & xx) { return exp(spinOf(xx)); }, mv)
+			, jetError
+				([] (auto const & xx) { return sqrtG2(spinOf(xx)); }, mv)
+			, jetError
+				([] (auto const & xx) { return pow(spinOf(xx), .3); }, mv)
+			, jetError([] (auto const & xx) { return sin(spinOf(xx)); }, mv)
+			, jetError
+				([] (auto const & xx) { return cosh(spinOf(xx)); }, mv)
+			, jetError([] (auto const & xx) { return cos(bivOf(xx)); }, mv)
+			, jetError
+				([] (auto const & xx) { return sinh(bivOf(xx)); }, mv)
+			, jetError
+				([] (auto const & xx) { return sinh(cplxOf(xx)); }, mv)
+			, jetError([] (auto const & xx) { return sin(cplxOf(xx)); }, mv)
+			, jetError
+				([] (auto const & xx) { return invOf(cplxOf(xx)); }, mv)
+			, jetError
+				([] (auto const & xx) { return invOf(dplxOf(xx)); }, mv)
+			};
+		for (std::size_t nn{0u} ; nn < errs.size() ; ++nn)
+		{
+			if (! (errs[nn] < tol))
+			{
+				oss << "Failure of g3 type Jet chain rule test\n";
+				oss << " func: " << nn << '\n';
+				oss << "  err: " << errs[nn] << '\n';
+			}
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of forward mode automatic differentiation
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+	oss << test3();
+	oss << test4();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -34,7 +34,6 @@ brute-force series expansion evaluation.
 
 #include "checks.hpp" // testing environment common utilities
 
-#include <iostream> // TODO - remove
 #include "g3func.hpp"
 
 #include "g3compare.hpp"
@@ -224,7 +223,7 @@ namespace
 		return okay;
 	}
 
-	//! Check ### TODO
+	//! Check exponentiation of special and general values
 	std::string
 	test1
 		()
@@ -243,6 +242,18 @@ namespace
 			, std::make_pair(MultiVector(e31), "bivector(e31)")
 			, std::make_pair(MultiVector(e12), "bivector(e12)")
 			, std::make_pair(MultiVector(e123), "trivector(e123)")
+			, std::make_pair
+				( MultiVector{ .1, -.2, .3, .1,  .2, -.1, .3, .2 }
+				, "general(small)"
+				)
+			, std::make_pair
+				( MultiVector{ .7, 1.1, -.4, .3,  -.6, .9, .2, -1.3 }
+				, "general(large)"
+				)
+			, std::make_pair
+				( MultiVector{ 0., 1., 0., 0.,  0., 1., 0., 0. }
+				, "nilpotent(e1+e31)"
+				)
 			};
 
 		for (std::pair<MultiVector, std::string> const & mv : mvs)
@@ -302,8 +313,8 @@ main
 	int status{ tst::CTest::fail };
 	std::stringstream oss;
 
-//	oss << test0();
-//	oss << test1();
+	oss << test0();
+	oss << test1();
 	oss << test2();
 
 	if (oss.str().empty()) // Only pass if no errors were encountered
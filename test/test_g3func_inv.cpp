@@ -30,6 +30,7 @@
 
 #include "checks.hpp" // testing environment common utilities
 
+#include "g3batch.hpp"
 #include "g3func.hpp"
 
 #include "g3compare.hpp"
@@ -37,6 +38,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 
 namespace
@@ -140,29 +142,119 @@ namespace
 		return oss.str();;
 	}
 
-/*
-	//! Check ### TODO
+	//! Check inverse of composite types
 	std::string
 	test1
 		()
 	{
 		std::ostringstream oss;
 
-			oss << "Failure of ### test\n";
+		using namespace g3;
+
+		double const tol{ 8. * std::numeric_limits<double>::epsilon() };
+
+		ComPlex const cplx{ Scalar{ -.7 }, TriVector{ 1.3 } };
+		checkInverse(oss, cplx, "inv(cplx)", tol);
+
+		ImSpin const imsp{ Vector{ .3, -.8, .2 }, TriVector{ -.6 } };
+		checkInverse(oss, imsp, "inv(imsp)", tol);
+
+		DirPlex const dplx{ Vector{ .3, -.8, .2 }, BiVector{ -.6, .4, .9 } };
+		checkInverse(oss, dplx, "inv(dplx)", tol);
+
+		// MultiVector agrees with (dirverse * inverse amplitude) expression
+		MultiVector const mv{ -.7, .5, -.3, .2,  -.4, .6, .1, -.9 };
+		ComPlex const invAmp{ inverse<ComPlex>(ampSq(mv)) };
+		MultiVector const mvDv{ dirverse(mv) };
+		MultiVector const expInv{ invAmp.theSca * mvDv + invAmp.theTri * mvDv };
+		MultiVector const gotInv{ inverse<MultiVector>(mv) };
+		if (! nearlyEquals(gotInv, expInv, tol))
+		{
+			oss << "Failure of inv(mv) amplitude expression test\n";
+			oss << "expInv: " << expInv << '\n';
+			oss << "gotInv: " << gotInv << '\n';
+		}
+
+		// null values for non-invertible arguments
+		DirPlex const dplxNil{ e1, e31 }; // nilpotent: dplxNil^2 == 0
+		MultiVector const mvNil{ dplxNil };
+		if ( isValid(inverse<ComPlex>(zero<ComPlex>()))
+		  || isValid(inverse<ImSpin>(zero<ImSpin>()))
+		  || isValid(inverse<DirPlex>(dplxNil))
+		  || isValid(inverse<MultiVector>(mvNil))
+		  || isValid(inverse<MultiVector>(null<MultiVector>()))
+		   )
+		{
+			oss << "Failure of inverse null return test\n";
+		}
 
 		return oss.str();;
 	}
 
-	//! Check ### TODO
+	//! Check batch evaluation of inverses
 	std::string
 	test2
 		()
 	{
 		std::ostringstream oss;
-			oss << "Failure of ### test\n";
+
+		using namespace g3;
+
+		// [DoxyExampleBatch]
+		std::vector<MultiVector> const mvs
+			{ MultiVector{ -.7, .5, -.3, .2,  -.4, .6, .1, -.9 }
+			, zero<MultiVector>()
+			, MultiVector{ 0., 1., 0., 0.,  0., 1., 0., 0. } // nilpotent
+			, MultiVector{ 1.1, 1.2, 1.3, 2.1,  2.2, 2.3, 3.1, .1 }
+			, null<MultiVector>()
+			};
+		std::vector<MultiVector> invs(mvs.size());
+		std::vector<bool> okays(mvs.size());
+		batch::inverse(mvs.cbegin(), mvs.cend(), invs.begin(), okays.begin());
+		// [DoxyExampleBatch]
+
+		std::vector<bool> const expOkays{ true, false, false, true, false };
+		for (std::size_t nn{0u} ; nn < mvs.size() ; ++nn)
+		{
+			MultiVector const expInv{ inverse<MultiVector>(mvs[nn]) };
+			bool const expOkay{ expOkays[nn] };
+			if (! (okays[nn] == expOkay))
+			{
+				oss << "Failure of batch::inverse() mask test\n";
+				oss << "mv: " << mvs[nn] << '\n';
+				oss << "expOkay: " << expOkay << '\n';
+				oss << "gotOkay: " << okays[nn] << '\n';
+			}
+			if (! (isValid(invs[nn]) == expOkay))
+			{
+				oss << "Failure of batch::inverse() validity test\n";
+				oss << "mv: " << mvs[nn] << '\n';
+			}
+			if (expOkay && (! nearlyEquals(invs[nn], expInv)))
+			{
+				oss << "Failure of batch::inverse() value test\n";
+				oss << "expInv: " << expInv << '\n';
+				oss << "gotInv: " << invs[nn] << '\n';
+			}
+		}
+
+		std::vector<DirPlex> const dplxs
+			{ DirPlex{ e1, e23 }, DirPlex{ Vector{ .3, .2, .1 }, e12 } };
+		std::vector<DirPlex> dplxInvs(dplxs.size());
+		batch::inverse(dplxs.cbegin(), dplxs.cend(), dplxInvs.begin());
+		for (std::size_t nn{0u} ; nn < dplxs.size() ; ++nn)
+		{
+			DirPlex const expInv{ inverse<DirPlex>(dplxs[nn]) };
+			if (! nearlyEquals(dplxInvs[nn], expInv))
+			{
+				oss << "Failure of batch::inverse(DirPlex) test\n";
+				oss << "expInv: " << expInv << '\n';
+				oss << "gotInv: " << dplxInvs[nn] << '\n';
+			}
+		}
+
 		return oss.str();;
 	}
-*/
 
 }
 
@@ -175,8 +267,8 @@ main
 	std::stringstream oss;
 
 	oss << test0();
-	// oss << test1();
-	// oss << test2();
+	oss << test1();
+	oss << test2();
 
 	if (oss.str().empty()) // Only pass if no errors were encountered
 	{
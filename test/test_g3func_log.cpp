@@ -0,0 +1,229 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::log() of MultiVector
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3batch.hpp"
+#include "g3func.hpp"
+
+#include "g3compare.hpp"
+#include "g3io.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	//! Collection of assorted (non-trivial) multivectors
+	std::vector<g3::MultiVector>
+	someMultiVectors
+		()
+	{
+		using namespace g3;
+		return std::vector<MultiVector>
+			{ MultiVector{  .1,  1.1, 1.2, 1.3,  2.1, 2.2, 2.3,  3.1 }
+			, MultiVector{ -.7,   .5, -.3,  .2,  -.4,  .6,  .1,  -.9 }
+			, MultiVector{ 2.0,  0.0, 0.0,  .5,   .0,  .0,  .3,   .0 }
+			, MultiVector{ 1.5,  1.e-9, 0., 0.,   0., 2.e-9, 0.,  .25 }
+			, MultiVector{ .25,  0.0, 0.0, 0.0,  1.7, -.3,  .8,   0.0 }
+			, MultiVector{ 0.0,  1.0, 2.0, -.5,  0.0, 0.0, 0.0,   0.0 }
+			, MultiVector{ 3.0,  0.0, 0.0, 0.0,  0.0, 0.0, 0.0,  -2.0 }
+			};
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// A general multivector
+		MultiVector const mvSome{ .1,  1.1, 1.2, 1.3,  2.1, 2.2, 2.3,  3.1 };
+
+		// principal logarithm (in closed form)
+		MultiVector const mvLog{ log(mvSome) };
+
+		// exponentiation recovers the original
+		MultiVector const mvRedo{ exp(mvLog) };
+		// [DoxyExample01]
+
+		constexpr double tol{ 64. * std::numeric_limits<double>::epsilon() };
+		if (! nearlyEquals(mvRedo, mvSome, tol))
+		{
+			oss << "Failure of log() example test\n";
+			oss << "mvSome: " << io::enote(mvSome) << '\n';
+			oss << "mvRedo: " << io::enote(mvRedo) << '\n';
+		}
+
+		// [DoxyExampleBatch]
+		std::vector<MultiVector> const mvIns{ someMultiVectors() };
+		std::vector<MultiVector> mvLogs(mvIns.size());
+		batch::log(mvIns.cbegin(), mvIns.cend(), mvLogs.begin());
+		// [DoxyExampleBatch]
+
+		for (std::size_t nn{0u} ; nn < mvIns.size() ; ++nn)
+		{
+			MultiVector const expLog{ log(mvIns[nn]) };
+			MultiVector const & gotLog = mvLogs[nn];
+			if (! nearlyEquals(gotLog, expLog))
+			{
+				oss << "Failure of batch::log() item test\n";
+				oss << "expLog: " << expLog << '\n';
+				oss << "gotLog: " << gotLog << '\n';
+			}
+		}
+
+		return oss.str();;
+	}
+
+	//! Check log() as inverse of exp()
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		constexpr double tol{ 256. * std::numeric_limits<double>::epsilon() };
+		for (MultiVector const & mvSome : someMultiVectors())
+		{
+			MultiVector const mvLog{ log(mvSome) };
+			MultiVector const mvRedo{ exp(mvLog) };
+			if (! nearlyEquals(mvRedo, mvSome, tol))
+			{
+				oss << "Failure of exp(log()) reconstruction test\n";
+				oss << "mvSome: " << io::enote(mvSome) << '\n';
+				oss << "mvLog : " << io::enote(mvLog) << '\n';
+				oss << "mvRedo: " << io::enote(mvRedo) << '\n';
+			}
+		}
+
+		// small arguments are in principal branch: log(exp(x)) == x
+		MultiVector const mvSmall{ .1, -.2, .3, .1,  .2, -.1, .3, .2 };
+		MultiVector const gotSmall{ log(exp(mvSmall)) };
+		if (! nearlyEquals(gotSmall, mvSmall, tol))
+		{
+			oss << "Failure of log(exp()) principal branch test\n";
+			oss << "mvSmall: " << io::enote(mvSmall) << '\n';
+			oss << "gotSmall: " << io::enote(gotSmall) << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check special cases and consistency with logG2()
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		// log(-1) is I*pi in the full algebra
+		MultiVector const gotNegOne{ log(-one<MultiVector>()) };
+		MultiVector const expNegOne{ TriVector{ pi } };
+		if (! nearlyEquals(gotNegOne, expNegOne))
+		{
+			oss << "Failure of log(-1) test\n";
+			oss << "expNegOne: " << expNegOne << '\n';
+			oss << "gotNegOne: " << gotNegOne << '\n';
+		}
+
+		// general spinors match G2 subalgebra result
+		Spinor const spin{ -2., BiVector{ .5, -.3, .7 } };
+		MultiVector const expSpin{ logG2(spin) };
+		MultiVector const gotSpin{ log(MultiVector{ spin }) };
+		constexpr double tol{ 4. * std::numeric_limits<double>::epsilon() };
+		if (! nearlyEquals(gotSpin, expSpin, tol))
+		{
+			oss << "Failure of log(spinor) consistency test\n";
+			oss << "expSpin: " << expSpin << '\n';
+			oss << "gotSpin: " << gotSpin << '\n';
+		}
+
+		// no logarithm for zero (or null) values
+		if ( isValid(log(zero<MultiVector>()))
+		  || isValid(log(null<MultiVector>()))
+		   )
+		{
+			oss << "Failure of log() null return test\n";
+		}
+
+		// nilpotent part: log(1 + d) = d when d*d == 0
+		MultiVector const dirNil{ 0., 1., 0., 0.,  0., 1., 0., 0. }; // e1+e31
+		MultiVector const gotNil{ log(one<MultiVector>() + dirNil) };
+		if (! nearlyEquals(gotNil, dirNil))
+		{
+			oss << "Failure of log() nilpotent test\n";
+			oss << "expNil: " << dirNil << '\n';
+			oss << "gotNil: " << gotNil << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of MultiVector logarithm function
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
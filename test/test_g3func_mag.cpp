@@ -30,13 +30,18 @@
 
 #include "checks.hpp" // testing environment common utilities
 
+#include "g3batch.hpp"
 #include "g3func.hpp"
 
 #include "g3compare.hpp"
 #include "g3io.hpp"
 
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 
 namespace
@@ -139,6 +144,160 @@ namespace
 		return oss.str();;
 	}
 
+	//! Check batch magnitude and direction evaluations
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		// [DoxyExampleBatch]
+		std::vector<Vector> const vecs
+			{ Vector{ 3., 5., 7. }
+			, zero<Vector>()
+			, Vector{ -1.e-3, 2.e-3, 0. }
+			, null<Vector>()
+			};
+		std::vector<double> mags(vecs.size());
+		std::vector<Vector> dirs(vecs.size());
+		batch::pairMagDirFrom
+			(vecs.cbegin(), vecs.cend(), mags.begin(), dirs.begin());
+		// [DoxyExampleBatch]
+
+		std::vector<double> magOnlys(vecs.size());
+		batch::magnitude(vecs.cbegin(), vecs.cend(), magOnlys.begin());
+		std::vector<Vector> dirOnlys(vecs.size());
+		batch::direction(vecs.cbegin(), vecs.cend(), dirOnlys.begin());
+
+		for (std::size_t nn{0u} ; nn < vecs.size() ; ++nn)
+		{
+			std::pair<double, Vector> const exp{ pairMagDirFrom(vecs[nn]) };
+			bool const expOkay{ isValid(exp.second) };
+			if ( (! (isValid(dirs[nn]) == expOkay))
+			  || (! (isValid(dirOnlys[nn]) == expOkay))
+			   )
+			{
+				oss << "Failure of batch direction validity test\n";
+				oss << "vec: " << vecs[nn] << '\n';
+			}
+			if (isValid(exp.first))
+			{
+				if ( (! nearlyEquals(mags[nn], exp.first))
+				  || (! nearlyEquals(magOnlys[nn], exp.first))
+				   )
+				{
+					oss << "Failure of batch magnitude test\n";
+					oss << "expMag: " << exp.first << '\n';
+					oss << "gotMag: " << mags[nn] << '\n';
+				}
+			}
+			if (expOkay)
+			{
+				if ( (! nearlyEquals(dirs[nn], exp.second))
+				  || (! nearlyEquals(dirOnlys[nn], exp.second))
+				   )
+				{
+					oss << "Failure of batch direction test\n";
+					oss << "expDir: " << exp.second << '\n';
+					oss << "gotDir: " << dirs[nn] << '\n';
+				}
+			}
+		}
+
+		// unitary spinors
+		std::vector<Spinor> const spins
+			{ Spinor{ 2., BiVector{ .3, -.4, .1 } }
+			, Spinor{ -.1, BiVector{ 7., 5., -3. } }
+			};
+		std::vector<Spinor> spinDirs(spins.size());
+		batch::direction(spins.cbegin(), spins.cend(), spinDirs.begin());
+		for (Spinor const & spinDir : spinDirs)
+		{
+			if (! nearlyEquals(magnitude(spinDir), 1.))
+			{
+				oss << "Failure of batch direction spinor test\n";
+				oss << "spinDir: " << spinDir << '\n';
+			}
+		}
+
+		return oss.str();;
+	}
+
+	//! True if components are identical (or both NaN)
+	bool
+	sameBits
+		( engabra::g3::Vector const & vecA
+		, engabra::g3::Vector const & vecB
+		)
+	{
+		bool same{ true };
+		for (std::size_t nn{0u} ; nn < 3u ; ++nn)
+		{
+			double const & compA = vecA[nn];
+			double const & compB = vecB[nn];
+			if (std::isnan(compA) || std::isnan(compB))
+			{
+				same = same && std::isnan(compA) && std::isnan(compB);
+			}
+			else
+			{
+				same = same
+					&& (0 == std::memcmp(&compA, &compB, sizeof(double)));
+			}
+		}
+		return same;
+	}
+
+	//! Check batch directions are identical to individual item directions
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		constexpr double tiny{ std::numeric_limits<double>::denorm_min() };
+		constexpr double inf{ std::numeric_limits<double>::infinity() };
+		std::vector<Vector> vecs
+			{ null<Vector>()
+			, zero<Vector>()
+			, Vector{ tiny, 0., 0. } // magSq underflows to zero
+			, Vector{ 1.e-160, 0., 3.e-161 } // magSq is denormalized
+			, Vector{ 1.e200, 0., -1.e200 } // magSq overflows
+			, Vector{ inf, 0., 0. }
+			};
+		for (int expo{ -150 } ; expo < 150 ; expo += 3)
+		{
+			double const scale{ std::ldexp(1., expo) };
+			vecs.emplace_back(scale * Vector{ .3, -.7, 1.9 });
+			vecs.emplace_back(scale * Vector{ -.01, 2.3, .2 });
+		}
+		std::vector<Vector> dirs(vecs.size());
+		batch::direction(vecs.cbegin(), vecs.cend(), dirs.begin());
+		std::vector<double> pairMags(vecs.size());
+		std::vector<Vector> pairDirs(vecs.size());
+		batch::pairMagDirFrom
+			(vecs.cbegin(), vecs.cend(), pairMags.begin(), pairDirs.begin());
+		for (std::size_t nn{0u} ; nn < vecs.size() ; ++nn)
+		{
+			Vector const expDir{ direction(vecs[nn]) };
+			if (! ( sameBits(dirs[nn], expDir)
+				 && sameBits(pairDirs[nn], expDir)
+				  ))
+			{
+				oss << "Failure of batch direction identity test\n";
+				oss << "vec: " << io::enote(vecs[nn]) << '\n';
+				oss << "expDir: " << io::enote(expDir) << '\n';
+				oss << "gotDir: " << io::enote(dirs[nn]) << '\n';
+			}
+		}
+
+		return oss.str();;
+	}
+
 }
 
 //! Check behavior of magnitude functions
@@ -150,8 +309,8 @@ main
 	std::stringstream oss;
 
 	oss << test0();
-	// oss << test1();
-	// oss << test2();
+	oss << test1();
+	oss << test2();
 
 	if (oss.str().empty()) // Only pass if no errors were encountered
 	{
@@ -0,0 +1,310 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::pow()
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3batch.hpp"
+#include "g3func.hpp"
+
+#include "g3compare.hpp"
+#include "g3io.hpp"
+
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 64. * std::numeric_limits<double>::epsilon() };
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// Spinor for rotation a quarter turn in the e12 plane
+		Spinor const spinBeg{ one<Spinor>() };
+		Spinor const spinEnd{ exp(.5 * turnQtr * e12) };
+
+		// Interpolate rotation from start to end orientation
+		Spinor const spinDelta{ spinEnd * reverse(spinBeg) };
+		double const frac{ .25 };
+		Spinor const spinFrac{ pow(spinDelta, frac) * spinBeg };
+		// [DoxyExample01]
+
+		Spinor const expFrac{ exp((frac * .5 * turnQtr) * e12) };
+		if (! nearlyEquals(spinFrac, expFrac, sTol))
+		{
+			oss << "Failure of pow() interpolation example test\n";
+			oss << "expFrac: " << expFrac << '\n';
+			oss << "gotFrac: " << spinFrac << '\n';
+		}
+
+		// [DoxyExample02]
+		MultiVector const mvSome{ .1, -.2, .3, .1,  .2, -.1, .3, .2 };
+		MultiVector const mvCube{ pow(mvSome, 3) };
+		// [DoxyExample02]
+
+		MultiVector const expCube{ mvSome * mvSome * mvSome };
+		if (! nearlyEquals(mvCube, expCube, sTol))
+		{
+			oss << "Failure of pow() MultiVector example test\n";
+			oss << "expCube: " << expCube << '\n';
+			oss << "gotCube: " << mvCube << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check Spinor real powers
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		Spinor const spin{ -.7, BiVector{ .5, .2, -.1 } };
+
+		// integer powers
+		if (! nearlyEquals(pow(spin, 2.), sq(spin), sTol))
+		{
+			oss << "Failure of pow(spin,2) test\n";
+		}
+		if (! nearlyEquals(pow(spin, 3.), cube(spin), sTol))
+		{
+			oss << "Failure of pow(spin,3) test\n";
+		}
+		Spinor const spinInv{ pow(spin, -1.) };
+		if (! nearlyEquals(spinInv * spin, one<Spinor>(), sTol))
+		{
+			oss << "Failure of pow(spin,-1) test\n";
+			oss << "spinInv: " << spinInv << '\n';
+		}
+		if (! nearlyEquals(pow(spin, 0.), one<Spinor>(), sTol))
+		{
+			oss << "Failure of pow(spin,0) test\n";
+		}
+
+		// fractional powers
+		if (! nearlyEquals(pow(spin, .5), sqrtG2(spin), sTol))
+		{
+			oss << "Failure of pow(spin,.5) test\n";
+			oss << "exp: " << sqrtG2(spin) << '\n';
+			oss << "got: " << pow(spin, .5) << '\n';
+		}
+
+		// small angle fast path matches exp(t*log()) evaluation
+		for (double const & expo : { 1.e-6, -3.e-5, 1.e-3, .37, -2.2 })
+		{
+			Spinor const expPow{ exp(expo * logG2(spin)) };
+			Spinor const gotPow{ pow(spin, expo) };
+			if (! nearlyEquals(gotPow, expPow, sTol))
+			{
+				oss << "Failure of pow(spin,expo) test\n";
+				oss << "expo: " << expo << '\n';
+				oss << "expPow: " << io::enote(expPow) << '\n';
+				oss << "gotPow: " << io::enote(gotPow) << '\n';
+			}
+		}
+
+		// negative scalar uses provided plane
+		Spinor const gotNeg{ pow(Spinor{ -4., zero<BiVector>() }, .5, e31) };
+		Spinor const expNeg{ 0., 2. * e31 };
+		if (! nearlyEquals(gotNeg, expNeg, sTol))
+		{
+			oss << "Failure of pow(negative) test\n";
+			oss << "expNeg: " << expNeg << '\n';
+			oss << "gotNeg: " << gotNeg << '\n';
+		}
+
+		// zero and null
+		if ( (! nearlyEquals(pow(zero<Spinor>(), 2.5), zero<Spinor>()))
+		  || isValid(pow(zero<Spinor>(), -1.))
+		  || isValid(pow(null<Spinor>(), 2.))
+		   )
+		{
+			oss << "Failure of pow() zero/null test\n";
+		}
+
+		// infinite magnitude has no (finite) powers
+		constexpr double inf{ std::numeric_limits<double>::infinity() };
+		if ( isValid(pow(Spinor{ inf, zero<BiVector>() }, 2.))
+		  || isValid(pow(Spinor{ 1., BiVector{ inf, 0., 0. } }, .5))
+		   )
+		{
+			oss << "Failure of pow() infinite magnitude test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check MultiVector integer powers
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		MultiVector const mv{ -.7, .5, -.3, .2,  -.4, .6, .1, -.9 };
+		MultiVector expPow{ one<MultiVector>() };
+		for (int expo{0} ; expo < 11 ; ++expo)
+		{
+			MultiVector const gotPow{ pow(mv, expo) };
+			if (! nearlyEquals(gotPow, expPow, sTol))
+			{
+				oss << "Failure of pow(mv,int) test\n";
+				oss << "expo: " << expo << '\n';
+				oss << "expPow: " << io::enote(expPow) << '\n';
+				oss << "gotPow: " << io::enote(gotPow) << '\n';
+			}
+			expPow = expPow * mv;
+		}
+
+		MultiVector const gotNeg{ pow(mv, -3) * cube(mv) };
+		if (! nearlyEquals(gotNeg, one<MultiVector>(), sTol))
+		{
+			oss << "Failure of pow(mv,-3) test\n";
+			oss << "gotNeg: " << io::enote(gotNeg) << '\n';
+		}
+
+		// no negative powers of nilpotent element
+		MultiVector const mvNil{ 0., 1., 0., 0.,  0., 1., 0., 0. };
+		if (isValid(pow(mvNil, -1)))
+		{
+			oss << "Failure of pow(nilpotent,-1) test\n";
+		}
+
+		// most negative exponent (even power of -1 is one)
+		MultiVector const gotMin
+			{ pow(-one<MultiVector>(), std::numeric_limits<int>::min()) };
+		if (! nearlyEquals(gotMin, one<MultiVector>(), sTol))
+		{
+			oss << "Failure of pow(mv,INT_MIN) test\n";
+			oss << "gotMin: " << io::enote(gotMin) << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check batch evaluations
+	std::string
+	test3
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		// [DoxyExampleBatch]
+		Spinor const spin{ exp(.75 * e23) };
+		std::vector<double> const fracs{ 0., .125, .25, .5, .75, 1. };
+		std::vector<Spinor> spinFracs(fracs.size());
+		batch::pow(spin, fracs.cbegin(), fracs.cend(), spinFracs.begin());
+		// [DoxyExampleBatch]
+
+		for (std::size_t nn{0u} ; nn < fracs.size() ; ++nn)
+		{
+			Spinor const expSpin{ pow(spin, fracs[nn]) };
+			if (! nearlyEquals(spinFracs[nn], expSpin))
+			{
+				oss << "Failure of batch::pow(spin) test\n";
+				oss << "expSpin: " << expSpin << '\n';
+				oss << "gotSpin: " << spinFracs[nn] << '\n';
+			}
+		}
+
+		MultiVector const mv{ -.7, .5, -.3, .2,  -.4, .6, .1, -.9 };
+		std::vector<int> const expos{ -2, -1, 0, 1, 2, 7 };
+		std::vector<MultiVector> mvPows(expos.size());
+		batch::pow(mv, expos.cbegin(), expos.cend(), mvPows.begin());
+		for (std::size_t nn{0u} ; nn < expos.size() ; ++nn)
+		{
+			MultiVector const expPow{ pow(mv, expos[nn]) };
+			if (! nearlyEquals(mvPows[nn], expPow))
+			{
+				oss << "Failure of batch::pow(mv) test\n";
+				oss << "expPow: " << expPow << '\n';
+				oss << "gotPow: " << mvPows[nn] << '\n';
+			}
+		}
+
+		std::vector<Spinor> nullPows(fracs.size());
+		batch::pow
+			(null<Spinor>(), fracs.cbegin(), fracs.cend(), nullPows.begin());
+		if (isValid(nullPows.back()))
+		{
+			oss << "Failure of batch::pow(null) test\n";
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of power functions
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+	oss << test3();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
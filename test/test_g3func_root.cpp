@@ -0,0 +1,202 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::sqrt() of MultiVector
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3batch.hpp"
+#include "g3func.hpp"
+
+#include "g3compare.hpp"
+#include "g3io.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// A general multivector
+		MultiVector const mvSome{ .1,  1.1, 1.2, 1.3,  2.1, 2.2, 2.3,  3.1 };
+
+		// principal square root (in closed form)
+		MultiVector const mvRoot{ sqrt(mvSome) };
+
+		// squaring recovers the original
+		MultiVector const mvRedo{ sq(mvRoot) };
+		// [DoxyExample01]
+
+		constexpr double tol{ 64. * std::numeric_limits<double>::epsilon() };
+		if (! nearlyEquals(mvRedo, mvSome, tol))
+		{
+			oss << "Failure of sqrt() example test\n";
+			oss << "mvSome: " << io::enote(mvSome) << '\n';
+			oss << "mvRedo: " << io::enote(mvRedo) << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check sqrt() for assorted values (and batch evaluation)
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		std::vector<MultiVector> const mvIns
+			{ MultiVector{ -.7,   .5, -.3,  .2,  -.4,  .6,  .1,  -.9 }
+			, MultiVector{ 2.0,  0.0, 0.0,  .5,   .0,  .0,  .3,   .0 }
+			, MultiVector{ 1.5,  1.e-9, 0., 0.,   0., 2.e-9, 0.,  .25 }
+			, MultiVector{ .25,  0.0, 0.0, 0.0,  1.7, -.3,  .8,   0.0 }
+			, MultiVector{ 0.0,  1.0, 2.0, -.5,  0.0, 0.0, 0.0,   0.0 }
+			, MultiVector{ -4.,  0.0, 0.0, 0.0,  0.0, 0.0, 0.0,   0.0 }
+			, MultiVector{ 1.0,  1.0, 0.0, 0.0,  1.0, 0.0, 0.0,   0.0 }
+			};
+		std::vector<MultiVector> mvRoots(mvIns.size());
+		batch::sqrt(mvIns.cbegin(), mvIns.cend(), mvRoots.begin());
+
+		constexpr double tol{ 64. * std::numeric_limits<double>::epsilon() };
+		for (std::size_t nn{0u} ; nn < mvIns.size() ; ++nn)
+		{
+			MultiVector const & mvIn = mvIns[nn];
+			MultiVector const & gotRoot = mvRoots[nn];
+			MultiVector const expRoot{ sqrt(mvIn) };
+			if (! nearlyEquals(gotRoot, expRoot))
+			{
+				oss << "Failure of batch::sqrt() item test\n";
+				oss << "expRoot: " << expRoot << '\n';
+				oss << "gotRoot: " << gotRoot << '\n';
+			}
+			MultiVector const mvRedo{ sq(gotRoot) };
+			if (! nearlyEquals(mvRedo, mvIn, tol))
+			{
+				oss << "Failure of sq(sqrt()) reconstruction test\n";
+				oss << "mvIn  : " << io::enote(mvIn) << '\n';
+				oss << "mvRedo: " << io::enote(mvRedo) << '\n';
+			}
+		}
+
+		return oss.str();;
+	}
+
+	//! Check special cases
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		// sqrt(-1) is the unit trivector in the full algebra
+		MultiVector const gotNegOne{ sqrt(-one<MultiVector>()) };
+		MultiVector const expNegOne{ e123 };
+		if (! nearlyEquals(gotNegOne, expNegOne))
+		{
+			oss << "Failure of sqrt(-1) test\n";
+			oss << "expNegOne: " << expNegOne << '\n';
+			oss << "gotNegOne: " << gotNegOne << '\n';
+		}
+
+		// root of zero is zero
+		MultiVector const gotZero{ sqrt(zero<MultiVector>()) };
+		if (! nearlyEquals(gotZero, zero<MultiVector>()))
+		{
+			oss << "Failure of sqrt(0) test\n";
+			oss << "gotZero: " << gotZero << '\n';
+		}
+
+		// no root for nilpotent element
+		MultiVector const mvNil{ 0., 1., 0., 0.,  0., 1., 0., 0. }; // e1+e31
+		MultiVector const gotNil{ sqrt(mvNil) };
+		if (isValid(gotNil))
+		{
+			oss << "Failure of sqrt(nilpotent) null test\n";
+			oss << "gotNil: " << gotNil << '\n';
+		}
+
+		// spinors match G2 subalgebra result
+		Spinor const spin{ 1.5, BiVector{ .5, -.3, .7 } };
+		MultiVector const expSpin{ sqrtG2(spin) };
+		MultiVector const gotSpin{ sqrt(MultiVector{ spin }) };
+		constexpr double tol{ 8. * std::numeric_limits<double>::epsilon() };
+		if (! nearlyEquals(gotSpin, expSpin, tol))
+		{
+			oss << "Failure of sqrt(spinor) consistency test\n";
+			oss << "expSpin: " << expSpin << '\n';
+			oss << "gotSpin: " << gotSpin << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of MultiVector square root function
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,323 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+/*! \file
+\brief Unit tests (and example) code for circular and hyperbolic functions.
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3batch.hpp"
+#include "g3func.hpp"
+
+#include "g3compare.hpp"
+#include "g3io.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 64. * std::numeric_limits<double>::epsilon() };
+
+	//! Collection of assorted multivectors
+	std::vector<g3::MultiVector>
+	someMultiVectors
+		()
+	{
+		using namespace g3;
+		return std::vector<MultiVector>
+			{ zero<MultiVector>()
+			, MultiVector{  .1,  1.1, 1.2, 1.3,  2.1, 2.2, 2.3,   .1 }
+			, MultiVector{ -.7,   .5, -.3,  .2,  -.4,  .6,  .1,  -.9 }
+			, MultiVector{ 1.5,  1.e-9, 0., 0.,   0., 2.e-9, 0.,  .25 }
+			, MultiVector{ .25,  0.0, 0.0, 0.0,  1.7, -.3,  .8,   0.0 }
+			, MultiVector{ 0.0,  1.0, 2.0, -.5,  0.0, 0.0, 0.0,   0.0 }
+			, MultiVector{ 0.0,  1.0, 0.0, 0.0,  0.0, 1.0, 0.0,   0.0 }
+			};
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// Simultaneous evaluation of sin() and cos() values
+		MultiVector const mvSome{ .1,  .2, -.3, .1,  .2, .1, -.3,  .1 };
+		std::pair<MultiVector, MultiVector> const sinCos{ sincos(mvSome) };
+		MultiVector const & mvSin = sinCos.first;
+		MultiVector const & mvCos = sinCos.second;
+
+		// Pythagorean identity holds for (self commuting) arguments
+		MultiVector const mvOne{ sq(mvSin) + sq(mvCos) };
+		// [DoxyExample01]
+
+		if (! nearlyEquals(mvOne, one<MultiVector>(), sTol))
+		{
+			oss << "Failure of sincos() Pythagorean test\n";
+			oss << "mvOne: " << io::enote(mvOne) << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check MultiVector functions against exp() evaluations
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		for (MultiVector const & mv : someMultiVectors())
+		{
+			// hyperbolic functions from exp(+/-M)
+			MultiVector const expP{ exp(mv) };
+			MultiVector const expN{ exp(-mv) };
+			MultiVector const expSinh{ .5 * (expP - expN) };
+			MultiVector const expCosh{ .5 * (expP + expN) };
+
+			// circular functions from exp(+/-I*M)
+			MultiVector const mvI{ e123 * mv };
+			MultiVector const expIP{ exp(mvI) };
+			MultiVector const expIN{ exp(-mvI) };
+			MultiVector const expSin{ -.5 * (e123 * (expIP - expIN)) };
+			MultiVector const expCos{ .5 * (expIP + expIN) };
+
+			std::pair<MultiVector, MultiVector> const gotShCh
+				{ sinhcosh(mv) };
+			std::pair<MultiVector, MultiVector> const gotSnCs
+				{ sincos(mv) };
+
+			if ( (! nearlyEquals(gotShCh.first, expSinh, sTol))
+			  || (! nearlyEquals(sinh(mv), expSinh, sTol))
+			   )
+			{
+				oss << "Failure of sinh() test\n";
+				oss << "expSinh: " << io::enote(expSinh) << '\n';
+				oss << "gotSinh: " << io::enote(gotShCh.first) << '\n';
+			}
+			if ( (! nearlyEquals(gotShCh.second, expCosh, sTol))
+			  || (! nearlyEquals(cosh(mv), expCosh, sTol))
+			   )
+			{
+				oss << "Failure of cosh() test\n";
+				oss << "expCosh: " << io::enote(expCosh) << '\n';
+				oss << "gotCosh: " << io::enote(gotShCh.second) << '\n';
+			}
+			if ( (! nearlyEquals(gotSnCs.first, expSin, sTol))
+			  || (! nearlyEquals(sin(mv), expSin, sTol))
+			   )
+			{
+				oss << "Failure of sin() test\n";
+				oss << "expSin: " << io::enote(expSin) << '\n';
+				oss << "gotSin: " << io::enote(gotSnCs.first) << '\n';
+			}
+			if ( (! nearlyEquals(gotSnCs.second, expCos, sTol))
+			  || (! nearlyEquals(cos(mv), expCos, sTol))
+			   )
+			{
+				oss << "Failure of cos() test\n";
+				oss << "expCos: " << io::enote(expCos) << '\n';
+				oss << "gotCos: " << io::enote(gotSnCs.second) << '\n';
+			}
+		}
+
+		return oss.str();;
+	}
+
+	//! Check specialized types against MultiVector evaluation
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		BiVector const biv{ .3, -.4, 1.2 };
+		Spinor const spin{ -.7, BiVector{ .5, .2, -.1 } };
+		Spinor const spinSca{ 1.3, zero<BiVector>() };
+		ComPlex const cplx{ Scalar{ .6 }, TriVector{ -1.1 } };
+
+		// BiVector
+		std::pair<Spinor, Spinor> const bivSC{ sincos(biv) };
+		std::pair<Spinor, Spinor> const bivHC{ sinhcosh(biv) };
+		std::pair<MultiVector, MultiVector> const mvbSC
+			{ sincos(MultiVector{ biv }) };
+		std::pair<MultiVector, MultiVector> const mvbHC
+			{ sinhcosh(MultiVector{ biv }) };
+		if ( (! nearlyEquals(MultiVector{ bivSC.first }, mvbSC.first, sTol))
+		  || (! nearlyEquals(MultiVector{ bivSC.second }, mvbSC.second, sTol))
+		  || (! nearlyEquals(MultiVector{ bivHC.first }, mvbHC.first, sTol))
+		  || (! nearlyEquals(MultiVector{ bivHC.second }, mvbHC.second, sTol))
+		   )
+		{
+			oss << "Failure of BiVector trig test\n";
+		}
+
+		// BiVector hyperbolic functions are circular along unit plane
+		double const bivMag{ magnitude(biv) };
+		Spinor const expSinhB{ 0., (std::sin(bivMag)/bivMag) * biv };
+		if (! nearlyEquals(sinh(biv), expSinhB, sTol))
+		{
+			oss << "Failure of sinh(BiVector) test\n";
+			oss << "expSinhB: " << expSinhB << '\n';
+			oss << "gotSinhB: " << sinh(biv) << '\n';
+		}
+
+		// Spinor
+		for (Spinor const & sp : { spin, spinSca })
+		{
+			std::pair<Spinor, Spinor> const spSC{ sincos(sp) };
+			std::pair<Spinor, Spinor> const spHC{ sinhcosh(sp) };
+			std::pair<MultiVector, MultiVector> const mvsSC
+				{ sincos(MultiVector{ sp }) };
+			std::pair<MultiVector, MultiVector> const mvsHC
+				{ sinhcosh(MultiVector{ sp }) };
+			if ( (! nearlyEquals(MultiVector{ spSC.first }, mvsSC.first, sTol))
+			  || (! nearlyEquals(MultiVector{ spSC.second }, mvsSC.second, sTol))
+			  || (! nearlyEquals(MultiVector{ spHC.first }, mvsHC.first, sTol))
+			  || (! nearlyEquals(MultiVector{ spHC.second }, mvsHC.second, sTol))
+			   )
+			{
+				oss << "Failure of Spinor trig test\n";
+				oss << "sp: " << sp << '\n';
+			}
+		}
+
+		// ComPlex matches std::complex functions
+		std::complex<double> const zz{ cplx };
+		if ( (! nearlyEquals(sin(cplx), ComPlex::from(std::sin(zz)), sTol))
+		  || (! nearlyEquals(cos(cplx), ComPlex::from(std::cos(zz)), sTol))
+		  || (! nearlyEquals(sinh(cplx), ComPlex::from(std::sinh(zz)), sTol))
+		  || (! nearlyEquals(cosh(cplx), ComPlex::from(std::cosh(zz)), sTol))
+		   )
+		{
+			oss << "Failure of ComPlex trig test\n";
+		}
+
+		// null arguments provide null results
+		if ( isValid(sincos(null<MultiVector>()).first)
+		  || isValid(sinhcosh(null<Spinor>()).second)
+		   )
+		{
+			oss << "Failure of trig null test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check batch evaluations
+	std::string
+	test3
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		// [DoxyExampleBatch]
+		std::vector<MultiVector> const mvIns{ someMultiVectors() };
+		std::vector<MultiVector> mvSins(mvIns.size());
+		std::vector<MultiVector> mvCoss(mvIns.size());
+		batch::sincos
+			(mvIns.cbegin(), mvIns.cend(), mvSins.begin(), mvCoss.begin());
+		// [DoxyExampleBatch]
+
+		std::vector<MultiVector> mvSinhs(mvIns.size());
+		std::vector<MultiVector> mvCoshs(mvIns.size());
+		batch::sinhcosh
+			(mvIns.cbegin(), mvIns.cend(), mvSinhs.begin(), mvCoshs.begin());
+
+		std::vector<BiVector> const bivs{ e23, e31, BiVector{ .3, .4, .5 } };
+		std::vector<Spinor> bivCoss(bivs.size());
+		batch::cos(bivs.cbegin(), bivs.cend(), bivCoss.begin());
+
+		for (std::size_t nn{0u} ; nn < mvIns.size() ; ++nn)
+		{
+			MultiVector const & mv = mvIns[nn];
+			if ( (! nearlyEquals(mvSins[nn], sin(mv)))
+			  || (! nearlyEquals(mvCoss[nn], cos(mv)))
+			  || (! nearlyEquals(mvSinhs[nn], sinh(mv)))
+			  || (! nearlyEquals(mvCoshs[nn], cosh(mv)))
+			   )
+			{
+				oss << "Failure of batch trig MultiVector test\n";
+				oss << "mv: " << mv << '\n';
+			}
+		}
+		for (std::size_t nn{0u} ; nn < bivs.size() ; ++nn)
+		{
+			if (! nearlyEquals(bivCoss[nn], cos(bivs[nn])))
+			{
+				oss << "Failure of batch trig BiVector test\n";
+				oss << "biv: " << bivs[nn] << '\n';
+			}
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of circular and hyperbolic functions
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+	oss << test3();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
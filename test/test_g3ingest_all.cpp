@@ -0,0 +1,260 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::io text ingestion
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3ingest.hpp"
+
+#include "g3compare.hpp"
+#include "g3io.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		std::string const text
+			{ "# spinor data\n"
+			  "1.0 0.0 0.0 0.0\n"
+			  "0.5, 0.5, -0.5, 0.5\n"
+			  "\n"
+			  "0.1 0.2 0.3\n" // too few values
+			  "  .7   .0e+0   +.1  -.7  \n"
+			};
+		io::Ingested<Spinor> const got{ io::ingestText<Spinor>(text) };
+		// got.theItems.size() == 4 (items 0, 1, 3 valid; item 2 null)
+		// got.theErrors.size() == 1 (theLineNum == 5, theNdxItem == 2)
+		// [DoxyExample01]
+
+		std::vector<Spinor> const expItems
+			{ Spinor{ 1., 0., 0., 0. }
+			, Spinor{ .5, .5, -.5, .5 }
+			, null<Spinor>()
+			, Spinor{ .7, 0., .1, -.7 }
+			};
+		bool okay
+			{ (expItems.size() == got.theItems.size())
+			&& (1u == got.theErrors.size())
+			&& (6u == got.theNumLines)
+			};
+		for (std::size_t nn{0u} ; okay && (nn < expItems.size()) ; ++nn)
+		{
+			okay = (isValid(expItems[nn]) == isValid(got.theItems[nn]));
+			if (okay && isValid(expItems[nn]))
+			{
+				okay = nearlyEquals(expItems[nn], got.theItems[nn]);
+			}
+		}
+		if (okay)
+		{
+			okay = (5u == got.theErrors[0].theLineNum)
+				&& (2u == got.theErrors[0].theNdxItem);
+		}
+		if (! okay)
+		{
+			oss << "Failure of ingestText() example test\n";
+			oss << "numItems: " << got.theItems.size() << '\n';
+			oss << "numErrors: " << got.theErrors.size() << '\n';
+			oss << "numLines: " << got.theNumLines << '\n';
+		}
+
+		// malformed values
+		std::vector<std::string> const bads
+			{ "1 2 x", "1 2 3 4", "1 2 3x", "1 nan 3", "1,,2 3" };
+		for (std::string const & bad : bads)
+		{
+			io::Ingested<Vector> const gotBad{ io::ingestText<Vector>(bad) };
+			bool const isNull
+				{ (1u == gotBad.theItems.size())
+				&& (! isValid(gotBad.theItems[0]))
+				&& (1u == gotBad.theErrors.size())
+				};
+			// NOTE: repeated commas are (leniently) treated as one separator
+			bool const expNull{ ("1,,2 3" != bad) };
+			if (! (expNull == isNull))
+			{
+				oss << "Failure of malformed line test\n";
+				oss << "bad: '" << bad << "'\n";
+			}
+		}
+
+		// final line without trailing newline
+		io::Ingested<Vector> const gotLast
+			{ io::ingestText<Vector>(std::string("1 2 3\n4 5 6")) };
+		if (! ( (2u == gotLast.theNumLines)
+			 && (2u == gotLast.theItems.size())
+			 && nearlyEquals(gotLast.theItems[1], Vector{ 4., 5., 6. })
+			  ))
+		{
+			oss << "Failure of final line without newline test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check large multithreaded and blockwise ingestion
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		constexpr std::size_t numLines{ 200000u };
+		std::vector<MultiVector> expItems;
+		std::ostringstream txt;
+		txt.precision(17);
+		for (std::size_t nn{0u} ; nn < numLines ; ++nn)
+		{
+			double const tt{ static_cast<double>(nn) };
+			MultiVector const mv
+				{ tt, -tt, .5*tt, 1./(tt + 1.), tt*tt, 3., -2., 1.e-3*tt };
+			if (0u == (nn % 9973u))
+			{
+				txt << "bad line\n";
+				expItems.emplace_back(null<MultiVector>());
+			}
+			else
+			{
+				for (std::size_t kk{0u} ; kk < 8u ; ++kk)
+				{
+					txt << mv[kk] << ((7u == kk) ? '\n' : ',');
+				}
+				expItems.emplace_back(mv);
+			}
+		}
+		std::string const text{ txt.str() };
+
+		io::Ingested<MultiVector> const got1
+			{ io::ingestText<MultiVector>(text, 1u) };
+		io::Ingested<MultiVector> const gotN
+			{ io::ingestText<MultiVector>(text, 8u) };
+		std::istringstream istrm(text);
+		io::Ingested<MultiVector> const gotS
+			{ io::ingestStream<MultiVector>(istrm, 4u, 100000u) };
+
+		std::size_t errCount{ 0u };
+		for (io::Ingested<MultiVector> const * got : { &got1, &gotN, &gotS })
+		{
+			if (! (expItems.size() == got->theItems.size()))
+			{
+				++errCount;
+				continue;
+			}
+			for (std::size_t nn{0u} ; nn < expItems.size() ; ++nn)
+			{
+				MultiVector const & exp = expItems[nn];
+				MultiVector const & itm = got->theItems[nn];
+				bool const same
+					{ (isValid(exp) == isValid(itm))
+					&& ((! isValid(exp)) || nearlyEquals(exp, itm))
+					};
+				if (! same)
+				{
+					++errCount;
+				}
+			}
+			std::size_t const expNumErr{ 1u + (numLines - 1u) / 9973u };
+			if ( (! (expNumErr == got->theErrors.size()))
+			  || (! (numLines == got->theNumLines))
+			   )
+			{
+				++errCount;
+			}
+			for (io::LineError const & err : got->theErrors)
+			{
+				if ( (! (err.theLineNum == (err.theNdxItem + 1u)))
+				  || isValid(got->theItems[err.theNdxItem])
+				   )
+				{
+					++errCount;
+				}
+			}
+		}
+		if (0u < errCount)
+		{
+			oss << "Failure of multithreaded/stream ingest test\n";
+			oss << "errCount: " << errCount << '\n';
+		}
+
+		// missing file
+		io::Ingested<Vector> const gotNone
+			{ io::ingestFile<Vector>("/no/such/file/for/engabra") };
+		if ( (! gotNone.theItems.empty())
+		  || (! (1u == gotNone.theErrors.size()))
+		   )
+		{
+			oss << "Failure of missing file test\n";
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of parallel text ingestion
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
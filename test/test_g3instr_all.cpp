@@ -0,0 +1,227 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::instr counters
+*/
+
+
+// Enable instrumentation for this test program
+#if ! defined(Engabra_Instrument)
+#	define Engabra_Instrument
+#endif
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3instr.hpp"
+
+#include "g3func.hpp"
+#include "g3ops.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+
+	//! Count for named site (zero if not called)
+	g3::instr::SiteCount
+	countFor
+		( std::vector<g3::instr::SiteCount> const & counts
+		, std::string const & name
+		)
+	{
+		g3::instr::SiteCount result{ name, 0u, 0u };
+		std::vector<g3::instr::SiteCount>::const_iterator const itFind
+			{ std::find_if
+				( counts.cbegin(), counts.cend()
+				, [&name] (g3::instr::SiteCount const & count)
+					{ return (name == count.theName); }
+				)
+			};
+		if (counts.cend() != itFind)
+		{
+			result = *itFind;
+		}
+		return result;
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		g3::instr::reset();
+
+		// [DoxyExample01]
+		// compile with Engabra_Instrument defined (e.g. cmake option)
+		using namespace engabra::g3;
+
+		Spinor const spinA{ exp(BiVector{ .1, .2, .3 }) };
+		Spinor const spinB{ exp(BiVector{ .3, .2, .1 }) };
+		Spinor spinC{ one<Spinor>() };
+		for (std::size_t nn{ 0u } ; nn < 10u ; ++nn)
+		{
+			spinC = spinC * spinA * spinB;
+		}
+
+		// counts for all (called) operations, most called first
+		std::vector<instr::SiteCount> const counts{ instr::siteCounts() };
+		// counts.front() is Spinor*Spinor with 20 calls (and 560 flops)
+		// instr::report(std::cout); // prints table of all counts
+		// [DoxyExample01]
+
+		if (! instr::sIsEnabled)
+		{
+			oss << "Failure of instrumentation enabled test\n";
+		}
+
+		instr::SiteCount const gotMul{ countFor(counts, "Spinor*Spinor") };
+		// 16 products and 12 sums per call
+		instr::SiteCount const expMul{ "Spinor*Spinor", 20u, 20u*28u };
+		if (! ( (expMul.theNumCalls == gotMul.theNumCalls)
+			  && (expMul.theNumFlops == gotMul.theNumFlops)
+			  )
+		   )
+		{
+			oss << "Failure of Spinor*Spinor count test\n";
+			oss << "exp: " << expMul.theNumCalls
+				<< ' ' << expMul.theNumFlops << '\n';
+			oss << "got: " << gotMul.theNumCalls
+				<< ' ' << gotMul.theNumFlops << '\n';
+		}
+
+		// operations inside of exp() are not counted
+		instr::SiteCount const gotExp{ countFor(counts, "exp(BiVector)") };
+		if (! (2u == gotExp.theNumCalls))
+		{
+			oss << "Failure of exp(BiVector) count test\n";
+			oss << "exp: 2\n";
+			oss << "got: " << gotExp.theNumCalls << '\n';
+		}
+		if (! ((2u == counts.size()) && ("Spinor*Spinor" == counts[0].theName)))
+		{
+			oss << "Failure of instrumented site list test\n";
+			instr::report(oss);
+		}
+
+		return oss.str();
+	}
+
+	//! Check aggregation across threads and reset
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace g3;
+
+		instr::reset();
+
+		constexpr std::size_t numThreads{ 4u };
+		constexpr std::size_t numPer{ 1000u };
+		std::vector<std::thread> threads;
+		for (std::size_t nt{ 0u } ; nt < numThreads ; ++nt)
+		{
+			threads.emplace_back
+				( [] ()
+					{
+						Vector sum{ zero<Vector>() };
+						for (std::size_t nn{ 0u } ; nn < numPer ; ++nn)
+						{
+							sum = sum + Vector{ 1., 2., 3. };
+						}
+						(void)(-sum);
+					}
+				);
+		}
+		// calls on this thread are counted along with those of others
+		Vector const vec{ 2. * e1 };
+		(void)vec;
+		for (std::thread & thread : threads)
+		{
+			thread.join();
+		}
+
+		std::vector<instr::SiteCount> const counts{ instr::siteCounts() };
+		std::size_t const gotAdd
+			{ countFor(counts, "Vector+Vector").theNumCalls };
+		std::size_t const gotNeg{ countFor(counts, "-Vector").theNumCalls };
+		std::size_t const gotMul
+			{ countFor(counts, "double*Vector").theNumCalls };
+		if (! ( (numThreads*numPer == gotAdd)
+			  && (numThreads == gotNeg)
+			  && (1u == gotMul)
+			  )
+		   )
+		{
+			oss << "Failure of multi-thread count test\n";
+			instr::report(oss);
+		}
+
+		instr::reset();
+		if (! instr::siteCounts().empty())
+		{
+			oss << "Failure of reset test\n";
+			instr::report(oss);
+		}
+
+		return oss.str();
+	}
+
+}
+
+//! Check behavior of operation count instrumentation
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
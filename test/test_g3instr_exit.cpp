@@ -0,0 +1,105 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit test for engabra::g3::instr::reportAtExit() call order
+
+The report at exit must not use the (site) registry after destruction
+when reportAtExit() is called before any instrumented operation. (Use of
+a destroyed registry is reported by e.g. -fsanitize=address builds.)
+*/
+
+
+// Enable instrumentation for this test program
+#if ! defined(Engabra_Instrument)
+#	define Engabra_Instrument
+#endif
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3instr.hpp"
+
+#include "g3ops.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+
+	//! Check counts of operations following reportAtExit()
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace g3;
+
+		MultiVector const mvA{ 1., 2., 3., 4., 5., 6., 7., 8. };
+		MultiVector const mvB{ 8., 7., 6., 5., 4., 3., 2., 1. };
+		MultiVector const mvC{ mvA * mvB };
+		(void)mvC;
+
+		std::vector<instr::SiteCount> const counts{ instr::siteCounts() };
+		if (! ((1u == counts.size()) && (1u == counts[0].theNumCalls)))
+		{
+			oss << "Failure of count after reportAtExit() test\n";
+			instr::report(oss);
+		}
+
+		return oss.str();
+	}
+
+}
+
+//! Check reportAtExit() called before any instrumented operation
+int
+main
+	()
+{
+	// first (before registry is otherwise used)
+	engabra::g3::instr::reportAtExit();
+
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
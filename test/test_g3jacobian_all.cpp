@@ -0,0 +1,352 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3 analytic Jacobians
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3jacobian.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 64. * std::numeric_limits<double>::epsilon() };
+
+	//! Spinor as an array of components (sca, e23, e31, e12)
+	std::array<double, 4u>
+	arrayOf
+		( g3::Spinor const & spin
+		)
+	{
+		return std::array<double, 4u>
+			{ spin.theSca[0], spin.theBiv[0], spin.theBiv[1], spin.theBiv[2] };
+	}
+
+	//! Central difference Jacobian of func (returning array) w.r.t. args
+	template <std::size_t NumOut, std::size_t NumIn, typename Func>
+	std::array<double, NumOut*NumIn>
+	numericJac
+		( Func const & func
+		, std::array<double, NumIn> const & args
+		, double const & delta
+		)
+	{
+		std::array<double, NumOut*NumIn> jac;
+		for (std::size_t col{0u} ; col < NumIn ; ++col)
+		{
+			std::array<double, NumIn> argPos{ args };
+			std::array<double, NumIn> argNeg{ args };
+			argPos[col] += delta;
+			argNeg[col] -= delta;
+			std::array<double, NumOut> const valPos{ func(argPos) };
+			std::array<double, NumOut> const valNeg{ func(argNeg) };
+			for (std::size_t row{0u} ; row < NumOut ; ++row)
+			{
+				jac[NumIn*row + col]
+					= (valPos[row] - valNeg[row]) / (2. * delta);
+			}
+		}
+		return jac;
+	}
+
+	//! Max absolute difference between two same size arrays
+	template <std::size_t Size>
+	double
+	maxDiff
+		( std::array<double, Size> const & arrA
+		, std::array<double, Size> const & arrB
+		)
+	{
+		double max{ 0. };
+		for (std::size_t nn{0u} ; nn < Size ; ++nn)
+		{
+			double const dif{ std::abs(arrA[nn] - arrB[nn]) };
+			if (! (dif <= max)) // propagate NaN
+			{
+				max = dif;
+			}
+		}
+		return max;
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		BiVector const biv{ .2, -.3, .5 };
+		std::pair<Spinor, Jac4x3> const sj{ expJac(biv) };
+		Spinor const & spin = sj.first; // == exp(biv)
+		Jac4x3 const & jac = sj.second; // jac[3*row+col] == dSpin[row]/db[col]
+
+		// Jacobian of rotated vector w.r.t. bivector of rotation
+		Vector const vec{ 1., 2., 3. };
+		std::pair<Vector, Jac3x3> const rj{ rotateJac(biv, vec) };
+		// rj.first == (spin * vec * reverse(spin)).theVec
+		// [DoxyExample01]
+
+		if (! nearlyEquals(spin, exp(biv), sTol))
+		{
+			oss << "Failure of expJac() value test\n";
+			oss << "exp: " << exp(biv) << '\n';
+			oss << "got: " << spin << '\n';
+		}
+		if (! isValid(jac[0]))
+		{
+			oss << "Failure of expJac() validity test\n";
+		}
+		Vector const expRot{ (spin * vec * reverse(spin)).theVec };
+		if (! nearlyEquals(rj.first, expRot, sTol))
+		{
+			oss << "Failure of rotateJac() value test\n";
+			oss << "exp: " << expRot << '\n';
+			oss << "got: " << rj.first << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check Jacobians against finite differences (incl. small angles)
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		constexpr double delta{ 1.e-6 };
+		constexpr double tolFD{ 1.e-8 };
+
+		std::vector<BiVector> const bivs
+			{ BiVector{ .2, -.3, .5 }
+			, BiVector{ 1.1, .7, -1.3 }
+			, BiVector{ 2.e-4, -1.e-4, 3.e-4 } // series evaluation
+			, BiVector{ 2.e-9, 1.e-9, -4.e-9 }
+			, BiVector{ 0., 0., 0. }
+			};
+		Vector const vec{ -.7, 1.9, .4 };
+
+		for (BiVector const & biv : bivs)
+		{
+			std::array<double, 3u> const args{ biv.theData };
+
+			// exp()
+			auto const funcExp
+				{ [] (std::array<double, 3u> const & arg)
+					{
+						BiVector const bb{ arg[0], arg[1], arg[2] };
+						return arrayOf(exp(bb));
+					}
+				};
+			Jac4x3 const expJacExp
+				{ numericJac<4u, 3u>(funcExp, args, delta) };
+			Jac4x3 const gotJacExp{ expJac(biv).second };
+			if (! (maxDiff(gotJacExp, expJacExp) < tolFD))
+			{
+				oss << "Failure of expJac() finite difference test\n";
+				oss << "biv: " << biv << '\n';
+				oss << "maxDiff: " << maxDiff(gotJacExp, expJacExp) << '\n';
+			}
+
+			// rotation
+			auto const funcRot
+				{ [&vec] (std::array<double, 3u> const & arg)
+					{
+						BiVector const bb{ arg[0], arg[1], arg[2] };
+						Spinor const ss{ exp(bb) };
+						return (ss * vec * reverse(ss)).theVec.theData;
+					}
+				};
+			Jac3x3 const expJacRot
+				{ numericJac<3u, 3u>(funcRot, args, delta) };
+			Jac3x3 const gotJacRot{ rotateJac(biv, vec).second };
+			if (! (maxDiff(gotJacRot, expJacRot) < tolFD))
+			{
+				oss << "Failure of rotateJac() finite difference test\n";
+				oss << "biv: " << biv << '\n';
+				oss << "maxDiff: " << maxDiff(gotJacRot, expJacRot) << '\n';
+			}
+		}
+
+		// logG2() for general (non-unit) spinors
+		std::vector<Spinor> const spins
+			{ Spinor{ .7, .2, -.3, .5 }
+			, Spinor{ -1.2, .7, .4, -.3 }
+			, 2.5 * exp(BiVector{ 1.e-5, -2.e-5, 1.e-5 }) // series
+			, Spinor{ .01, 1.5, -.2, .1 }
+			};
+		for (Spinor const & spin : spins)
+		{
+			auto const funcLog
+				{ [] (std::array<double, 4u> const & arg)
+					{
+						Spinor const ss{ arg[0], arg[1], arg[2], arg[3] };
+						return arrayOf(logG2(ss));
+					}
+				};
+			Jac4x4 const expJacLog
+				{ numericJac<4u, 4u>(funcLog, arrayOf(spin), delta) };
+			std::pair<Spinor, Jac4x4> const gotLog{ logG2Jac(spin) };
+			if (! (maxDiff(gotLog.second, expJacLog) < tolFD))
+			{
+				oss << "Failure of logG2Jac() finite difference test\n";
+				oss << "spin: " << spin << '\n';
+				oss << "maxDiff: " << maxDiff(gotLog.second, expJacLog) << '\n';
+			}
+			if (! nearlyEquals(gotLog.first, logG2(spin), sTol))
+			{
+				oss << "Failure of logG2Jac() value test\n";
+			}
+		}
+
+		// half turn has no unique log bivector direction
+		if (isValid(logG2Jac(Spinor{ -1., 0., 0., 0. }).second[5]))
+		{
+			oss << "Failure of logG2Jac() half turn null test\n";
+		}
+		// within logG2() half turn cutoff (about 2e-8 rad) is also null
+		double const nearAng{ 1.e-9 };
+		Spinor const nearHalf
+			{ -std::cos(nearAng), std::sin(nearAng), 0., 0. };
+		if (isValid(logG2Jac(nearHalf).second[5]))
+		{
+			oss << "Failure of logG2Jac() near half turn null test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check batch functions agree with individual evaluations
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		constexpr std::size_t numItems{ 100u };
+		std::vector<BiVector> bivs;
+		std::vector<Spinor> spins;
+		std::vector<Vector> vecs;
+		for (std::size_t nn{0u} ; nn < numItems ; ++nn)
+		{
+			double const tt{ static_cast<double>(nn) / 37. };
+			BiVector const biv{ std::sin(tt), .5 * std::cos(3.*tt), .1 * tt };
+			bivs.emplace_back(biv);
+			spins.emplace_back((1. + tt) * exp(biv));
+			vecs.emplace_back(Vector{ tt, 1. - tt, std::cos(tt) });
+		}
+
+		std::vector<Spinor> expVals(numItems);
+		std::vector<Jac4x3> expJacs(numItems);
+		batch::expJac
+			(bivs.cbegin(), bivs.cend(), expVals.begin(), expJacs.begin());
+		std::vector<Spinor> logVals(numItems);
+		std::vector<Jac4x4> logJacs(numItems);
+		batch::logG2Jac
+			(spins.cbegin(), spins.cend(), logVals.begin(), logJacs.begin());
+		BiVector const & rotBiv = bivs[17];
+		std::vector<Vector> rotVals(numItems);
+		std::vector<Jac3x3> rotJacs(numItems);
+		batch::rotateJac
+			( rotBiv
+			, vecs.cbegin(), vecs.cend()
+			, rotVals.begin(), rotJacs.begin()
+			);
+
+		std::size_t errCount{ 0u };
+		for (std::size_t nn{0u} ; nn < numItems ; ++nn)
+		{
+			std::pair<Spinor, Jac4x3> const ej{ expJac(bivs[nn]) };
+			std::pair<Spinor, Jac4x4> const lj{ logG2Jac(spins[nn]) };
+			std::pair<Vector, Jac3x3> const rj{ rotateJac(rotBiv, vecs[nn]) };
+			if ( (! nearlyEquals(expVals[nn], ej.first, sTol))
+			  || (! (maxDiff(expJacs[nn], ej.second) < sTol))
+			  || (! nearlyEquals(logVals[nn], lj.first, sTol))
+			  || (! (maxDiff(logJacs[nn], lj.second) < sTol))
+			  || (! nearlyEquals(rotVals[nn], rj.first, sTol))
+			  || (! (maxDiff(rotJacs[nn], rj.second) < sTol))
+			   )
+			{
+				++errCount;
+			}
+		}
+		if (0u < errCount)
+		{
+			oss << "Failure of batch Jacobian test\n";
+			oss << "errCount: " << errCount << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of analytic Jacobian functions
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,290 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::lazy streams
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3lazy.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// text source (e.g. std::ifstream) with one bivector per line
+		std::istringstream istrm("0 0 .5\n# comment\n.5 0 0\n0 .25 0\n");
+		Vector const vec{ 1., 2., 3. };
+
+		// pipeline: parse -> exp -> rotate -> collect
+		// (nothing is evaluated until pulled by the collect() sink)
+		std::vector<Vector> rotVecs;
+		lazy::collect
+			( lazy::fromStream<BiVector>(istrm)
+			| lazy::map([] (BiVector const & biv) { return exp(biv); })
+			| lazy::map
+				( [&vec] (Spinor const & spin)
+					{ return (spin * vec * reverse(spin)).theVec; }
+				)
+			, std::back_inserter(rotVecs)
+			);
+		// [DoxyExample01]
+
+		if (! (3u == rotVecs.size()))
+		{
+			oss << "Failure of lazy collect size test\n";
+			oss << "exp: 3\n";
+			oss << "got: " << rotVecs.size() << '\n';
+		}
+		else
+		{
+			Spinor const spin{ exp(BiVector{ 0., .25, 0. }) };
+			Vector const expVec{ (spin * vec * reverse(spin)).theVec };
+			Vector const & gotVec = rotVecs.back();
+			if (! nearlyEquals(gotVec, expVec))
+			{
+				oss << "Failure of lazy pipeline value test\n";
+				oss << "exp: " << io::fixed(expVec) << '\n';
+				oss << "got: " << io::fixed(gotVec) << '\n';
+			}
+		}
+
+		return oss.str();
+	}
+
+	//! Check range source, filter, range-for and threaded stages
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace g3;
+
+		constexpr std::size_t numVecs{ 10000u };
+		std::vector<Vector> vecs;
+		vecs.reserve(numVecs);
+		for (std::size_t nn{ 0u } ; nn < numVecs ; ++nn)
+		{
+			double const dn{ static_cast<double>(nn) };
+			vecs.emplace_back(Vector{ 1. + dn, -.5 * dn, 2. });
+		}
+		auto const invOf
+			{ [] (Vector const & vec) { return inverse(vec); } };
+		auto const isEven
+			{ [] (Vector const & vec)
+				{ return (0 == (static_cast<int>(vec[0]) % 2)); }
+			};
+
+		// expected from direct evaluation
+		std::vector<Vector> expInvs;
+		for (Vector const & vec : vecs)
+		{
+			if (isEven(vec))
+			{
+				expInvs.emplace_back(inverse(vec));
+			}
+		}
+
+		// range-for over (single thread) pipeline
+		std::vector<Vector> gotInvs;
+		for (Vector const & inv
+			: lazy::fromRange(vecs.cbegin(), vecs.cend())
+			| lazy::filter(isEven)
+			| lazy::map(invOf)
+			)
+		{
+			gotInvs.emplace_back(inv);
+		}
+
+		// same with each stage evaluated on separate threads
+		std::vector<Vector> thdInvs;
+		std::size_t const count
+			{ lazy::forEach
+				( lazy::fromRange(vecs.cbegin(), vecs.cend())
+				| lazy::threaded(16u)
+				| lazy::filter(isEven)
+				| lazy::threaded(7u)
+				| lazy::map(invOf)
+				| lazy::threaded()
+				, [&thdInvs] (Vector const & inv) { thdInvs.emplace_back(inv); }
+				)
+			};
+
+		if (! ((expInvs == gotInvs) && (expInvs == thdInvs)))
+		{
+			oss << "Failure of lazy filter/map test\n";
+			oss << "exp.size: " << expInvs.size() << '\n';
+			oss << "got.size: " << gotInvs.size() << '\n';
+			oss << "thd.size: " << thdInvs.size() << '\n';
+		}
+		if (! (expInvs.size() == count))
+		{
+			oss << "Failure of lazy forEach count test\n";
+		}
+
+		// abandon threaded pipeline early (worker must stop cleanly)
+		{
+			auto pipe
+				{ lazy::fromRange(vecs.cbegin(), vecs.cend())
+				| lazy::map(invOf)
+				| lazy::threaded(4u)
+				};
+			Vector first{};
+			if (! (pipe.next(first) && nearlyEquals(first, inverse(vecs[0]))))
+			{
+				oss << "Failure of lazy threaded partial test\n";
+			}
+		}
+
+		// move threaded stage after worker has started
+		{
+			auto pipeA
+				{ lazy::fromRange(vecs.cbegin(), vecs.cend())
+				| lazy::threaded(4u)
+				};
+			Vector first{};
+			pipeA.next(first);
+			auto pipeB{ std::move(pipeA) };
+			std::size_t numMoved{ 1u };
+			Vector item{};
+			while (pipeB.next(item))
+			{
+				++numMoved;
+			}
+			if (! ((numVecs == numMoved) && (vecs.back() == item)))
+			{
+				oss << "Failure of lazy threaded move test\n";
+				oss << "numMoved: " << numMoved << '\n';
+			}
+		}
+
+		// exception from upstream stage (on worker thread)
+		{
+			auto const throwAt
+				{ [] (Vector const & vec)
+					{
+						if (100. == vec[0])
+						{
+							throw std::runtime_error("bad vec");
+						}
+						return vec;
+					}
+				};
+			auto pipe
+				{ lazy::fromRange(vecs.cbegin(), vecs.cend())
+				| lazy::map(throwAt)
+				| lazy::threaded(8u)
+				};
+			std::size_t numGot{ 0u };
+			bool caught{ false };
+			try
+			{
+				Vector item{};
+				while (pipe.next(item))
+				{
+					++numGot;
+				}
+			}
+			catch (std::runtime_error const &)
+			{
+				caught = true;
+			}
+			if (! (caught && (99u == numGot)))
+			{
+				oss << "Failure of lazy threaded exception test\n";
+				oss << "numGot: " << numGot << '\n';
+			}
+		}
+
+		// empty source
+		std::vector<Vector> const none;
+		std::size_t const numNone
+			{ lazy::forEach
+				( lazy::fromRange(none.cbegin(), none.cend())
+				| lazy::threaded()
+				, [] (Vector const &) { }
+				)
+			};
+		if (! (0u == numNone))
+		{
+			oss << "Failure of lazy empty source test\n";
+		}
+
+		return oss.str();
+	}
+
+}
+
+//! Check behavior of lazy stream facilities
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,332 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::io::pipeBlocks()
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3pipe.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	//! Binary stream content for entities
+	template <typename Type>
+	std::string
+	binaryFrom
+		( std::vector<Type> const & items
+		)
+	{
+		return std::string
+			( reinterpret_cast<char const *>(items.data())
+			, items.size() * sizeof(Type)
+			);
+	}
+
+	//! Entities from binary stream content
+	template <typename Type>
+	std::vector<Type>
+	itemsFrom
+		( std::string const & binary
+		)
+	{
+		std::vector<Type> items(binary.size() / sizeof(Type));
+		std::copy
+			( binary.data(), binary.data() + items.size() * sizeof(Type)
+			, reinterpret_cast<char *>(items.data())
+			);
+		return items;
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		std::vector<g3::BiVector> bivs;
+		for (std::size_t nn{ 0u } ; nn < 1000u ; ++nn)
+		{
+			double const dn{ static_cast<double>(nn) };
+			bivs.emplace_back(g3::BiVector{ .001 * dn, -.002 * dn, .5 });
+		}
+		std::istringstream istrm(binaryFrom(bivs));
+		std::ostringstream ostrm;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// binary BiVector records (istrm) to Spinor records (ostrm)
+		io::PipeParms const parms{ 64u, 3u }; // 3 buffers of 64 each
+		io::PipeResult const result
+			{ io::pipeBlocks<BiVector, Spinor>
+				( istrm
+				, ostrm
+				, [] (BiVector const * inBeg, BiVector const * inEnd
+					, Spinor * outBeg)
+					{
+						std::transform
+							( inBeg, inEnd, outBeg
+							, [] (BiVector const & biv) { return exp(biv); }
+							);
+					}
+				, parms
+				)
+			};
+		// result.theNumIn == result.theNumOut == number of records
+		// [DoxyExample01]
+
+		std::vector<Spinor> const gotSpins{ itemsFrom<Spinor>(ostrm.str()) };
+		if (! ( result.theIsOkay
+			  && (bivs.size() == result.theNumIn)
+			  && (bivs.size() == result.theNumOut)
+			  && (bivs.size() == gotSpins.size())
+			  )
+		   )
+		{
+			oss << "Failure of pipeBlocks size test\n";
+			oss << "numIn: " << result.theNumIn << '\n';
+			oss << "numOut: " << result.theNumOut << '\n';
+			oss << "gotSpins.size: " << gotSpins.size() << '\n';
+		}
+		else
+		{
+			for (std::size_t nn{ 0u } ; nn < bivs.size() ; ++nn)
+			{
+				Spinor const expSpin{ exp(bivs[nn]) };
+				if (! nearlyEquals(gotSpins[nn], expSpin))
+				{
+					oss << "Failure of pipeBlocks value test\n";
+					oss << "nn: " << nn << '\n';
+					oss << "exp: " << io::fixed(expSpin) << '\n';
+					oss << "got: " << io::fixed(gotSpins[nn]) << '\n';
+					break;
+				}
+			}
+		}
+
+		return oss.str();
+	}
+
+	//! Check block boundaries, partial records and empty input
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace g3;
+
+		auto const rotate
+			{ [] (Vector const * inBeg, Vector const * inEnd, Vector * outBeg)
+				{
+					Spinor const spin{ exp(BiVector{ 0., 0., .25 }) };
+					for (Vector const * in{ inBeg } ; inEnd != in ; ++in)
+					{
+						*outBeg++ = (spin * (*in) * reverse(spin)).theVec;
+					}
+				}
+			};
+
+		std::vector<Vector> vecs;
+		for (std::size_t nn{ 0u } ; nn < 70u ; ++nn)
+		{
+			double const dn{ static_cast<double>(nn) };
+			vecs.emplace_back(Vector{ dn, 1., -dn });
+		}
+
+		// block size not dividing count, minimum number of buffers
+		for (std::size_t const blockSize : { 1u, 7u, 70u, 1000u })
+		{
+			std::istringstream istrm(binaryFrom(vecs));
+			std::ostringstream ostrm;
+			io::PipeResult const result
+				{ io::pipeBlocks<Vector, Vector>
+					(istrm, ostrm, rotate, io::PipeParms{ blockSize, 2u })
+				};
+			std::vector<Vector> const gotVecs{ itemsFrom<Vector>(ostrm.str()) };
+			std::vector<Vector> expVecs(vecs.size());
+			rotate(vecs.data(), vecs.data() + vecs.size(), expVecs.data());
+			if (! (result.theIsOkay && (expVecs == gotVecs)))
+			{
+				oss << "Failure of pipeBlocks block size test\n";
+				oss << "blockSize: " << blockSize << '\n';
+			}
+		}
+
+		// trailing partial record
+		{
+			std::string binary{ binaryFrom(vecs) };
+			binary.append(5u, 'x');
+			std::istringstream istrm(binary);
+			std::ostringstream ostrm;
+			io::PipeResult const result
+				{ io::pipeBlocks<Vector, Vector>
+					(istrm, ostrm, rotate, io::PipeParms{ 16u, 2u })
+				};
+			if (! ( (! result.theIsOkay)
+				  && (vecs.size() == result.theNumIn)
+				  && (vecs.size() == result.theNumOut)
+				  )
+			   )
+			{
+				oss << "Failure of pipeBlocks partial record test\n";
+			}
+		}
+
+		// empty input
+		{
+			std::istringstream istrm("");
+			std::ostringstream ostrm;
+			io::PipeResult const result
+				{ io::pipeBlocks<Vector, Vector>(istrm, ostrm, rotate) };
+			if (! ( result.theIsOkay
+				  && (0u == result.theNumIn)
+				  && ostrm.str().empty()
+				  )
+			   )
+			{
+				oss << "Failure of pipeBlocks empty input test\n";
+			}
+		}
+
+		// missing file
+		{
+			io::PipeResult const result
+				{ io::pipeFiles<Vector, Vector>
+					("/no/such/file/g3pipe.bin", "/no/such/out.bin", rotate)
+				};
+			if (result.theIsOkay)
+			{
+				oss << "Failure of pipeFiles missing file test\n";
+			}
+		}
+
+		// missing input file (existing output file is left unchanged)
+		{
+			std::string const outPath{ "test_g3pipe_keep.bin" };
+			std::ofstream(outPath, std::ios::binary) << "keep";
+			io::PipeResult const result
+				{ io::pipeFiles<Vector, Vector>
+					("/no/such/file/g3pipe.bin", outPath, rotate)
+				};
+			std::ifstream ifs(outPath, std::ios::binary);
+			std::string got;
+			ifs >> got;
+			ifs.close();
+			std::remove(outPath.c_str());
+			if (result.theIsOkay || (! ("keep" == got)))
+			{
+				oss << "Failure of pipeFiles output preservation test\n";
+				oss << "got: '" << got << "'\n";
+			}
+		}
+
+		// exception from func (reader and writer threads are stopped)
+		{
+			std::vector<Vector> const manyVecs(10000u, Vector{ 1., 2., 3. });
+			std::size_t numCalls{ 0u };
+			auto const throwAt3
+				{ [&numCalls, &rotate]
+					( Vector const * inBeg
+					, Vector const * inEnd
+					, Vector * outBeg
+					)
+					{
+						if (3u == ++numCalls)
+						{
+							throw std::runtime_error("bad block");
+						}
+						rotate(inBeg, inEnd, outBeg);
+					}
+				};
+			std::istringstream istrm(binaryFrom(manyVecs));
+			std::ostringstream ostrm;
+			bool caught{ false };
+			try
+			{
+				io::pipeBlocks<Vector, Vector>
+					(istrm, ostrm, throwAt3, io::PipeParms{ 10u, 2u });
+			}
+			catch (std::runtime_error const &)
+			{
+				caught = true;
+			}
+			if (! (caught && (3u == numCalls)))
+			{
+				oss << "Failure of pipeBlocks exception test\n";
+				oss << "numCalls: " << numCalls << '\n';
+			}
+		}
+
+		return oss.str();
+	}
+
+}
+
+//! Check behavior of binary block pipeline
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,347 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::quat interop
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3quat.hpp"
+
+#include "g3batch.hpp"
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 64. * std::numeric_limits<double>::epsilon() };
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// external Hamilton quaternions, scalar last (x,y,z,w) layout
+		// e.g. quarter turn rotation about z-axis (e1 into e2)
+		double const cc{ std::cos(.5 * turnQtr) };
+		double const ss{ std::sin(.5 * turnQtr) };
+		std::vector<double> quats{ 0., 0., ss, cc,  ss, 0., 0., cc };
+
+		// convert buffer in place and use it as an array of Spinors
+		using quat::Order;
+		using quat::Sign;
+		Spinor * const spins
+			{ quat::toSpinors<Order::XYZW, Sign::Hamilton>(quats.data(), 2u) };
+		Vector const vecRot{ (spins[0] * e1 * reverse(spins[0])).theVec };
+
+		// restore the original quaternion layout
+		quat::fromSpinors<Order::XYZW, Sign::Hamilton>(spins, 2u);
+		// [DoxyExample01]
+
+		if (! nearlyEquals(vecRot, e2, sTol))
+		{
+			oss << "Failure of Hamilton rotation example test\n";
+			oss << "exp: " << e2 << '\n';
+			oss << "got: " << vecRot << '\n';
+		}
+		std::vector<double> const expQuats{ 0., 0., ss, cc,  ss, 0., 0., cc };
+		if (! (quats == expQuats))
+		{
+			oss << "Failure of in place round trip example test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check lazy views
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+		using quat::Order;
+		using quat::Sign;
+
+		Spinor const spinA{ exp(BiVector{ .3, -.7, .2 }) };
+		Spinor const spinB{ exp(BiVector{ -1.2, .4, -.3 }) };
+
+		// [DoxyExampleView]
+		// Hamilton quaternions in w,x,y,z order (not modified)
+		std::vector<double> const wxyz
+			{ spinA[0], -spinA[1], -spinA[2], -spinA[3]
+			, spinB[0], -spinB[1], -spinB[2], -spinB[3]
+			};
+		quat::View<Order::WXYZ, Sign::Hamilton> const view{ wxyz.data(), 2u };
+		Spinor const gotA{ view[0] };
+
+		// views can be used with batch functions via iterators
+		std::vector<double> mags(view.size());
+		batch::magnitude(view.begin(), view.end(), mags.begin());
+		// [DoxyExampleView]
+
+		if ( (! nearlyEquals(gotA, spinA, sTol))
+		  || (! nearlyEquals(view[1], spinB, sTol))
+		   )
+		{
+			oss << "Failure of View element test\n";
+			oss << "expA: " << spinA << '\n';
+			oss << "gotA: " << gotA << '\n';
+		}
+		if ( (! nearlyEquals(mags[0], 1., sTol))
+		  || (! nearlyEquals(mags[1], 1., sTol))
+		   )
+		{
+			oss << "Failure of View iterator test\n";
+		}
+
+		// writable view with scalar last, direct signs
+		std::vector<double> xyzw(8u, 0.);
+		quat::View<Order::XYZW, Sign::Direct, double> const viewOut
+			{ xyzw.data(), 2u };
+		viewOut.assign(0u, spinA);
+		viewOut.assign(1u, spinB);
+		std::vector<double> const expXYZW
+			{ spinA[1], spinA[2], spinA[3], spinA[0]
+			, spinB[1], spinB[2], spinB[3], spinB[0]
+			};
+		if (! (xyzw == expXYZW))
+		{
+			oss << "Failure of View assign test\n";
+		}
+		if (! nearlyEquals(viewOut[1], spinB, sTol))
+		{
+			oss << "Failure of writable View element test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check bulk in place conversions for all conventions
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+		using quat::Order;
+		using quat::Sign;
+
+		Spinor const spinA{ exp(BiVector{ .3, -.7, .2 }) };
+		Spinor const spinB{ exp(BiVector{ -1.2, .4, -.3 }) };
+		std::vector<Spinor> const expSpins{ spinA, spinB };
+
+		// Direct, scalar first: already spinor layout (no-op)
+		std::vector<double> buf
+			{ spinA[0], spinA[1], spinA[2], spinA[3]
+			, spinB[0], spinB[1], spinB[2], spinB[3]
+			};
+		std::vector<double> const orig{ buf };
+		Spinor const * const ptSame
+			{ quat::toSpinors<Order::WXYZ, Sign::Direct>(buf.data(), 2u) };
+		if ( (! (buf == orig))
+		  || (! nearlyEquals(ptSame[1], spinB))
+		   )
+		{
+			oss << "Failure of WXYZ/Direct no-op test\n";
+		}
+
+		// Hamilton, scalar first
+		std::vector<double> bufH
+			{ spinA[0], -spinA[1], -spinA[2], -spinA[3]
+			, spinB[0], -spinB[1], -spinB[2], -spinB[3]
+			};
+		std::vector<double> const origH{ bufH };
+		Spinor * const ptH
+			{ quat::toSpinors<Order::WXYZ, Sign::Hamilton>(bufH.data(), 2u) };
+		if ( (! nearlyEquals(ptH[0], spinA))
+		  || (! nearlyEquals(ptH[1], spinB))
+		   )
+		{
+			oss << "Failure of WXYZ/Hamilton toSpinors test\n";
+		}
+		quat::fromSpinors<Order::WXYZ, Sign::Hamilton>(ptH, 2u);
+		if (! (bufH == origH))
+		{
+			oss << "Failure of WXYZ/Hamilton round trip test\n";
+		}
+
+		// Direct, scalar last
+		std::vector<double> bufL
+			{ spinA[1], spinA[2], spinA[3], spinA[0]
+			, spinB[1], spinB[2], spinB[3], spinB[0]
+			};
+		std::vector<double> const origL{ bufL };
+		Spinor * const ptL
+			{ quat::toSpinors<Order::XYZW, Sign::Direct>(bufL.data(), 2u) };
+		if ( (! nearlyEquals(ptL[0], spinA))
+		  || (! nearlyEquals(ptL[1], spinB))
+		   )
+		{
+			oss << "Failure of XYZW/Direct toSpinors test\n";
+		}
+		quat::fromSpinors<Order::XYZW, Sign::Direct>(ptL, 2u);
+		if (! (bufL == origL))
+		{
+			oss << "Failure of XYZW/Direct round trip test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check View iterator random access operations
+	std::string
+	test3
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+		using quat::Order;
+		using quat::Sign;
+
+		std::vector<Spinor> expSpins;
+		std::vector<double> wxyz;
+		for (std::size_t nn{0u} ; nn < 5u ; ++nn)
+		{
+			double const ang{ .25 * static_cast<double>(nn + 1u) };
+			Spinor const spin{ exp(BiVector{ ang, -.5*ang, .2 }) };
+			expSpins.emplace_back(spin);
+			wxyz.insert(wxyz.end(), { spin[0], spin[1], spin[2], spin[3] });
+		}
+		using ViewType = quat::View<Order::WXYZ, Sign::Direct>;
+		ViewType const view{ wxyz.data(), expSpins.size() };
+		using Iter = ViewType::const_iterator;
+		Iter const itBeg{ view.begin() };
+		Iter const itEnd{ view.end() };
+
+		Iter const itLast{ std::prev(itEnd) };
+		if (! nearlyEquals(*itLast, expSpins.back()))
+		{
+			oss << "Failure of std::prev() View iterator test\n";
+		}
+
+		Iter itFwd{ itBeg };
+		std::advance(itFwd, 3);
+		Iter itBack{ itEnd };
+		std::advance(itBack, -2);
+		if ( (! (itFwd == itBack))
+		  || (! nearlyEquals(*itFwd, expSpins[3]))
+		   )
+		{
+			oss << "Failure of std::advance() View iterator test\n";
+		}
+
+		Iter itOps{ itBeg };
+		itOps += 4;
+		itOps -= 1;
+		--itOps;
+		Iter const itPost{ itOps-- };
+		if ( (! nearlyEquals(*itOps, expSpins[1]))
+		  || (! nearlyEquals(*itPost, expSpins[2]))
+		  || (! ((2 + itBeg) == itPost))
+		  || (! ((itEnd - 3) == itPost))
+		  || (! nearlyEquals(itBeg[4], expSpins[4]))
+		   )
+		{
+			oss << "Failure of View iterator arithmetic test\n";
+		}
+
+		if ( (! (itBeg < itEnd))
+		  || (! (itEnd > itBeg))
+		  || (! (itBeg <= itBeg))
+		  || (! (itEnd >= itLast))
+		  || (itEnd < itBeg)
+		  || (5 != std::distance(itBeg, itEnd))
+		   )
+		{
+			oss << "Failure of View iterator comparison test\n";
+		}
+
+		// reverse traversal via std::reverse_iterator
+		std::vector<Spinor> const gotRev
+			{ std::make_reverse_iterator(itEnd)
+			, std::make_reverse_iterator(itBeg)
+			};
+		if (! ( (expSpins.size() == gotRev.size())
+			 && nearlyEquals(gotRev.front(), expSpins.back())
+			 && nearlyEquals(gotRev.back(), expSpins.front())
+			  ))
+		{
+			oss << "Failure of View reverse iterator test\n";
+		}
+
+		return oss.str();
+	}
+
+}
+
+//! Check behavior of quaternion interoperation
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+	oss << test3();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
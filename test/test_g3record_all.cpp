@@ -0,0 +1,269 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::io record streams
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3record.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// write records: time, location, attitude
+		std::ostringstream ostrm;
+		io::RecordWriter<double, Vector, Spinor> writer(ostrm, ';');
+		writer.write(.5, Vector{ 1., 2., 3. }, exp(BiVector{ .1, .2, .3 }));
+		writer.write(1.5, Vector{ 4., 5., 6. }, exp(BiVector{ .4, .5, .6 }));
+		// ostrm.str() has lines like "0.5;1;2;3;0.93...;0.09...;..."
+
+		// read records
+		std::istringstream istrm(ostrm.str());
+		io::RecordReader<double, Vector, Spinor> reader(istrm, ';');
+		std::vector<Vector> locs;
+		while (reader.next())
+		{
+			locs.emplace_back(std::get<1>(reader.theRecord));
+		}
+		// [DoxyExample01]
+
+		std::vector<Vector> const expLocs
+			{ Vector{ 1., 2., 3. }, Vector{ 4., 5., 6. } };
+		if ( (! (expLocs.size() == locs.size()))
+		  || (! nearlyEquals(expLocs[0], locs[0]))
+		  || (! nearlyEquals(expLocs[1], locs[1]))
+		  || (! reader.theIsOkay)
+		   )
+		{
+			oss << "Failure of record example test\n";
+			oss << ostrm.str() << '\n';
+		}
+
+		// round trip is exact (shortest round-trip formatting)
+		std::istringstream istrm2(ostrm.str());
+		io::RecordReader<double, Vector, Spinor> reader2(istrm2, ';');
+		reader2.next();
+		Spinor const expSpin{ exp(BiVector{ .1, .2, .3 }) };
+		Spinor const & gotSpin = std::get<2>(reader2.theRecord);
+		if (! (magnitude(gotSpin - expSpin) == 0.))
+		{
+			oss << "Failure of exact round trip test\n";
+			oss << "exp: " << io::enote(expSpin) << '\n';
+			oss << "got: " << io::enote(gotSpin) << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check delimiters, comments, and bad fields
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		// whitespace delimited (with runs of spaces and tabs)
+		std::istringstream istrmA
+			( "# header\n"
+			  "  1.5   1 2\t\t3 \n"
+			  "\n"
+			  "2.5 4 x 6\n"
+			  "3.5 7 8 9 10\n"
+			);
+		io::RecordReader<double, Vector> readerA(istrmA, ' ');
+		std::vector<bool> gotOkays;
+		std::vector<bool> gotValids;
+		std::vector<std::size_t> gotLines;
+		while (readerA.next())
+		{
+			gotOkays.emplace_back(readerA.theIsOkay);
+			gotValids.emplace_back(isValid(std::get<1>(readerA.theRecord)));
+			gotLines.emplace_back(readerA.theLineNum);
+		}
+		std::vector<bool> const expOkays{ true, false, false };
+		std::vector<bool> const expValids{ true, false, true };
+		std::vector<std::size_t> const expLines{ 2u, 4u, 5u };
+		if ( (! (expOkays == gotOkays))
+		  || (! (expValids == gotValids))
+		  || (! (expLines == gotLines))
+		   )
+		{
+			oss << "Failure of whitespace delimited test\n";
+		}
+
+		// comma delimited with spaces, empty field and MultiVector column
+		std::istringstream istrmB
+			( "7, 1,2,3,4,5,6,7,8\n"
+			  "8, 1,2,,4,5,6,7,8\n"
+			  "9 , 1 , 2 , 3 , 4 , 5 , 6 , 7 , 8 \r\n"
+			);
+		io::RecordReader<double, MultiVector> readerB(istrmB);
+		std::size_t numRec{ 0u };
+		std::size_t numOkay{ 0u };
+		MultiVector const expMV{ 1., 2., 3., 4., 5., 6., 7., 8. };
+		while (readerB.next())
+		{
+			++numRec;
+			MultiVector const & gotMV = std::get<1>(readerB.theRecord);
+			if (readerB.theIsOkay && nearlyEquals(gotMV, expMV))
+			{
+				++numOkay;
+			}
+		}
+		if ((! (3u == numRec)) || (! (2u == numOkay)))
+		{
+			oss << "Failure of comma delimited test\n";
+			oss << "numRec: " << numRec << '\n';
+			oss << "numOkay: " << numOkay << '\n';
+		}
+
+		// trailing delimiter (i.e. an empty extra field)
+		std::istringstream istrmC("1,2,3\n1,2,3,\n1,2,3 , \n");
+		io::RecordReader<Vector> readerC(istrmC);
+		std::vector<bool> gotOkaysC;
+		while (readerC.next())
+		{
+			gotOkaysC.emplace_back(readerC.theIsOkay);
+		}
+		std::vector<bool> const expOkaysC{ true, false, false };
+		if (! (expOkaysC == gotOkaysC))
+		{
+			oss << "Failure of trailing delimiter test\n";
+		}
+
+		// malformed last field (junk without following delimiter)
+		std::istringstream istrmD("1,2,3x\n1,2,3,4x\n1,2,3,4\n");
+		io::RecordReader<Vector, double> readerD(istrmD);
+		std::vector<bool> gotOkaysD;
+		while (readerD.next())
+		{
+			gotOkaysD.emplace_back(readerD.theIsOkay);
+		}
+		std::vector<bool> const expOkaysD{ false, false, true };
+		if (! (expOkaysD == gotOkaysD))
+		{
+			oss << "Failure of malformed last field test\n";
+		}
+
+		// buffer too small for formatted values
+		std::array<char, 8u> small{};
+		char * const gotEnd
+			{ io::priv::formatItem
+				( small.data(), small.data() + small.size()
+				, ',', Vector{ 1./3., 2./3., 1. }
+				)
+			};
+		if (gotEnd)
+		{
+			oss << "Failure of small buffer format test\n";
+		}
+
+		// tuple write of many records, then reread
+		std::stringstream strm;
+		io::RecordWriter<double, Spinor> writer(strm, '\t');
+		constexpr std::size_t numRecs{ 1000u };
+		for (std::size_t nn{0u} ; nn < numRecs ; ++nn)
+		{
+			double const tt{ .001 * static_cast<double>(nn) };
+			writer.write(std::make_tuple(tt, exp(BiVector{ tt, -tt, 1. })));
+		}
+		io::RecordReader<double, Spinor> reader(strm, '\t');
+		std::size_t errCount{ 0u };
+		std::size_t numGot{ 0u };
+		while (reader.next())
+		{
+			double const tt{ .001 * static_cast<double>(numGot) };
+			Spinor const expSpin{ exp(BiVector{ tt, -tt, 1. }) };
+			if ( (! reader.theIsOkay)
+			  || (! (std::get<0>(reader.theRecord) == tt))
+			  || (! (magnitude(std::get<1>(reader.theRecord) - expSpin) == 0.))
+			   )
+			{
+				++errCount;
+			}
+			++numGot;
+		}
+		if ((0u < errCount) || (! (numRecs == numGot)))
+		{
+			oss << "Failure of tuple write/read test\n";
+			oss << "errCount: " << errCount << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of record reader/writer
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,288 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::Rigid
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3rigid.hpp"
+
+#include "g3compare.hpp"
+#include "g3io.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 64. * std::numeric_limits<double>::epsilon() };
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// rotate a quarter turn in e12 plane and then shift along e3
+		Rigid const xfm{ exp(-.5 * turnQtr * e12), Vector{ 0., 0., 7. } };
+		Vector const pnt{ 1., 0., 0. };
+		Vector const got{ xfm(pnt) }; // == {0., 1., 7.}
+
+		// inverse transformation and composition
+		Rigid const inv{ inverse(xfm) };
+		Rigid const ident{ inv * xfm }; // == Rigid::identity()
+		// [DoxyExample01]
+
+		Vector const exp{ 0., 1., 7. };
+		if (! nearlyEquals(got, exp, sTol))
+		{
+			oss << "Failure of Rigid xform example test\n";
+			oss << "exp: " << exp << '\n';
+			oss << "got: " << got << '\n';
+		}
+		if (! nearlyEquals(ident, Rigid::identity(), sTol))
+		{
+			oss << "Failure of Rigid inverse example test\n";
+			oss << "got.theSpin: " << ident.theSpin << '\n';
+			oss << "got.theTran: " << ident.theTran << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check consistency with sandwich product and composition rules
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		Rigid const xfmA{ exp(BiVector{ .3, -.7, .2 }), Vector{ 1., 2., 3. } };
+		Rigid const xfmB{ exp(BiVector{ -.9, .1, .4 }), Vector{ -5., .5, 2. } };
+		Vector const vec{ .7, -1.1, 2.3 };
+
+		// agreement with the explicit sandwich product
+		Spinor const & spin = xfmA.theSpin;
+		ImSpin const imsp{ spin * vec * reverse(spin) };
+		Vector const expA{ imsp.theVec + xfmA.theTran };
+		Vector const gotA{ xfmA(vec) };
+		if (! nearlyEquals(gotA, expA, sTol))
+		{
+			oss << "Failure of sandwich product test\n";
+			oss << "expA: " << expA << '\n';
+			oss << "gotA: " << gotA << '\n';
+		}
+
+		// composition order
+		Vector const expAB{ xfmA(xfmB(vec)) };
+		Vector const gotAB{ (xfmA * xfmB)(vec) };
+		if (! nearlyEquals(gotAB, expAB, sTol))
+		{
+			oss << "Failure of composition test\n";
+			oss << "expAB: " << expAB << '\n';
+			oss << "gotAB: " << gotAB << '\n';
+		}
+
+		// inverse on both sides
+		Vector const gotInv{ inverse(xfmA)(xfmA(vec)) };
+		Vector const gotRev{ xfmA(inverse(xfmA)(vec)) };
+		if ( (! nearlyEquals(gotInv, vec, sTol))
+		  || (! nearlyEquals(gotRev, vec, sTol))
+		   )
+		{
+			oss << "Failure of inverse test\n";
+			oss << "gotInv: " << gotInv << '\n';
+			oss << "gotRev: " << gotRev << '\n';
+		}
+
+		// null propagation
+		if (isValid(null<Rigid>()) || isValid(null<Rigid>() * xfmA))
+		{
+			oss << "Failure of null Rigid test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check interpolation
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		Rigid const xfmA{ exp(BiVector{ .3, -.7, .2 }), Vector{ 1., 2., 3. } };
+		Rigid const xfmB{ exp(BiVector{ -.9, .1, .4 }), Vector{ -5., .5, 2. } };
+
+		// end points
+		if ( (! nearlyEquals(interpolated(xfmA, xfmB, 0.), xfmA, sTol))
+		  || (! nearlyEquals(interpolated(xfmA, xfmB, 1.), xfmB, sTol))
+		   )
+		{
+			oss << "Failure of interpolated() end point test\n";
+		}
+
+		// mid point is half of relative rotation and translation
+		Rigid const gotMid{ interpolated(xfmA, xfmB, .5) };
+		Spinor const spinRel{ xfmB.theSpin * reverse(xfmA.theSpin) };
+		Spinor const expSpin{ sqrtG2(spinRel) * xfmA.theSpin };
+		Vector const expTran{ .5 * (xfmA.theTran + xfmB.theTran) };
+		if ( (! nearlyEquals(gotMid.theSpin, expSpin, sTol))
+		  || (! nearlyEquals(gotMid.theTran, expTran, sTol))
+		   )
+		{
+			oss << "Failure of interpolated() mid point test\n";
+			oss << "expSpin: " << expSpin << '\n';
+			oss << "gotSpin: " << gotMid.theSpin << '\n';
+		}
+
+		// shorter arc is used for sign-flipped end spinor
+		Rigid const xfmNeg{ -xfmB.theSpin, xfmB.theTran };
+		Rigid const gotNeg{ interpolated(xfmA, xfmNeg, .5) };
+		if (! nearlyEquals(gotNeg.theSpin, expSpin, sTol))
+		{
+			oss << "Failure of interpolated() shorter arc test\n";
+			oss << "expSpin: " << expSpin << '\n';
+			oss << "gotSpin: " << gotNeg.theSpin << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check batch application
+	std::string
+	test3
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		Rigid const xfm{ exp(BiVector{ .3, -.7, .2 }), Vector{ 1., 2., 3. } };
+
+		// generate enough points for several threads
+		std::size_t const numPnts{ 4u * priv::sMinItemsPerThread + 17u };
+		std::vector<Vector> pnts;
+		pnts.reserve(numPnts);
+		for (std::size_t nn{0u} ; nn < numPnts ; ++nn)
+		{
+			double const dd{ static_cast<double>(nn) };
+			pnts.emplace_back(Vector{ .001 * dd, 1. - .002 * dd, .5 });
+		}
+
+		// [DoxyExampleBatch]
+		std::vector<Vector> outs(pnts.size());
+		constexpr std::size_t numThreads{ 4u };
+		batch::apply(xfm, pnts.cbegin(), pnts.cend(), outs.begin(), numThreads);
+		// [DoxyExampleBatch]
+
+		std::vector<Vector> outSerial(pnts.size());
+		batch::apply(xfm, pnts.cbegin(), pnts.cend(), outSerial.begin());
+
+		// structure of arrays (in place)
+		std::vector<double> xs(numPnts);
+		std::vector<double> ys(numPnts);
+		std::vector<double> zs(numPnts);
+		for (std::size_t nn{0u} ; nn < numPnts ; ++nn)
+		{
+			xs[nn] = pnts[nn][0];
+			ys[nn] = pnts[nn][1];
+			zs[nn] = pnts[nn][2];
+		}
+		batch::apply
+			( xfm
+			, numPnts
+			, { xs.data(), ys.data(), zs.data() }
+			, { xs.data(), ys.data(), zs.data() }
+			, numThreads
+			);
+
+		std::size_t errCount{ 0u };
+		for (std::size_t nn{0u} ; nn < numPnts ; ++nn)
+		{
+			Vector const exp{ xfm(pnts[nn]) };
+			Vector const gotSoA{ xs[nn], ys[nn], zs[nn] };
+			if ( (! nearlyEquals(outs[nn], exp))
+			  || (! nearlyEquals(outSerial[nn], exp))
+			  || (! nearlyEquals(gotSoA, exp))
+			   )
+			{
+				++errCount;
+			}
+		}
+		if (0u < errCount)
+		{
+			oss << "Failure of batch::apply() test\n";
+			oss << "errCount: " << errCount << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of Rigid transformations
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+	oss << test3();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
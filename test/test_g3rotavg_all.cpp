@@ -0,0 +1,265 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3 rotation averaging
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3rotavg.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 1024. * std::numeric_limits<double>::epsilon() };
+
+	//! True if spinors represent the same rotation (either sign)
+	bool
+	sameRotation
+		( g3::Spinor const & gotSpin
+		, g3::Spinor const & expSpin
+		, double const & tol
+		)
+	{
+		double const difPos{ g3::magnitude(gotSpin - expSpin) };
+		double const difNeg{ g3::magnitude(gotSpin + expSpin) };
+		return (std::min(difPos, difNeg) < tol);
+	}
+
+	//! Spinors symmetrically perturbed about spinCenter
+	std::vector<g3::Spinor>
+	spinsAbout
+		( g3::Spinor const & spinCenter
+		, std::size_t const & numPairs
+		)
+	{
+		std::vector<g3::Spinor> spins;
+		spins.reserve(2u * numPairs);
+		for (std::size_t nn{0u} ; nn < numPairs ; ++nn)
+		{
+			double const dd{ static_cast<double>(nn) };
+			g3::BiVector const biv
+				{ .1 * std::sin(1.1*dd), .1 * std::cos(.7*dd), .05 };
+			spins.emplace_back(g3::exp( biv) * spinCenter);
+			spins.emplace_back(g3::exp(-biv) * spinCenter);
+		}
+		return spins;
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+		Spinor const expSpin{ exp(BiVector{ .3, -.7, .2 }) };
+
+		// [DoxyExample01]
+		// attitude estimates (with arbitrary signs)
+		std::vector<Spinor> const spins
+			{ exp(.1 * e12) * expSpin
+			, -(exp(-.1 * e12) * expSpin)
+			, exp(.2 * e23) * expSpin
+			, exp(-.2 * e23) * expSpin
+			};
+		Spinor const spinChord{ chordalMean(spins.cbegin(), spins.cend()) };
+		SpinMean const geoMean{ geodesicMean(spins.cbegin(), spins.cend()) };
+		Spinor const & spinGeo = geoMean.theSpin;
+		// [DoxyExample01]
+
+		if ( (! sameRotation(spinChord, expSpin, sTol))
+		  || (! sameRotation(spinGeo, expSpin, sTol))
+		  || (! geoMean.theConverged)
+		   )
+		{
+			oss << "Failure of mean example test\n";
+			oss << "expSpin: " << expSpin << '\n';
+			oss << "spinChord: " << spinChord << '\n';
+			oss << "spinGeo: " << spinGeo << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check mean properties
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		// two rotations in the same plane: mean is half way between
+		Spinor const spinA{ exp(.3 * e31) };
+		Spinor const spinB{ exp(.9 * e31) };
+		std::vector<Spinor> const pair{ spinA, -spinB };
+		Spinor const expMid{ exp(.6 * e31) };
+		Spinor const gotChord{ chordalMean(pair.cbegin(), pair.cend()) };
+		SpinMean const gotGeo{ geodesicMean(pair.cbegin(), pair.cend()) };
+		if ( (! sameRotation(gotChord, expMid, sTol))
+		  || (! sameRotation(gotGeo.theSpin, expMid, sTol))
+		   )
+		{
+			oss << "Failure of two spinor midpoint test\n";
+		}
+
+		// weighted: geodesic mean divides the arc by weight ratio
+		std::vector<double> const wgts{ 3., 1. };
+		Spinor const expWgt{ exp(.45 * e31) };
+		SpinMean const gotWgt
+			{ geodesicMean(pair.cbegin(), pair.cend(), wgts.cbegin(), {}) };
+		if (! sameRotation(gotWgt.theSpin, expWgt, sTol))
+		{
+			oss << "Failure of weighted geodesic mean test\n";
+			oss << "expWgt: " << expWgt << '\n';
+			oss << "gotWgt: " << gotWgt.theSpin << '\n';
+		}
+		// rms angle: full angles 2*.15 and 2*.45 weighted 3 and 1
+		double const expRms{ std::sqrt((3.*.09 + .81) / 4.) };
+		if (! nearlyEquals(gotWgt.theRmsAngle, expRms, 1.e-12))
+		{
+			oss << "Failure of weighted rms angle test\n";
+			oss << "expRms: " << expRms << '\n';
+			oss << "gotRms: " << gotWgt.theRmsAngle << '\n';
+		}
+
+		// zero weight excludes item
+		std::vector<double> const wgtsZero{ 1., 0. };
+		Spinor const gotZero
+			{ chordalMean(pair.cbegin(), pair.cend(), wgtsZero.cbegin(), {}) };
+		if (! sameRotation(gotZero, spinA, sTol))
+		{
+			oss << "Failure of zero weight chordal mean test\n";
+		}
+
+		// empty range
+		std::vector<Spinor> const none{};
+		if ( isValid(chordalMean(none.cbegin(), none.cend()))
+		  || isValid(geodesicMean(none.cbegin(), none.cend()).theSpin)
+		   )
+		{
+			oss << "Failure of empty range test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check large (concurrent) averages
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		Spinor const expSpin{ exp(BiVector{ -1.2, .4, -.3 }) };
+		std::size_t const numPairs{ 2u * priv::sMinItemsPerThread + 7u };
+		std::vector<Spinor> spins{ spinsAbout(expSpin, numPairs) };
+		// flip signs of some to exercise double cover handling
+		for (std::size_t nn{0u} ; nn < spins.size() ; nn += 3u)
+		{
+			spins[nn] = -spins[nn];
+		}
+
+		AvgControl ctl;
+		ctl.theNumThreads = 4u;
+		Spinor const gotChord{ chordalMean(spins.cbegin(), spins.cend(), ctl) };
+		SpinMean const gotGeo
+			{ geodesicMean(spins.cbegin(), spins.cend(), ctl) };
+
+		ctl.theNumThreads = 1u;
+		SpinMean const gotOne
+			{ geodesicMean(spins.cbegin(), spins.cend(), ctl) };
+
+		constexpr double tolMean{ 1.e-12 };
+		if ( (! sameRotation(gotChord, expSpin, tolMean))
+		  || (! sameRotation(gotGeo.theSpin, expSpin, tolMean))
+		  || (! sameRotation(gotOne.theSpin, gotGeo.theSpin, tolMean))
+		   )
+		{
+			oss << "Failure of concurrent mean test\n";
+			oss << "expSpin: " << expSpin << '\n';
+			oss << "gotChord: " << gotChord << '\n';
+			oss << "gotGeo: " << gotGeo.theSpin << '\n';
+			oss << "gotOne: " << gotOne.theSpin << '\n';
+		}
+		if ( (! gotGeo.theConverged)
+		  || (! (gotGeo.theNumIter < 5u))
+		   )
+		{
+			oss << "Failure of convergence test\n";
+			oss << "numIter: " << gotGeo.theNumIter << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of spinor averaging functions
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,298 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::RotFitter
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3rotfit.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+#include "g3rigid.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 1024. * std::numeric_limits<double>::epsilon() };
+
+	//! True if spinors represent the same rotation (either sign)
+	bool
+	sameRotation
+		( g3::Spinor const & gotSpin
+		, g3::Spinor const & expSpin
+		, double const & tol
+		)
+	{
+		double const difPos{ g3::magnitude(gotSpin - expSpin) };
+		double const difNeg{ g3::magnitude(gotSpin + expSpin) };
+		return (std::min(difPos, difNeg) < tol);
+	}
+
+	//! Deterministic pseudo-random (but well spread) vectors
+	std::vector<g3::Vector>
+	someVectors
+		( std::size_t const & numVecs
+		)
+	{
+		std::vector<g3::Vector> vecs;
+		vecs.reserve(numVecs);
+		for (std::size_t nn{0u} ; nn < numVecs ; ++nn)
+		{
+			double const dd{ static_cast<double>(nn) };
+			vecs.emplace_back
+				(g3::Vector
+					{ std::sin(1.1*dd), std::cos(.7*dd), std::sin(.3*dd + 1.) }
+				);
+		}
+		return vecs;
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+		Spinor const expSpin{ exp(BiVector{ .3, -.7, .2 }) };
+		std::vector<Vector> const vecFroms{ e1, e2, e3, Vector{ 1., 1., 1. } };
+		std::vector<Vector> vecIntos;
+		for (Vector const & vecFrom : vecFroms)
+		{
+			ImSpin const imsp{ expSpin * vecFrom * reverse(expSpin) };
+			vecIntos.emplace_back(imsp.theVec);
+		}
+
+		// [DoxyExample01]
+		RotFitter fitter;
+		for (std::size_t nn{0u} ; nn < vecFroms.size() ; ++nn)
+		{
+			fitter.add(vecFroms[nn], vecIntos[nn]);
+		}
+		RotFit const fit{ fitter.solution() };
+		Spinor const & gotSpin = fit.theSpin; // best fit rotation
+		double const & rmsRes = fit.theRmsRes; // (near zero here)
+		// [DoxyExample01]
+
+		if (! sameRotation(gotSpin, expSpin, sTol))
+		{
+			oss << "Failure of RotFitter example test\n";
+			oss << "expSpin: " << expSpin << '\n';
+			oss << "gotSpin: " << gotSpin << '\n';
+		}
+		if (! (rmsRes < 1.e-7))
+		{
+			oss << "Failure of RotFitter example residual test\n";
+			oss << "rmsRes: " << rmsRes << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check residuals with noise and several orientations
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		std::vector<Spinor> const expSpins
+			{ one<Spinor>()
+			, exp(BiVector{ -1.2, .4, -.3 })
+			, Spinor{ 0., e31 } // half turn
+			, direction(Spinor{ 1.e-6, BiVector{ 1., -2., 2. } })
+			};
+		std::vector<Vector> const vecFroms{ someVectors(100u) };
+
+		for (Spinor const & expSpin : expSpins)
+		{
+			RotFitter fitter;
+			std::vector<Vector> vecIntos;
+			for (std::size_t nn{0u} ; nn < vecFroms.size() ; ++nn)
+			{
+				double const dd{ static_cast<double>(nn) };
+				Vector const noise
+					{ 1.e-3 * std::sin(5.*dd), 0., 1.e-3 * std::cos(3.*dd) };
+				ImSpin const imsp{ expSpin * vecFroms[nn] * reverse(expSpin) };
+				Vector const vecInto{ imsp.theVec + noise };
+				fitter.add(vecFroms[nn], vecInto, 2.);
+				vecIntos.emplace_back(vecInto);
+			}
+			RotFit const fit{ fitter.solution() };
+
+			// direct evaluation of weighted residual sum for fit spinor
+			Rigid const xfm{ fit.theSpin, zero<Vector>() };
+			double expSumSq{ 0. };
+			for (std::size_t nn{0u} ; nn < vecFroms.size() ; ++nn)
+			{
+				expSumSq += 2. * magSq(vecIntos[nn] - xfm(vecFroms[nn]));
+			}
+
+			if (! sameRotation(fit.theSpin, expSpin, 1.e-3))
+			{
+				oss << "Failure of noisy fit rotation test\n";
+				oss << "expSpin: " << expSpin << '\n';
+				oss << "gotSpin: " << fit.theSpin << '\n';
+			}
+			if (! nearlyEquals(fit.theSumSqRes, expSumSq, 1.e-6))
+			{
+				oss << "Failure of noisy fit residual test\n";
+				oss << "expSumSq: " << expSumSq << '\n';
+				oss << "gotSumSq: " << fit.theSumSqRes << '\n';
+			}
+			if (! (fit.theSpin.theSca[0] >= 0.))
+			{
+				oss << "Failure of fit spinor sign test\n";
+			}
+		}
+
+		// no data
+		if (isValid(RotFitter{}.solution().theSpin))
+		{
+			oss << "Failure of empty RotFitter test\n";
+		}
+
+		// degenerate geometry (all parallel) is indicated by small gap
+		RotFitter fitLine;
+		fitLine.add(e1, e2);
+		fitLine.add(2. * e1, 2. * e2);
+		RotFit const fitDeg{ fitLine.solution() };
+		if (! (std::abs(fitDeg.theGap) < sTol))
+		{
+			oss << "Failure of degenerate gap test\n";
+			oss << "theGap: " << fitDeg.theGap << '\n';
+		}
+		Vector const gotInto{ Rigid{ fitDeg.theSpin, zero<Vector>() }(e1) };
+		if (! nearlyEquals(gotInto, e2, sTol))
+		{
+			oss << "Failure of degenerate fit test\n";
+			oss << "gotInto: " << gotInto << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check merge and concurrent accumulation
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		Spinor const expSpin{ exp(BiVector{ .3, -.7, .2 }) };
+		std::size_t const numVecs{ 4u * priv::sMinItemsPerThread + 3u };
+		std::vector<Vector> const vecFroms{ someVectors(numVecs) };
+		std::vector<Vector> vecIntos(numVecs);
+		Rigid const xfm{ expSpin, zero<Vector>() };
+		batch::apply(xfm, vecFroms.cbegin(), vecFroms.cend(), vecIntos.begin());
+
+		RotFitter fitAll;
+		fitAll.add(vecFroms.cbegin(), vecFroms.cend(), vecIntos.cbegin());
+
+		std::size_t const half{ numVecs / 2u };
+		RotFitter fitA;
+		fitA.add
+			(vecFroms.cbegin(), vecFroms.cbegin() + half, vecIntos.cbegin());
+		RotFitter fitB;
+		fitB.add
+			( vecFroms.cbegin() + half, vecFroms.cend()
+			, vecIntos.cbegin() + half
+			);
+		fitA.merge(fitB);
+
+		RotFitter const fitPar
+			{ batch::rotFitterFor
+				(vecFroms.cbegin(), vecFroms.cend(), vecIntos.cbegin(), 4u)
+			};
+
+		if ( (fitAll.theCount != numVecs)
+		  || (fitA.theCount != numVecs)
+		  || (fitPar.theCount != numVecs)
+		   )
+		{
+			oss << "Failure of accumulation count test\n";
+		}
+		if ( (! sameRotation(fitAll.solution().theSpin, expSpin, sTol))
+		  || (! sameRotation(fitA.solution().theSpin, expSpin, sTol))
+		  || (! sameRotation(fitPar.solution().theSpin, expSpin, sTol))
+		   )
+		{
+			oss << "Failure of merged/concurrent fit test\n";
+			oss << "expSpin: " << expSpin << '\n';
+			oss << "gotAll: " << fitAll.solution().theSpin << '\n';
+			oss << "gotA: " << fitA.solution().theSpin << '\n';
+			oss << "gotPar: " << fitPar.solution().theSpin << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of best fit rotation estimation
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
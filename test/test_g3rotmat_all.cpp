@@ -0,0 +1,298 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3 RotMatrix conversions
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3rotmat.hpp"
+
+#include "g3compare.hpp"
+#include "g3io.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 64. * std::numeric_limits<double>::epsilon() };
+
+	//! Matrix-vector product (for test comparisons)
+	g3::Vector
+	matTimes
+		( g3::RotMatrix const & mat
+		, g3::Vector const & vec
+		)
+	{
+		return g3::Vector
+			{ mat[0]*vec[0] + mat[1]*vec[1] + mat[2]*vec[2]
+			, mat[3]*vec[0] + mat[4]*vec[1] + mat[5]*vec[2]
+			, mat[6]*vec[0] + mat[7]*vec[1] + mat[8]*vec[2]
+			};
+	}
+
+	/*! \brief True if spinors represent the same rotation.
+	 *
+	 * Requires non-negative scalar grade for gotSpin and accepts either
+	 * sign of expSpin (both signs are valid for half turn rotations).
+	 */
+	bool
+	sameRotation
+		( g3::Spinor const & gotSpin
+		, g3::Spinor const & expSpin
+		, double const & tol
+		)
+	{
+		g3::Spinor const expUnit{ g3::direction(expSpin) };
+		double const difPos{ g3::magnitude(gotSpin - expUnit) };
+		double const difNeg{ g3::magnitude(gotSpin + expUnit) };
+		return
+			{  (! (gotSpin.theSca[0] < 0.))
+			&& (std::min(difPos, difNeg) < tol)
+			};
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		Spinor const spin{ exp(BiVector{ .3, -.7, .2 }) };
+		RotMatrix const mat{ matrixFrom(spin) };
+		Spinor const spinBack{ spinorFrom(mat) };
+		// [DoxyExample01]
+
+		if (! nearlyEquals(spinBack, spin, sTol))
+		{
+			oss << "Failure of spinorFrom(matrixFrom()) example test\n";
+			oss << "exp: " << spin << '\n';
+			oss << "got: " << spinBack << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check consistency with sandwich and round trips (all branches)
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		Vector const vec{ .7, -1.1, 2.3 };
+
+		// includes half turns about each axis (exercise Shepperd branches)
+		std::vector<Spinor> const spins
+			{ one<Spinor>()
+			, exp(BiVector{ .3, -.7, .2 })
+			, exp(BiVector{ -1.2, .4, -.3 })
+			, Spinor{ 0., e23 }
+			, Spinor{ 0., e31 }
+			, Spinor{ 0., e12 }
+			, Spinor{ 1.e-9, direction(BiVector{ 1., 2., 3. }) }
+			, Spinor{ -.3, BiVector{ 1.5, -.2, .9 } } // non-unitary
+			};
+
+		for (Spinor const & spin : spins)
+		{
+			RotMatrix const mat{ matrixFrom(spin) };
+
+			// agreement with sandwich product of normalized spinor
+			Spinor const unit{ direction(spin) };
+			Vector const expVec{ (unit * vec * reverse(unit)).theVec };
+			Vector const gotVec{ matTimes(mat, vec) };
+			if (! nearlyEquals(gotVec, expVec, sTol))
+			{
+				oss << "Failure of matrixFrom() sandwich test\n";
+				oss << "spin: " << spin << '\n';
+				oss << "expVec: " << expVec << '\n';
+				oss << "gotVec: " << gotVec << '\n';
+			}
+
+			if (! (orthogonalityError(mat) < sTol))
+			{
+				oss << "Failure of matrixFrom() orthogonality test\n";
+				oss << "spin: " << spin << '\n';
+				oss << "err: " << orthogonalityError(mat) << '\n';
+			}
+
+			Spinor const & expSpin = spin;
+			Spinor const gotSpin{ spinorFrom(mat) };
+			if (! sameRotation(gotSpin, expSpin, sTol))
+			{
+				oss << "Failure of spinorFrom() round trip test\n";
+				oss << "expSpin: " << expSpin << '\n';
+				oss << "gotSpin: " << gotSpin << '\n';
+			}
+		}
+
+		if ( isValid(matrixFrom(zero<Spinor>()))
+		  || isValid(spinorFrom(matrixFrom(null<Spinor>())))
+		   )
+		{
+			oss << "Failure of zero/null conversion test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check orthogonality drift under repeated conversion and composition
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		// accumulate many small rotations alternately through both forms
+		Spinor const spinStep{ exp(BiVector{ .013, -.021, .017 }) };
+		RotMatrix const matStep{ matrixFrom(spinStep) };
+		RotMatrix mat{ matrixFrom(one<Spinor>()) };
+		for (std::size_t nn{0u} ; nn < 10000u ; ++nn)
+		{
+			RotMatrix prod;
+			for (std::size_t row{0u} ; row < 3u ; ++row)
+			{
+				for (std::size_t col{0u} ; col < 3u ; ++col)
+				{
+					prod[3u*row + col]
+						= matStep[3u*row + 0u] * mat[0u + col]
+						+ matStep[3u*row + 1u] * mat[3u + col]
+						+ matStep[3u*row + 2u] * mat[6u + col];
+				}
+			}
+			// round trip through spinor re-orthonormalizes
+			mat = matrixFrom(spinorFrom(prod));
+		}
+
+		double const err{ orthogonalityError(mat) };
+		if (! (err < sTol))
+		{
+			oss << "Failure of orthogonality drift test\n";
+			oss << "err: " << err << '\n';
+		}
+
+		Spinor const expSpin{ pow(spinStep, 10000.) };
+		Spinor const gotSpin{ spinorFrom(mat) };
+		constexpr double tolDrift{ 1.e-10 };
+		if (! sameRotation(gotSpin, expSpin, tolDrift))
+		{
+			oss << "Failure of accumulated rotation test\n";
+			oss << "expSpin: " << expSpin << '\n';
+			oss << "gotSpin: " << gotSpin << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check batch conversions
+	std::string
+	test3
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		std::size_t const numSpins{ 3u * priv::sMinItemsPerThread + 5u };
+		std::vector<Spinor> spins;
+		spins.reserve(numSpins);
+		for (std::size_t nn{0u} ; nn < numSpins ; ++nn)
+		{
+			double const dd{ static_cast<double>(nn) };
+			BiVector const biv{ .001 * dd, -.0003 * dd, .5 };
+			spins.emplace_back(exp(biv));
+		}
+
+		std::vector<RotMatrix> mats(numSpins);
+		batch::matrixFrom(spins.cbegin(), spins.cend(), mats.begin(), 3u);
+		std::vector<Spinor> backs(numSpins);
+		batch::spinorFrom(mats.cbegin(), mats.cend(), backs.begin());
+
+		std::size_t errCount{ 0u };
+		for (std::size_t nn{0u} ; nn < numSpins ; ++nn)
+		{
+			if ( (! nearlyEquals(mats[nn], matrixFrom(spins[nn])))
+			  || (! sameRotation(backs[nn], spins[nn], sTol))
+			   )
+			{
+				++errCount;
+			}
+		}
+		if (0u < errCount)
+		{
+			oss << "Failure of batch conversion test\n";
+			oss << "errCount: " << errCount << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of Spinor/RotMatrix conversions
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+	oss << test3();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,296 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::rotSync()
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3rotsync.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	constexpr double sTol{ 1024. * std::numeric_limits<double>::epsilon() };
+
+	//! True if spinors represent the same rotation (either sign)
+	bool
+	sameRotation
+		( g3::Spinor const & gotSpin
+		, g3::Spinor const & expSpin
+		, double const & tol
+		)
+	{
+		double const difPos{ g3::magnitude(gotSpin - expSpin) };
+		double const difNeg{ g3::magnitude(gotSpin + expSpin) };
+		return (std::min(difPos, difNeg) < tol);
+	}
+
+	//! Attitudes for test nodes (with node 0 at identity)
+	std::vector<g3::Spinor>
+	someAttitudes
+		( std::size_t const & numNodes
+		)
+	{
+		std::vector<g3::Spinor> spins;
+		spins.reserve(numNodes);
+		for (std::size_t nn{0u} ; nn < numNodes ; ++nn)
+		{
+			double const dd{ static_cast<double>(nn) };
+			g3::BiVector const biv
+				{ std::sin(1.1*dd), .5 * std::cos(.7*dd), std::sin(.3*dd) };
+			spins.emplace_back(g3::exp(biv));
+		}
+		spins[0] = g3::one<g3::Spinor>();
+		return spins;
+	}
+
+	//! Ring plus chord edges (with optional noise)
+	std::vector<g3::RelSpin>
+	someEdges
+		( std::vector<g3::Spinor> const & spins
+		, double const & noiseMag
+		)
+	{
+		std::size_t const numNodes{ spins.size() };
+		std::vector<g3::RelSpin> edges;
+		for (std::size_t nn{0u} ; nn < numNodes ; ++nn)
+		{
+			for (std::size_t const step : { 1u, 7u })
+			{
+				std::size_t const mm{ (nn + step) % numNodes };
+				double const dd{ static_cast<double>(nn + step) };
+				g3::BiVector const noise
+					{ noiseMag * std::sin(3.*dd)
+					, noiseMag * std::cos(5.*dd)
+					, noiseMag * std::sin(2.*dd)
+					};
+				g3::Spinor const rel
+					{ g3::exp(noise) * spins[mm] * g3::reverse(spins[nn]) };
+				edges.emplace_back(g3::RelSpin{ nn, mm, rel, 1. });
+			}
+		}
+		return edges;
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+		std::vector<Spinor> const expSpins
+			{ one<Spinor>(), exp(.3 * e12), exp(-.4 * e23), exp(.2 * e31) };
+		Spinor const & spin0 = expSpins[0];
+		Spinor const & spin1 = expSpins[1];
+		Spinor const & spin2 = expSpins[2];
+		Spinor const & spin3 = expSpins[3];
+
+		// [DoxyExample01]
+		// relative rotations: spinInto = rel * spinFrom
+		std::vector<RelSpin> const edges
+			{ RelSpin{ 0u, 1u, spin1 * reverse(spin0) }
+			, RelSpin{ 1u, 2u, spin2 * reverse(spin1) }
+			, RelSpin{ 2u, 3u, spin3 * reverse(spin2) }
+			, RelSpin{ 3u, 0u, -(spin0 * reverse(spin3)) } // sign irrelevant
+			, RelSpin{ 0u, 2u, spin2 * reverse(spin0), 2. }
+			};
+		SyncResult const sync{ rotSync(4u, edges) };
+		// sync.theSpins[nn] is attitude of node nn (with node 0 identity)
+		// [DoxyExample01]
+
+		for (std::size_t nn{0u} ; nn < expSpins.size() ; ++nn)
+		{
+			if (! sameRotation(sync.theSpins[nn], expSpins[nn], sTol))
+			{
+				oss << "Failure of rotSync() example test\n";
+				oss << "nn: " << nn << '\n';
+				oss << "exp: " << expSpins[nn] << '\n';
+				oss << "got: " << sync.theSpins[nn] << '\n';
+			}
+		}
+		if ( (! sync.theConverged)
+		  || (! (sync.theRmsAngle < sTol))
+		   )
+		{
+			oss << "Failure of rotSync() example convergence test\n";
+			oss << "rmsAngle: " << sync.theRmsAngle << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check noisy graph, unconnected nodes and invalid edges
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		std::vector<Spinor> const expSpins{ someAttitudes(50u) };
+		std::vector<RelSpin> edges{ someEdges(expSpins, 1.e-3) };
+
+		// spanning tree only (no refinement) for comparison
+		SyncControl ctlTree;
+		ctlTree.theMaxIter = 0u;
+		SyncResult const syncTree{ rotSync(52u, edges, ctlTree) };
+
+		// invalid edges (and extra unconnected nodes 50, 51)
+		edges.emplace_back(RelSpin{ 3u, 99u, one<Spinor>() });
+		edges.emplace_back(RelSpin{ 3u, 4u, null<Spinor>() });
+		edges.emplace_back(RelSpin{ 3u, 4u, one<Spinor>(), 0. });
+		edges.emplace_back(RelSpin{ 50u, 51u, exp(.1 * e12) });
+
+		SyncResult const sync{ rotSync(52u, edges) };
+
+		if ( (! sync.theConverged)
+		  || (! (sync.theRmsAngle < syncTree.theRmsAngle))
+		   )
+		{
+			oss << "Failure of noisy refinement test\n";
+			oss << "converged: " << sync.theConverged << '\n';
+			oss << "numIter: " << sync.theNumIter << '\n';
+			oss << "rmsTree: " << syncTree.theRmsAngle << '\n';
+			oss << "rmsSync: " << sync.theRmsAngle << '\n';
+		}
+
+		std::size_t errCount{ 0u };
+		for (std::size_t nn{0u} ; nn < expSpins.size() ; ++nn)
+		{
+			if (! sameRotation(sync.theSpins[nn], expSpins[nn], 5.e-3))
+			{
+				++errCount;
+			}
+		}
+		if (0u < errCount)
+		{
+			oss << "Failure of noisy attitude test\n";
+			oss << "errCount: " << errCount << '\n';
+		}
+
+		if (isValid(sync.theSpins[50]) || isValid(sync.theSpins[51]))
+		{
+			oss << "Failure of unconnected node test\n";
+		}
+
+		return oss.str();;
+	}
+
+	//! Check concurrent refinement is repeatable
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		std::vector<Spinor> const expSpins{ someAttitudes(5000u) };
+		std::vector<RelSpin> const edges{ someEdges(expSpins, 1.e-3) };
+
+		SyncControl ctl;
+		ctl.theMaxIter = 2u;
+		ctl.theMaxIterCG = 50u;
+		ctl.theNumThreads = 1u;
+		SyncResult const syncOne{ rotSync(expSpins.size(), edges, ctl) };
+		ctl.theNumThreads = 4u;
+		SyncResult const syncFourA{ rotSync(expSpins.size(), edges, ctl) };
+		SyncResult const syncFourB{ rotSync(expSpins.size(), edges, ctl) };
+
+		std::size_t errCount{ 0u };
+		std::size_t difCount{ 0u };
+		for (std::size_t nn{0u} ; nn < expSpins.size() ; ++nn)
+		{
+			Spinor const & spinOne = syncOne.theSpins[nn];
+			Spinor const & spinFourA = syncFourA.theSpins[nn];
+			Spinor const & spinFourB = syncFourB.theSpins[nn];
+			// same number of threads: identical results
+			if (! (magnitude(spinFourA - spinFourB) == 0.))
+			{
+				++errCount;
+			}
+			// different thread count: only summation order differs
+			if (! sameRotation(spinOne, spinFourA, 1.e-12))
+			{
+				++difCount;
+			}
+		}
+		if ((0u < errCount) || (0u < difCount))
+		{
+			oss << "Failure of concurrent repeatability test\n";
+			oss << "errCount: " << errCount << '\n';
+			oss << "difCount: " << difCount << '\n';
+		}
+
+		return oss.str();;
+	}
+
+}
+
+//! Check behavior of rotation synchronization
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
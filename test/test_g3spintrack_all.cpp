@@ -0,0 +1,278 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for engabra::g3::codec::SpinTrack
+*/
+
+
+#include "checks.hpp" // testing environment common utilities
+
+#include "g3spintrack.hpp"
+
+#include "g3compare.hpp"
+#include "g3func.hpp"
+#include "g3io.hpp"
+#include "g3ops.hpp"
+
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	// Keep test code focused on internal structure under main project name
+	using namespace engabra;
+	using g3::nearlyEquals;
+
+	//! Rotation angle between attitudes (independent of spinor signs)
+	double
+	angleBetween
+		( g3::Spinor const & spinA
+		, g3::Spinor const & spinB
+		)
+	{
+		g3::Spinor const rel{ spinB * g3::reverse(spinA) };
+		double const sca{ std::abs(rel.theSca[0]) };
+		double const biv{ g3::magnitude(rel.theBiv) };
+		return 2. * std::atan2(biv, sca);
+	}
+
+	//! Smoothly varying trajectory sampled at numSpins times
+	std::vector<g3::Spinor>
+	someTrajectory
+		( std::size_t const & numSpins
+		, double const & dt
+		)
+	{
+		std::vector<g3::Spinor> spins;
+		spins.reserve(numSpins);
+		for (std::size_t nn{0u} ; nn < numSpins ; ++nn)
+		{
+			double const tt{ dt * static_cast<double>(nn) };
+			g3::BiVector const biv
+				{ .3 * std::sin(.7 * tt)
+				, .2 * tt
+				, 1.5 * std::cos(.3 * tt)
+				};
+			spins.emplace_back(g3::exp(biv));
+		}
+		return spins;
+	}
+
+	//! Examples for documentation
+	std::string
+	test0
+		()
+	{
+		std::ostringstream oss;
+
+		std::vector<engabra::g3::Spinor> const spins
+			{ someTrajectory(1000u, .01) };
+
+		// [DoxyExample01]
+		using namespace engabra::g3;
+
+		// encode trajectory (e.g. 'spins' is std::vector<Spinor>)
+		codec::SpinTrack track{ codec::TrackParms{ 1.e-6, 256u } };
+		track.add(spins.cbegin(), spins.cend());
+		std::size_t const numBytes{ track.theBytes.size() }; // vs 32 each
+
+		// decode (random access or sequentially)
+		Spinor const spin7{ track[7u] }; // within 1.e-6 (radians) of spins[7]
+		std::vector<Spinor> gots(track.size());
+		track.decodeAll(gots.begin());
+		// [DoxyExample01]
+
+		double const bytesPer
+			{ static_cast<double>(numBytes)
+			/ static_cast<double>(spins.size())
+			};
+		if ( (! (bytesPer < 8.))
+		  || (! (angleBetween(spin7, spins[7]) < 1.e-6))
+		  || (! nearlyEquals(spin7, gots[7]))
+		   )
+		{
+			oss << "Failure of SpinTrack example test\n";
+			oss << "bytesPer: " << bytesPer << '\n';
+			oss << "err7: " << angleBetween(spin7, spins[7]) << '\n';
+		}
+
+		return oss.str();;
+	}
+
+	//! Check error bound, random access and sign/null handling
+	std::string
+	test1
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		std::vector<Spinor> spins{ someTrajectory(5000u, .001) };
+		// sign flips, null sample, and a large jump
+		for (std::size_t nn{1200u} ; nn < 1300u ; ++nn)
+		{
+			spins[nn] = -spins[nn];
+		}
+		spins[2000] = null<Spinor>();
+		spins[3000] = exp(BiVector{ 1., -1., .5 });
+
+		for (double const & maxErr : { 1.e-4, 1.e-7 })
+		{
+			codec::SpinTrack track{ codec::TrackParms{ maxErr, 100u } };
+			track.add(spins.cbegin(), spins.cend());
+			std::vector<Spinor> gots(track.size());
+			track.decodeAll(gots.begin());
+
+			double maxGot{ 0. };
+			std::size_t errCount{ 0u };
+			for (std::size_t nn{0u} ; nn < spins.size() ; ++nn)
+			{
+				Spinor const & exp = spins[nn];
+				Spinor const & got = gots[nn];
+				if (isValid(exp))
+				{
+					maxGot = std::max(maxGot, angleBetween(got, exp));
+					// same sign (as well as same rotation)
+					if (! (magnitude(got - exp) < 1.e-3))
+					{
+						++errCount;
+					}
+				}
+				else
+				if (isValid(got))
+				{
+					++errCount;
+				}
+				// random access agrees with sequential decoding
+				Spinor const ranGot{ track[nn] };
+				if (isValid(got) && (! (magnitude(ranGot - got) == 0.)))
+				{
+					++errCount;
+				}
+			}
+			double const bytesPer
+				{ static_cast<double>(track.theBytes.size())
+				/ static_cast<double>(spins.size())
+				};
+			if ( (0u < errCount)
+			  || (! (maxGot < maxErr))
+			  || (! (.1 * maxErr < maxGot))
+			  || isValid(track[spins.size()])
+			   )
+			{
+				oss << "Failure of SpinTrack bound test\n";
+				oss << "maxErr: " << maxErr << '\n';
+				oss << "maxGot: " << maxGot << '\n';
+				oss << "errCount: " << errCount << '\n';
+				oss << "bytesPer: " << bytesPer << '\n';
+			}
+		}
+
+		return oss.str();;
+	}
+
+	//! Check samples without direction and non-unitary key records
+	std::string
+	test2
+		()
+	{
+		std::ostringstream oss;
+
+		using namespace engabra::g3;
+
+		constexpr double inf{ std::numeric_limits<double>::infinity() };
+		constexpr double tiny{ std::numeric_limits<double>::denorm_min() };
+		std::vector<Spinor> spins{ someTrajectory(40u, .001) };
+		spins[0] = 2. * spins[0]; // non-unitary key record
+		spins[10] = zero<Spinor>();
+		spins[20] = Spinor{ tiny, 0., 0., 0. };
+		spins[30] = Spinor{ inf, 0., 0., 0. };
+
+		codec::SpinTrack track{ codec::TrackParms{ 1.e-6, 100u } };
+		track.add(spins.cbegin(), spins.cend());
+		std::vector<Spinor> gots(track.size());
+		track.decodeAll(gots.begin());
+
+		std::size_t errCount{ 0u };
+		for (std::size_t nn{0u} ; nn < spins.size() ; ++nn)
+		{
+			Spinor const & exp = spins[nn];
+			Spinor const & got = gots[nn];
+			if ((0u == nn) || (10u == nn) || (20u == nn) || (30u == nn))
+			{
+				// stored exactly as key records
+				for (std::size_t kk{0u} ; kk < 4u ; ++kk)
+				{
+					if (! (got[kk] == exp[kk]))
+					{
+						++errCount;
+					}
+				}
+			}
+			else
+			if (! (angleBetween(got, exp) < 1.e-6))
+			{
+				++errCount;
+			}
+		}
+		if (0u < errCount)
+		{
+			oss << "Failure of SpinTrack no-direction sample test\n";
+			oss << "errCount: " << errCount << '\n';
+		}
+
+		return oss.str();
+	}
+
+}
+
+//! Check behavior of spinor time series codec
+int
+main
+	()
+{
+	int status{ tst::CTest::fail };
+	std::stringstream oss;
+
+	oss << test0();
+	oss << test1();
+	oss << test2();
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = tst::CTest::pass;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}